@@ -0,0 +1,20 @@
+; Closure creation and calls through captured environments
+(defun make-adder (n) (lambda (x) (+ x n)))
+
+(defun compose (f g) (lambda (x) (f (g x))))
+
+(defun twice (f) (compose f f))
+
+(defun apply-n (f n x)
+  (if (< n 1)
+      x
+      (apply-n f (- n 1) (f x))))
+
+(defun adders (i total)
+  (if (< i 1)
+      total
+      (adders (- i 1) (+ total ((twice (make-adder i)) 1)))))
+
+(apply-n (twice (make-adder 3)) 50000 0)
+(adders 20000 0)
+(apply-n (lambda (x) (let ((y (+ x 1))) ((lambda (z) (+ z y)) 0))) 50000 0)
@@ -0,0 +1,23 @@
+; Non-tail recursion thousands of calls deep
+(defun depth (n)
+  (if (< n 1)
+      0
+      (+ 1 (depth (- n 1)))))
+
+(defun build (n)
+  (if (< n 1)
+      nil
+      (cons n (build (- n 1)))))
+
+(defun count (lst)
+  (if (eq lst nil)
+      0
+      (+ 1 (count (cdr lst)))))
+
+(defun repeat-deep (i)
+  (cond ((< i 1) nil)
+        (t (depth 10000)
+           (count (build 10000))
+           (repeat-deep (- i 1)))))
+
+(repeat-deep 20)
@@ -0,0 +1,18 @@
+; Factorial, recursive and accumulating, run many times over
+(defun factorial (n)
+  (if (< n 2)
+      1
+      (* n (factorial (- n 1)))))
+
+(defun factorial-acc (n acc)
+  (if (< n 2)
+      acc
+      (factorial-acc (- n 1) (* n acc))))
+
+(defun repeat-factorial (i)
+  (cond ((< i 1) nil)
+        (t (factorial 12)
+           (factorial-acc 12 1)
+           (repeat-factorial (- i 1)))))
+
+(repeat-factorial 20000)
@@ -0,0 +1,29 @@
+; Build, map and sum large lists: cons allocation and GC
+(defun range (i n acc)
+  (if (< i n)
+      (range (+ i 1) n (cons i acc))
+      acc))
+
+(defun reverse-onto (lst acc)
+  (if (eq lst nil)
+      acc
+      (reverse-onto (cdr lst) (cons (car lst) acc))))
+
+(defun map-acc (f lst acc)
+  (if (eq lst nil)
+      (reverse-onto acc nil)
+      (map-acc f (cdr lst) (cons (f (car lst)) acc))))
+
+(defun map (f lst) (map-acc f lst nil))
+
+(defun sum (lst acc)
+  (if (eq lst nil)
+      acc
+      (sum (cdr lst) (+ acc (car lst)))))
+
+(defun run (n)
+  (let ((nums (range 0 n nil)))
+    (sum (map (lambda (x) (- (* x 2) n)) nums) 0)))
+
+(run 100000)
+(run 100000)
@@ -0,0 +1,77 @@
+; Parser stress: large quoted data, deeply nested and long lists
+
+'((alpha))
+'(91824 (26048 (bar (((cdr 40308 x 7629) (68984) y (63878)) item 60428 (delta cdr 20567 (61461 56874 z) (14125 lambda 33082)) (58070 (64526 count alpha) (baz delta baz 93491) 169 count (91432 57410 3048))) (cdr (64406 (30959 cdr -667) (6741 x y count lambda 15876) (95696 baz 14927) (19378 foo x 70350 z)) (bar (baz 91742 item 78232 x) (16028) (alpha 90382 delta)) delta)) ((((79445 alpha) (21300 73624)) 61037 ((34916 y 2121 52047) (75553 baz) (58119 baz lambda 56939) (beta 40032 61851 92037 bar 27840)) lambda ((57954 34521 beta) (car 33090 gamma 65940 18577 66881) (27393 55150 36585 y x lambda) (cdr cdr lambda 42826) 28569 (85100 gamma y 27213 31892 count)) 62659)) ((((z cdr z car delta) cdr (item 46321 71630 lambda item) (x 90315 20979 15065 10679 49972) (cdr 69258 10909 alpha 33205)) (gamma 62172 21245 (z y item 42519) (99707 gamma 74209 40390)) (19324 (57189) car (item 95976 63898 gamma 24753) (88480) 74911) baz (item (item) (42705 x cdr alpha) (62592 baz z 89245) (lambda count lambda 35328 baz) 8004) 40252) 4680)) (((x 10216 ((y y) (lambda) item 38497) ((beta car 70011 x 68224) 37733 85329)) (((7855) (count) (car 23170 y z 86682 z) (count 88154 baz) (66684 28728 item gamma 32474 delta) (15651 gamma alpha baz)) ((-2) (beta cdr) (cdr lambda) 67868 (z gamma))) (((alpha) (75327 baz)) ((foo 29019) (15374 80285 count) 63666 (count baz 85901) (baz 32177) 47704)) (y ((51549) (item delta bar x count 59262) (beta x) (baz 4539)) beta ((gamma alpha alpha 33863 30612 gamma) (81083 bar 23095 lambda 72483) 30348 66569 (lambda)))) (73308 (((3896 9250 x) alpha (alpha)) item 33824) (((delta 21572 51391 91817)) ((88014 7800 11613 81861) (73435 16275) (39858 alpha lambda) (1162 bar) (count 88713 8147 99549 6543 60000) bar)) (delta ((98785) (28096) (item lambda) (y 57203) (-272)) (count))) (17355 (((90985) (58854 baz) (57756 delta)) (77174 (foo) (28816 x foo 37010 98276)) ((89585 68707 65168 37952) y (92157 4630 item 79490 z)) ((y car) beta (y 19900)) (alpha (82348 90054) (alpha))) ((93833 (x car 28191 cdr lambda 8787) alpha (82811 41766 46631)) ((beta 13957 18955) (beta 81889 foo bar 99361)) 38640) x (44439 ((beta delta item 17894) (99147 beta) (cdr 78405 18842 z x 20394)) 10570 ((1906) (28194 alpha 88135) (48451 33379 cdr 20143) (56927 8506 11021 41 31008)))) 33061))
+'((((((x 22940 cdr 87196 baz 95058)) ((66404 item 60647 bar z))) (((car 51230 count 24779 96503) (86288 z) (6246 delta) item car item) ((bar 67507 40709) (item x 92972 68379 56178)) ((car 58817 cdr 31626 30206) z)) cdr (((67388 count 212) (car 19734) (55922)) 6747) (91516)) ((((50379 60762 35308)) ((beta 19552 32058) (84309 car 29251)) ((item) 4935 car (22669) (baz 72888 38075 54711 bar 12132) (beta 21410 57942 90654 52126)) bar) (x 54765 ((15588) (61774 lambda car 86716) (x 98243 lambda 44220 259))) cdr 5892 21538 (((84751 79698)) 47885 ((car) (item 31603 38029 -625 70663) (90532 delta 57934 5371 19261) (count 12362 count 98327 70994 8810) (20556 42506 52850 item) 11212) ((alpha 41479 baz foo) (x) (beta delta 23376 gamma cdr)) ((gamma 52991 10132 64976 beta) (48750 18397) (bar bar 90103) z) (63689 car (bar) 21840 gamma (95198)))) ((11128) (49654)) (alpha (((lambda) (cdr delta y 90715 13804 alpha) (89511 item delta gamma z count) (84435 lambda)) ((car 25415 item count)) ((foo y x 86010) (item) count) foo) x (((44585 17104 lambda gamma) gamma (x z item) (33598 6050 z 19479)))) ((count) foo ((54808))) ((z ((27546 16310 foo 97142) 68336 (63785 car 76520 z 72568)) foo y beta) ((71149 (delta gamma 26169 bar alpha) (87287 bar bar 88462 14914 15216) z) ((item 58902 93181 44175) alpha) ((27027 51095 y 66538 73231 78243) 13143 31067 (lambda delta) gamma 20378) 26671 83686 ((item baz 69228 item cdr) 64627 (47203 37426) (foo gamma 36746 52899 93805) lambda (car))))) (-894 ((((foo foo car lambda)) ((25175) (foo 21438) (y 74635) lambda (baz) (item)) (32861 gamma) ((alpha y 70690 item) (26080) (beta bar bar 23676 gamma car) beta) ((beta 24441 car count) (52519 52476 31125 38561 foo 13504) (count delta 68231) (cdr))) (((50018) 59220 (39209 z 6645) (75394 90232 65596 74847) 54379 (x 36408 car)) ((16680 61149 79697) (38088 count) alpha) ((delta alpha) (car count 35908 beta) (12579 delta 38813 cdr) (baz 59619 15783) (14597 lambda 47132 62295 60790 87255) delta)))) ((4732 (((72424 baz) (54706 96113) (3570 delta))) 26904 (((34366 16247 gamma foo)) ((cdr z) z) (14256 74913 (63946 beta 81054 cdr 7014) (alpha 30986 14324 gamma 26195) (baz count) (delta baz)) ((39189 cdr) (count 88552)) car)) delta ((39392 ((67191) (baz 11255 86593 car 18176 54026) 14996 (50656)) ((37067 24211) (lambda) (84895) (11336 53426 foo 5208) lambda 8842) ((car 72560) (z z baz 22337 y 47088) (92945 lambda 47529 54882 50658 delta)))) gamma (((y (cdr 92322 count item)) (33307) ((item) 494 x bar (65978 y 61439 z 15141)) (item (item 60351 57739) (48517 y 63117 cdr item y) (7827 76004 10695) (34033)) (31975 (gamma y)) 91142) (30508 ((lambda 54987 98841 65988) (11159)) (alpha) ((35678) (x 52048)) y) (((54920 cdr 90384 gamma)) cdr ((z 48859 delta 83860) 41027 (25276 cdr 26949 16840 90112))) (((6220 3185) 49702 bar (31104 63480 x 53936) (39825 cdr alpha 39057) (71689)) ((49129) (72975) (12524 item beta 43931 car 54195) (baz) (z)) ((75150 car beta 83338 11238) (alpha 94882 95718 lambda) (19143 85330 83922)) ((lambda bar) foo (36637 4650) (count x count) 95519) ((cdr) (16557 71909 95668) (z count 86198 59349 car) item 44174)) (35828 ((delta 3499 foo 91327 lambda item) (car y baz) 82198 (4488) (25911 30623 10213 y)) cdr ((97693 79864 45620 57609 cdr) (bar 58064 43812 52125 alpha cdr))))) 1570 (((((40489 gamma 66610) (77738) 16452 (bar))) (((37590 lambda) count (y 3936 92842 y) (60932 baz)) ((item car 92865) (54269 67431 cdr) (88760 21155 cdr)) ((beta delta beta y 52787 car) (8857 y)) delta (beta (9738 77091 lambda count 75408 3324) (38679 car) (y cdr 31344 item 16367 x)) ((baz) y (35215 71691 gamma count) (baz bar 85582) (89753 44773 x gamma x 54901))) 28858 y) count (98059 item (item (33555 95193) ((y 55453 item) (67804 14540 beta foo 21362 30728) -76 (36946) (bar 33190 x 22433 car)) 47994) (((x y alpha gamma 48518) (gamma 21292 cdr cdr 82400 92491) (11296 item 12362) 31670 foo) (11681 gamma) foo ((lambda 23823) 49526 (bar beta 19025 alpha beta) (12145 93323 baz 86866 delta)) (alpha (87641 foo alpha z) 23856 y count) ((cdr 50398) (41125 30977 alpha) (53494 alpha z) 93240 93830)) (((baz 22450) (baz cdr bar 78863) (baz 89408 cdr 24448) (68205) (lambda 24120 55226 86315) (lambda foo)) (4453 (lambda)) ((12379) (97876) (y) count (alpha)) ((28328 27959) x cdr (delta 45349 67567 95272 4432) (96694 -784) (foo)))) bar))
+'((beta y item ((((cdr beta 49593 bar 54773) z 28058 (68235 23640)) ((baz) (48375 bar y 72466 item delta))) (((61225 lambda) (7679 lambda gamma x 59699 car)))) (83017 24914 (((89033 cdr z) (car 73601) (beta x y) (foo))) (((x 87726 47046 98049 64203) item (35610 38957) (51677)) ((32270 99657 delta z beta 23454) bar 88649 (4731 51514) (cdr car car bar)) ((7764 26216 21165 item) (foo item item)) ((25169 car) (51531 31019 x alpha y 63935) (68925) (foo delta item lambda) cdr) baz car)) (foo 76214 (((beta item 65632)) beta (6536 (213 75843) (-973 z count 48509 car 25950) (item 78887 43222) 57886 (30973 85365 beta gamma 22115 item)) 65974 (73100 y (cdr item 56182 73721 cdr beta) bar (count cdr 91236 42030 23656) (y delta 1186))) (((bar 2015) 90788 (56097 84351))) x (((gamma 37059 65155))))) ((127 (((72568) 20493) z ((bar) (beta) 53468 (lambda car 21676 88520 baz)) item) -933 gamma delta) 68950 (foo) ((((65488 8082 44294 24620) (30552 alpha 59833 92527 46156) (car) (cdr 53751) baz foo)))) car)
+'(((8586 bar lambda (((70162 34137 car x 6465) (foo alpha baz item) 45464 cdr (baz) (y delta y 51674 59720)) (4674 44863 (46120 87205) (x lambda) cdr) ((beta baz)) ((x x foo)) lambda) (42434) (((lambda 64157 43923 8561 -949 foo)) ((x bar y 85651)) car ((x 69243 bar 28295 z 29572) (96278) (58798 foo 90642 beta 75194 bar)) ((51295 gamma x beta) (51221 55652 delta cdr 21924) 80320) ((69991 72612 y z 17282) (lambda) z foo))) ((lambda ((74037 item gamma alpha 75972 z) (delta lambda bar 11054 59296) alpha (item 4183 lambda beta)) (y 93344 (95958 67512 count 87749 gamma) (46381 gamma lambda 34121))) (((item 53597 x beta car car) 52822 (91601 29648 34896 x 85022 lambda) (30849 60377))) gamma)) 42484 ((y) ((1386 36824 ((count 83749 beta) (lambda bar) (3300 x 43599) (60432 item))))) (((((item 86451 74364 lambda 37521 36188)) (91897 x gamma (car 62148)) ((39764 cdr beta) (alpha alpha x) (gamma 12650 55727) (count 17954) (11315 39363) (item))) (((16001 gamma 9168 x 61070)) car ((10415 bar 42007 79554 59630 item))) count 81458 lambda 38787) delta ((((69706) (87727 count y foo) baz))) ((33322 57864 ((65575 cdr 72896 72199) (66143 item 98554 lambda) (gamma cdr 68481 foo 19961) (delta count 42135) (baz foo 74675) 80472)) ((delta (60244 item beta z) (40968 6984 alpha car 11782 y) (car) (bar) (82614 76838 delta cdr bar))) (((count cdr delta alpha delta x) alpha) ((baz 97842 item)) (87225 (z foo y foo baz y) lambda (49028 75966 x) 29945 (count car count 19478)) 69956 y ((57116 46829 26211 75728 20173) item (93871 22650 z car 6985) (alpha z 8088 beta 85406 80977) (foo count x y))) 5701 x) (y) 13065) (((15273) baz (12421 (61247 6279 63178) (80886 (z) baz gamma) ((item y alpha 17820 delta) (86578 delta x 51688)) ((51094) (alpha 83746 384 car car) delta) baz) (y ((y)) ((79676 count) (item 43502) (96378 lambda 36188)) bar ((baz)))) delta ((((cdr 14604 66707 89182) (98674) (cdr) (count beta 57287 69428 48515) (75725 x bar -562)) ((40305 36255 bar beta) (lambda) (gamma z 73799 77357 alpha)) ((x y z y)) ((48690 delta 87616 29139 41553 gamma) (19713) count) ((x 14825 alpha item) count (car gamma gamma count item) (car 93148 45041 car)) (gamma (92586 51036 alpha 14149) (bar lambda beta 94056 28656 bar) (y 77672 beta bar) (foo y bar) 34352)) (((24597 foo beta 2150 cdr 99800)) 83329 ((baz 69324 27367 77656) (28496 car lambda y) (baz 26871 94699 53737 count) z 38312 cdr)) (y ((y cdr lambda 60366 x) 48616 (33158 62419 x 2071 z 66085) (40903 91853) (foo car gamma 63552 33505)) 58839 ((foo 43900 y 15669) 75201 (foo count item 57264)) ((59890 z) delta delta)) car ((13754 beta (count delta z 65179 25991)) (97013) cdr (gamma))) ((((96118 bar x)) (bar (60848 92587 delta y))) (95405 ((delta) (74628 foo 97578 40680 bar 20048) (x) z) ((6238 y x 39768 78569) (53458) cdr (cdr x baz delta car 3126) (item item alpha) (item 96481 82492 gamma)) ((x) (47237 alpha foo delta bar gamma) delta)) count (62400 ((gamma item) 16355 (cdr 16929)) (lambda (foo))) count (((alpha 47334 beta 90481) (32829 97609 85104)) (67644 (25483 48503) (97077 45819) (x 18442 bar 17879) (count y 424 foo 92484 67798) (90328 48098 delta delta 57030)) ((car count 41913 24435 2370 beta) (39579 44702 18423) (33386) 77088) ((19213) 77385 (cdr x car count)) delta)) 41088))
+'((77142 (count (((96878 count delta bar count delta)) (23558 (bar 9416)))) 64162) (beta ((((45970 x count cdr) 81912) y (y (x alpha) car (19295 lambda cdr alpha 11464 53080) (car 85 62239 8383) (9239)) ((car cdr) (z x)) ((x 60671) (count car z -166) (lambda) foo)) count) (((alpha (75255 51359 6792 49617) (y count 3130 26749 23116) (z cdr foo 79073 32427 69404) (65320 9407 count) 63140)) ((45999 (bar) (lambda 96075 58744 delta beta))) 96988 (((63122 74060 beta) gamma (z lambda count 70043) (59146) (foo count lambda count)) ((count y car) (foo car baz x) 98305 (32455 gamma count 78310) (baz delta) (foo bar 96356 x 85254 17821)) ((30669 29316 x 69177)) (item) 63572 (delta)) 30429 (baz ((94877 bar y car 28035 11145) (delta car foo foo count) (79696 bar baz 70121 count) (delta 33119 item z) (6494 lambda z 70964 2564))))))
+'(((74818 (((51384 gamma) (9229 delta 79157 foo item 51345) (baz beta) (car 13272 50199 3227 74880)) (60353 (1716 x 52881 73300 43150 lambda))) alpha 74805) ((((75743 lambda car gamma)) ((car foo bar count cdr item) (62212 bar 30032 beta bar 9058)) ((99825 26719 42488 79469) gamma (gamma 68584 bar 59576)) ((car 31810 baz 9646) (alpha baz) (item) (count alpha count) (lambda foo 1531 50933 58040) (x beta))) (44130 lambda) (((53399) (58367) (y 32466 74030) 95879) ((lambda 18049 foo delta) (29182 z) (51446 29834 19438 beta) (32537))) (((delta count delta 65030 68616) (17246 66823))) ((99453 alpha car (43696 13359 1380)) (alpha (beta car) (12531 21224 65793 52055 gamma delta) 42143 (78544 88484))) (38034 baz alpha)) (car (cdr (bar (36750 lambda 99607 97684) (beta)) car ((2064 79608 78940 item)) (15663 (alpha 44379 44381 count 21801 49437) (14667 90568 item) (54083 car lambda x))) (((22689 gamma 93300 71068 item) (94019 82426 car item 59351 foo) (beta) (99405)) ((16962 83988 item 16544 83728 baz) (74838 alpha 69295) 90924 (cdr y alpha 68834) (68221 y foo alpha 54332)) y 52791 ((count 96997 57293 car) (delta 4293) alpha (26795 50649 car 36099 23924) (17699 839 y z count) (cdr)) ((36706 55371 car item) (45777 25129 count baz 34883) (item item 38628 beta 10724 58353))) ((foo (70736 3534 40432 535) delta (bar 46263 baz 50243 23669) (75852 79890 82802 lambda 94988) bar) 19239 ((64540) (lambda alpha 97466 alpha alpha)) (5011 (60021 2705) (bar alpha) (x) 30726 alpha) ((y 43186 lambda lambda) (93708 x 43284 75389 gamma -335) (52477 51952 33807 87092) (cdr delta 17746 beta 55666 item)) ((count baz 52000 z 7168 75981) (count 68559 2980) (99309) (86870 x 14474 81329))) (alpha ((gamma car 97597 43677 x))) (((19560 99196) (20991) (alpha) (alpha beta 54790 beta))))))
+'(((cdr (((count foo 36778 82207) (beta) (13666)) (cdr (foo cdr) (18399) 82141 51250 19585) 82750 ((lambda 28673 z) 63170 (z x 53890) 15317 (gamma alpha) (55853 3061 57394 y))) item (((83457 18509 car foo 63202 32732) delta) (34978 (3120 y y) z)) (((foo 51677) 49453 (beta 49501 lambda 16414 89025) 97237 99598) ((48860 33157 delta)) x)) ((((item 82211 count 8613) (53085) beta (35733 item item baz) (delta) (4613 28217 foo 34397 lambda))) ((87208 18830) ((23922 24722 z delta 73201 51594)) ((item) (7467 bar 26743 bar y baz) (foo) (lambda 84865) (76268 z) (11562 44248 93439 delta 49641)) (z (48217 count z count 88245 17972)) foo baz) (98116 ((delta 20611 59422 57915 count cdr))) x (56541 (80057))) (((bar (70110) alpha 80843)) (((foo) (car lambda 75522) (z gamma)))) 88722 ((((92462) (57364 cdr delta 80554 bar)) 90231 ((z 15090 beta car) (lambda gamma z 96084) (14673 95219 48830 27742 count) (14102 11320)) ((44932 lambda) 61769 (x beta) 57858) ((84125 z) (lambda car beta 82488 74529) (81737 beta delta) (10748 56462 51116 cdr foo) (55377 foo))) gamma (27489 ((delta) cdr (y 6406 foo foo 36756) -216)) 15690)) gamma y (27706 ((baz) (((z delta item 15955) (item cdr 88109 bar baz 10302) (1411 cdr baz 2099) (car y beta x 18756) alpha (beta item)) alpha ((19107 36787 item bar) beta (item gamma y 26271 alpha cdr) (gamma z 57918 z)) 45446 alpha) (y ((19330 baz 78743 count) z (32163 lambda 59217) y (30092 gamma x 58065 lambda) (34955 gamma 81138 foo baz)) 76933)) (91207 (54208 item (26123 77717 5702 alpha) ((15992 cdr 40149) 2637 72767 (12639 62029 47616 z 11004))) ((54476 (61353 25797) (bar lambda z 57044) gamma (53957 z lambda)) ((47572 alpha) (24283 43440 4281 55739) (lambda x 56942 14344) (delta 9772 65765 53389) 24958 count) (y) ((91759 20607 10343 y car) (77005 y) (22781 y foo cdr) 99471 (cdr cdr 60983 57807 delta x) (x x z)) count (car)) -944 ((gamma 67256 (65311 97203))))) (beta ((63047))))
+'((((72843 foo 30690) delta (86447 ((81467 baz 90768 74150) (95211 53047 count count)) 60094) (((10008 z) (delta 97217 49425 31826) (bar) 90438 (x gamma 42334) (beta z)) (77391 baz (count alpha 36117 58432 57113) (count 61068 33323 cdr)))) (((cdr (99383 52140 84598) (41582 70048 gamma beta) 32039) ((21267) gamma (car foo delta 32341 alpha)) ((z 7303 baz)))) ((((35271 baz delta alpha 59662) (car item 36231 bar 37638) (36124 lambda 67996) (8307 64416 2101 item 19108) 60032) foo item y (48314 68806 (62985 delta x 30798 93471 31853) gamma) ((14449 car bar 97416 10541 41638) (26570 35541 57708) (1141 alpha delta 72913 84822 60266) (z 33416 beta))) ((cdr (bar 14754 z 90122 41715 26945) (cdr 49057)) baz ((bar delta 77004) (23012 cdr 81019 y) (gamma) (gamma foo 64064))) ((90807 (lambda 29297) (63895 26764) (cdr alpha 15733) (94009 baz) (bar delta bar car 12922)) (43916 delta (alpha 56260) (count) 18177) ((beta) 38131 gamma (625 cdr))) ((19051 foo (29580 z 57493 16940 gamma 52804) (58772 delta) count) ((x gamma) (3047 lambda bar item 59227)) x 81718 ((21965 89027 lambda lambda) (gamma lambda alpha lambda 43273 beta) (gamma)) 70136)) ((bar) ((92428 (73981 58253 item beta) (50484 48856 item) (alpha 93685) (item)) y beta ((x item 584 z) (7726 74636 cdr beta) (count 78641 delta alpha 11467)) (count (car delta) (93402 14592 count 33124 beta count))) (((97212 count y bar z)))) 41314 (y)))
+'(55298 (((((4406) 80048 (y y baz) (bar) (cdr 61494 31630 54456 gamma)) (97385 (baz) (count) (bar car) (bar 44833 count car car 17403) (11280 lambda 77526 car 11378 delta)) ((1976 45990 gamma) (beta) (bar) 33671 (95093 z delta 9148 7494)) 75083 ((42164 gamma 69587) 33606 bar 8248)) 1014) car 38910 beta) (((y (22597 (89074 88590 z) (53572) (car count y beta) (89870))) 7995 ((beta (bar delta) 97699 (x count 2356)) ((z 33808) (car) (x car) 83901) ((95026 y))) (((13773 lambda)) 80222)) (((52417 (foo 18422 z 78254 73792) (55970 beta 2829 gamma 53539 alpha) (car 26466 foo) (alpha baz) (cdr 82398 22216 bar))) ((59377 (baz y) (car) (beta car lambda gamma) (cdr 90413 81576 52562 47812 z) (car 19879)) (93718 (count 76640) (-861 87065) (gamma 82263 cdr) (92293 17025) (item)) 90971 ((item 23206 60191 car 53895) (76184 22645 baz) 35993 3187) 77101) (((2391 35989 lambda 75440 count 34239) beta (x lambda) foo (bar car) (x 56191 91247)) bar (bar (97012 item) (y 27108 count 95878 cdr) (cdr) (80803 56007 7845 delta z 9000) 37597) ((18520 9892 26087 57779 foo alpha) (10612) baz (95591 z y 71204 delta 80334) (41291)) (beta (17719)) baz) ((alpha (item foo)) (56287 (delta 18764 car z 50366) (count 88555 16913 18325 cdr beta))) (((55892) (73171 98647 54014 46348 59099 39034) (car beta lambda)) ((y 75310) (62766 alpha count) 5946 baz) ((beta gamma 95163 alpha bar)) (x 12885 (10398 73838 car count 8727 91546)) ((bar)) (delta (z alpha 24213 12765 delta) (71109 93145 delta) z delta 98688)) ((37063 99008 (y) (27209 76909 18573 83881 49425 71852) (541 92315 78817 40249 bar bar) (20371 99621 52999)) foo)) (((94893 (970 z 89092 31552 81252 gamma) (16540 76248 lambda 86271 lambda car))) (((alpha 11151 44163 90526)) (car (69667 45447 z y) 51553 (delta delta) 23326)))) 74668 ((((97402 61207 16537 (bar) (40970 foo)) (delta (65781 lambda alpha item 94154) (lambda bar alpha bar) (70693 90448 lambda z cdr alpha) (5957)) ((count 93058 18801) alpha (delta) (55786 20477 36098 alpha 12764 bar)) ((z) (z foo x y 13827) (gamma baz 53200 gamma item 33354) (10727 95418 78064 x beta y)) 19182))))
+'((((((80028 58856 78232) (83985) (71518) (46029 x alpha))) (((53621) 61335) foo 96556) (((cdr cdr z 62948) 93227 baz 97170) ((x 12664 59837 17346)) ((57670) (1791) 74995)) (((62115 23334) (14887) count cdr) (94833 (31400 x) (baz) (68491 51672 76175 94770 cdr 84283)) (baz (y) 94263 (count) beta) (99287 (82786 foo) alpha)) (((17860 y) (lambda 83014 83827 21812 z) (91797 43770) (93467 86756 10693 y 7816) (count 23635 cdr alpha 48898)) count ((57087 count 65528) (57929 5930 x 51964) (item) (48671) (6653 gamma 48539 2613 y)) ((72007) y (47560 item 66661) (75138 69299) foo (77623 x car count)) (7501 (56760 delta 77789 item) y)) bar)) ((x 83606 (((lambda) (30646 95533) (36605 baz baz count 41414 beta)))) ((84550 ((53311 lambda lambda lambda 9110) (x delta) 61282)) (10613 ((z 41974 82683) (car 73292) (64513 49682)) alpha 82006) delta (z ((63218 77188 68555 33460 7882 20251) (lambda item) (95493 cdr y cdr 88154 alpha) (alpha lambda 86625 car) (7804 75028 count 40692) (56455 baz z 84444 459 45585)) z) (25071 ((foo 13659) x (34884 car beta z car lambda) 31930 (lambda beta foo)) ((57066) (54212 baz gamma item) (car) (41147))) beta) ((((14930 42459 38820 44284) 78600) 86811 ((69849 z z baz)) ((46367 39574 y 71984 94178 alpha) (36180 79627 baz 72222 lambda) (z beta)) ((beta 74874) (25802 8714 45326 62554) (89326 gamma y 51019 baz))) ((15690 (4115 baz delta 88347) (gamma) (baz z car z delta)) ((alpha count) (43750 x) item (1806) (count car 27253 60544 28389 24145)) (15875 (54149 32413 count 45757 cdr) alpha z (item bar foo lambda 91034) (84377 beta 63244 alpha baz item)) ((51676 alpha 90075 beta delta item)))) ((car) ((42971 z) beta) (((23708 foo cdr y 57871 43837) count (38483) (beta y 23928) 60774 (y foo 73112 bar)) ((car lambda 78833 z bar z) (beta 46513) (35381 car 17888 foo 37876 count)) z 17169 9904) ((98480 (cdr bar beta 37616) z (98429) (x -987 z delta gamma z) (342 alpha 40041)) ((x x) (12368 12184 item lambda y) (66087 80240) (21207 car 79593 31270) (90036 37054 foo lambda)) (car (51443 baz) (item 74929) z (46676 79877 count cdr 91594) (2611 11129 car 67184))) car (((43633 84591 78703 item beta count)) ((z 69788 x 70354 68200) 40519))) 99108 37273) (((((50665 1380 11324 76854) (y 1795 85905) 53341 32907) ((item gamma 90692 y 10708 beta) (foo) y 49353 (56743) y) beta 65410) ((item)) (81428 ((21394 item 48802 43202 car delta) (36465 cdr) z (y y 62414)))) ((((bar) (88506 bar car delta car 66689) 13707 (278 53755 61223)) gamma z ((62548 item 96496 54325) (y 74020 21567 delta) (car 46417 item 76388 37359) (18349 20322 delta 79288) (baz) (x 18234 81176))) (90472 ((count) 38780) 47427 37472 car)) ((56022 ((61155 98410) 82742 77549 (gamma 32424)) y 19442) (((count lambda baz 5811 alpha cdr) (car gamma bar) (89957 z 82765 -193)) ((bar 45319) (77994 item 79296 92862) (lambda 97905 63497) 69144)) ((alpha (25675 51933 92258 alpha y lambda) (72124 delta)) (y (75982 65649) (63095 alpha foo beta gamma count) (count 4875 11599 x 51853)) foo 62441)) cdr ((((48078 76207 16343 item) (14299) (item 55141 item) (alpha) (27138 56678 81214) cdr) ((count 36215 z 34178 x delta)) gamma (car (car gamma x lambda x z) (cdr 16326 51732 car) (11382 beta 578 90691 cdr)))) gamma) 97984)
+'(((((y (77501 86186) alpha (45203 28728 85703) (91346 gamma 66752 35784 item) baz) foo 14124 ((cdr bar count) (2735 932 83762 11637 41242 19693))) z (((52010)) ((87535 85063 gamma gamma) baz 83522 97909) delta ((8371 46340 10565 item baz) (63764) (33720 count y 63113 69457 86606) 84272)) delta)))
+'(((((62993 count (65053 item foo) 72987) ((7755 91457 alpha y 14656 cdr) car bar (20050 count 10498 78518 82182)) ((43110 73947 car baz 91337 bar) (2118 88903 item 37713 85928) (beta gamma 32340) item (33409 lambda)) ((bar lambda 47571) (baz 72868) (8229) 60003 (cdr)) car) (((car count alpha) (car z item 55234 x z)) ((63837 x alpha z)) 34446 y ((30272 8990 baz -573) (beta 47087 car 9668 45331 z) (bar 86770 54006 91199) (beta) (cdr count 21625 87972) baz) ((82940 36365 30723 delta car) item (z 50497 z 7795 25202 1759) (gamma) 86485 92531)) (y ((87388 69298 80294) (beta delta delta z z x) (delta 57733 56822 cdr) (40644 delta cdr 50637 item y) (car 17363) (42051 delta 88056 alpha 52526 cdr))) x (71321) 81650) ((83675 ((delta 90951) (77018 95698 x 63984 69258 delta) (gamma 64592 gamma 4474 14749 75576) (74791 91942) (58279 78024 84618 83892 count foo) (z 22265 beta 72089 42869)) 78473 97327 (baz bar 21338 (item lambda 29172 1868)))) ((((count lambda 11034) lambda)) (((61405)) ((83175 9785 98463 6244 z)) (18500 (-703 12547 delta) (baz 24581) (delta alpha) (alpha 29603)) ((93522 beta lambda 81236))) ((63526 (71130) (foo bar 73854 x 64530) (3214 y lambda 2478 71296 x)) 9890 ((95978 63214 lambda) foo (cdr gamma baz lambda alpha)) 98805 ((foo baz) (baz alpha 97041 baz count) (57322 gamma 72010 68013) 65067) ((car cdr gamma 22188 count 16479) (gamma y) (bar 76766 78318 76260 bar))) (26723 ((gamma car 35879) (59437 88583 lambda 720 beta cdr) (80785))) ((28654 (car x) 30258 (96638) (baz) (alpha baz car 12748 32481)) 87247 (bar (baz 10619 30969 80979) 29120 (gamma) (cdr delta count lambda) car) ((26842 alpha 14311 55416 2600 item) (alpha 67625 gamma 61054) (delta delta z bar 81095 820) (21770 71994 alpha 76509 488) (bar 75902 gamma 8867)) (lambda (50935) lambda 11919) ((47472 40282 delta 16503 lambda) 74430 (89846)))) ((((alpha 94609 64854 27255 y) 37879 93986) ((y) (item delta 20055 60855)) 65099 (97668 (11453 y 9177 car lambda) (7903) 30071 (28845 26087) 43049))) 41376) 1471 ((car (((17517 25941) cdr (x 26480 count) (12943 beta) (95955 alpha 61876 foo 54812 14123)) ((12493 90513 29504 16632 8129) (49618 12206 x 47729 gamma item) (x 505) baz (y 23910 16433)) beta ((12483 6286 gamma 74446 x 82069) (36134 delta 2012 count 67310)) ((20177 3668 delta z 64349) (64788 baz 85499 bar) (38795 24852 foo 88496 x) (y 71883 beta) (baz) (16816 97166 lambda alpha alpha)) (beta)) (82122 lambda ((car 93048) (79030 66460 baz 2795 bar baz) (x 31179) (z 67531 z) (11503 70978 23626 bar 45765))) (((foo) 63406 baz (alpha x cdr car bar lambda) (bar 60880 bar item 35127 8118)) ((alpha foo x 97303) (42330 car 62446) (72008 z foo)) ((car delta 38175) 25683 baz (62858) beta)) (delta count y ((16500 35449 49849 76211 59474 cdr) (34373 foo 43950 z 73525) 72156)) ((89292) 29039)) (alpha (((gamma) (delta) 82494 (foo z 77029) alpha)) beta (10976 ((foo 7020) 44335 (lambda 71687 87042)) 96490 ((30167) 60312 (85686 car) bar) ((41315 delta x beta 68486) (baz 70354 12122) (54004 lambda 20026 15379 lambda) car (lambda 89712 count baz 57256) (79224 item)) (item (alpha 73240 cdr x) 91155 (72789 79245 10931 z 34249) (foo) (z car 30553 26614 delta 73571))) (35490)) (y x (22534 (car 9235 88771 65464 (19928 foo)) 60455 cdr) (((y baz 50679)) ((y 24318 79997 78788 25950 gamma)) ((x) 98826 (89667 item) 26165) 24323 count ((26485 x 15456) (lambda baz) (car bar bar) 48571 (count 25261 car 41833))) alpha) 22656))
+'((((99598 ((cdr delta 74546 z lambda alpha) (y cdr 51502 75923) 67188 (61886 42651 alpha) (foo bar y 90404 53690 11958)) 3974 (58205 (357 50338 76432 gamma) (73693) car) (14479 item (44934 52859 delta 78366 11739) (delta 74153) 30585)) ((gamma (49998 delta 39296 item)) (40721 (x beta item 63550 87463 28120)) (baz (baz 17333 43761 1307 82557 item) (item 64218 count) (10760 gamma 2787)) ((98842 baz -960 62398 item z) (foo 95718)) (z (42884 49132)) ((65807 gamma 84093 33214) foo 4417 (beta) (item) 5693))) ((18109) ((delta 40945 (delta foo 46070 3342 cdr) (17597 alpha) (70489))) ((cdr (64849) x) cdr 46558 70271) (((baz x z 28172 18265 x) (40504 82601 17548 car cdr 15945) bar (97149 25332 30544 y) (beta count gamma alpha)) ((47890 67495) (beta item count) (item delta foo lambda cdr 46173) alpha gamma) (17921 (delta)) item) ((14063 (69804 76662 69615 66212 94013 49985)))) ((((car 89793 y bar))) (z ((gamma count y 3900 30785 20249) (14819 count cdr lambda bar car) (lambda count) item car) 53748 (67 (car 7471 44774) (15531) delta (93906 11444 83963 lambda 68570 z) (54309)) ((gamma 51214 x 34204) 38120 (delta cdr car) (cdr) (lambda))) (51451 25154 ((30316 2192) foo) ((delta) bar (98696 baz 75265 31736 16408 40535))) (((gamma 18640 35028 32498 count) (delta) (beta 99295 36458))) 86185) z ((((y 20608) y)) car 69792 (((4223) (item) cdr) (y) 25242)) 9070))
+'((((((alpha cdr count 14350 17287 36905) (z))))) ((car) (33983) ((((alpha) (50618 bar delta 39716 50135)) z ((43061 76968 alpha 94934 gamma) (50350 74946) (74203 59182 gamma foo 42141) 6877 (cdr alpha) (y)) (lambda)) (((90374)) ((delta)) car) gamma) (((2567 foo (beta 60522 cdr gamma) (beta car gamma 15004) (car 19781 36711 17251))) (((27908 bar 4143 1551 x 32543) x (66414 delta count) (y 51620 51403 gamma 23685 99754) foo (58038 73445)) (96217 (60026 z lambda 42075 baz) (item 30249 74782) (lambda lambda 68892)) ((99279 99723 28992 car) (64155 3216 92997 alpha) (20025 96834) (85633 80613) (98626 38256 20481 count cdr)) ((86150 cdr 46408))) (95982))))
+'(z lambda 25644 ((((26505 72448 63860 (36688) (71657 64674 beta beta y car)) ((26635 83721 99616) 35735 (10933) (gamma) (gamma)) ((21244 beta) (count lambda 42258 item 71888 cdr) (13040 foo count 28290 car) item (lambda x baz z)) 26996) (((41294 75887 60494 cdr foo) baz (57757) 34620 y) ((16255 51452 count 59172 50462) (item baz 36515) (baz 93834 item lambda lambda) (21711 x count 24917) y (z 69524 99235 91285 cdr)) ((item x 47346 84352 z 32612) cdr (lambda 54102 34966 84329 delta 9863) (35378 gamma item 41471) (17138)) ((z 11864 63656) (baz gamma) item (count baz 37826)))) (((item (70528 38857 36600 count beta) (beta)) ((90733 23649 alpha 36769 34375 2964) (6054 gamma 5969 48986 lambda count) 23827) 25255 ((16548 cdr count foo lambda 27406)) ((2956 44220 80282 31906 x) (62411) lambda 84263 (82981 x))) (((y beta cdr foo) (cdr 20076 y 4775 76038 beta)) ((beta 15301) 11512 (47822 11933 x 54686 lambda) gamma 5011) ((lambda 39133 car beta alpha)) 12116 ((96806 64491 x gamma) (baz 35831 98731 46811 43177 44711) 8019 (66977 gamma baz -336 69229 cdr)) ((z 8073 54799 17579) (y 71470) 83263 56991 x (delta z 81448 gamma 89840))) (lambda ((foo alpha 50345 35369 z) (car gamma) (item count beta) 45723 (lambda car alpha 30360 36321 lambda) (z 88254 lambda z 50768)) ((44661 80879 56544 32284)) ((beta x)) ((93924 baz item) (beta) (39177 car 86966) (31091 bar baz) (768 38635 alpha)) ((delta 31879 64969 86640 76188) (count 44747 lambda) 55203 389)) (58851 ((77531)) beta) (((lambda 7113)) y ((15987 item lambda 1256) 10334 alpha (1899 95183 z)) cdr (45138 (bar x alpha 77716 foo)) (31855 75207 79561))) car (52779 (((1155 cdr car 63887) (cdr 34279 car 88664) 19620 35279 (bar cdr foo)) (20924 (42297 gamma) 18000 (car 39674 lambda 69430 car car)) ((x)) ((81944 30760 bar 50890 4383) (12919 49181 47298) (13283) beta (65378 bar 55905 69752 96484 alpha) (baz bar 57786))) ((87868 x (x 9629)) (42943 (16941 y 71631 y 85630) 39302 (x) (cdr baz count 12320))) (((50492)) car (count baz (beta count 36741 88620 79721) (car y) (bar baz z) (delta 7011 94726 86137 3250)) (foo (cdr 56077) (cdr)) 60048 ((87734 1007) (beta cdr) (76561)))) ((((96826) 11306 alpha 97403 z (alpha))) z (((lambda car)) x ((foo 23462 count 74186 44155 13929) (x lambda car)) 43723 (cdr (31884 cdr baz 37396 lambda) (gamma x alpha beta 54109)))) ((((26879 7257)) (64344 98276 (bar) (alpha 1479 item))) (x x ((32344 30326 89525 delta x 8118) (bar 46523 delta) (8667 count 81211 y 36287 baz))) ((31322 (18118 6633 car) (delta baz 20905 10597 54362) (cdr car item z 65111 car) beta (35156)) ((beta 56403 z) 28868 cdr foo (count z 42544)) ((count) (85545 92655 foo alpha 30082 y) 55511 32013 (z 98551 66906 count 21858) bar) ((y car 17091 34583 62468 car) beta gamma)) (((68485 cdr count alpha)) 73981 (baz (96886 46473 19054 gamma) lambda (beta 75868 gamma 69698 x) 90070 (69245 61118 98496)) (beta (car 67608 88056) (45133 63512 beta 2530 foo) (82935))) (((gamma 42276 54718 car) (y foo 57439 bar) (96540 alpha baz 78905 96112)) (count (y) (42482 car item -251 1290) 22152) (18566 (y beta bar count 74197 bar) (28435 alpha 64808) lambda) cdr 1179))) 64850 (9890 (count foo (bar alpha ((50520) alpha (50104 84479 beta 22686 76135) 47667) ((12601 bar beta foo) (-253)))) (gamma ((39120) ((15136 car) (foo 59295) 97913 (alpha) (5827 8517 66107 1340 39961 91688)) 7989 ((count 62172) (delta 68124 89068) (foo alpha 3131 75507 beta))) y (52872 ((4471) (86062) (item lambda 48865 17658 item 63635) 13809) baz ((50417 90884 y alpha cdr 3865) (24879 foo) (22342 beta 64759 786 91450) (car count) (y 48353 45087 12730) (lambda 335 delta 15835 77385 x))))))
+'(z ((y (((48529 12269) car) ((item bar) count 42107 (baz 40848)) bar car 84921 23927) 81000) y ((((60990 31530) (15295 baz) 56911 (z 80765)) (39691 count (car 6614) (baz delta cdr 90214 gamma gamma) 90256)) ((z) ((83425 36674 item 59488) (alpha) (lambda 631 77701 94205) (74254) 86821) car) (26428 (50304 (91693 beta 12566 cdr 43393 8120) (36481 55894 baz count foo 45586) count (alpha 58836 28287 6363 beta) (lambda 92931 87672 bar x item)) x ((count 75319 26733 cdr 18830 74363) (-852 74195 44086)) ((lambda) (alpha z)) (31458 (47294 y) (gamma 70801 x foo) (alpha 3910 45332) (gamma))) ((89467 (55456 car foo) (item 74961 z z 42197 z) (30686 delta) (81443 10806 count alpha) car)) ((x 76679 (4367 lambda 85226 baz item) (z count 52511 67848 86984 364) beta) (z (delta 39245 count item 54768 23412) (foo alpha) 36433 (17862 z alpha item count)))) ((53223 ((y 84386) (85540 70391 65218 y) count (alpha 42928 beta) (70085 delta car))) (((baz 26518 76173 beta 72253) (89704 85831 25171 delta)) ((30749 85634 x foo z) (item count count 79687 foo) (bar 13508 11414 gamma item) 25682 (80548 99073 59418) (z gamma 23584 70453))) 9475 (((17178 alpha) 87376 (cdr 26258 y)) ((2037 cdr)) ((car 72609) (42737 5833 gamma) (item 55992 97807 36322)) ((73694 39838 count 79827 7218) (76131 64715 60102) 64753 (item foo 44486 gamma alpha)) 47425) 87720 ((car (7386 z x) (y 79536 cdr) (baz 49010 17408 87970))))) (baz ((((bar y)) ((lambda item y foo) z) ((61923) (72529 33157 74826 foo 6757) (bar 38506 beta) delta) ((cdr count x baz) (lambda 68274 5995 79891) cdr beta) ((63996))) ((58177 (84969 99879 57739 alpha gamma baz)) 6032 ((88687 46975 alpha) (gamma cdr 43151 item 62123 61106) (beta 47871 68746 6369)))) ((((25053 69177) alpha (64350 count lambda) 52770 (car delta 11707 32667 cdr) (bar 58386 lambda delta 55135))) (foo) (((lambda 48885 delta)) ((78855 41056 86787 beta 17494)) (1632 (bar alpha) (36273 car baz) (bar) (lambda 18382 89798) y) ((delta y cdr 76927 20673 65494) (z) (foo foo z alpha count) (79805 foo gamma 28349) (count -687 13161 64932 49165 y))) (((y z)) (bar) ((63573 cdr) 56380 z (x 22477 lambda cdr 54752 bar) (58972 item 88933)))) ((((41542) (59921 36189 69494 42661 baz) car 14698 (13870 z x) (12827 count 81775 delta)) 28443 (10470 (8252 66278 z baz) (gamma baz 38064)) ((23102 car 61771) x (lambda 78398 23248)) ((10345 7646 delta lambda 59957) beta (-968 gamma))) (((z 75663 74702 bar 11667) count (20735 49530 z bar 65461) (count 45495 z 66076 y z) bar (16591)) z alpha) (((z 61911) 20302 gamma (bar 35824) (91025 94987 x)) 51742 gamma) (beta ((981) (54981 96391 85260 foo y) (bar) 76013 (55999 6862 cdr beta 64554 beta) (delta)) ((item y car car) (78721) (35360 count 60646 97629 bar cdr))) (gamma (25421) x alpha ((62890 68491 y 37000) (item) (66331 count)))) bar) ((((x (x) (cdr 97706 z 48801 51753) foo item) ((75206 249 77279) (69575 gamma count 70531 21141) (alpha 36547 30140 y alpha) (foo 42421 88717 cdr x 19869) (item))) bar (97008 ((item 26889 5435 baz 96135) 51946 lambda (y 38156 31118 baz beta 24535) (26886 lambda 47180 beta) 97931)) (((24431 car 20213) (74735 gamma 83686 1244 6648 count)) ((alpha 76918 88952 beta) (car foo alpha) (lambda 64214 z 40765) (19554 baz bar) beta (80172 lambda 71292 x 94780)) (28442 (z) (count 14392) item (95388 x lambda y 4759) (beta 79656 23532 item cdr 54915)) ((25243) lambda alpha) ((19928 5997 foo) (baz count 48878 94256 cdr) (8947 delta z) (bar 56138 item 77672) bar)) (((30817 53811 delta car)) 17876 ((19204 item lambda baz 60915)))) ((((25473 alpha lambda 44278) (21227 9960 car gamma 96429) y (lambda 90706 foo car y) (67868 count 81287) baz) ((y 42487 33580 y item) (15343 81304) (delta lambda cdr z z 98136)) ((cdr) (27460) cdr (car z 84293 delta 19070 item) (83693 bar) (lambda))) (((45776 lambda) (car) (bar 2930) bar (car)) 98969 ((cdr) (gamma 37839) (24260 lambda beta z z lambda) (93766 lambda 99085 lambda) (z 12703 72828 -728 y gamma)) car) (((36843 58054) (cdr 60445 29734 cdr 14298 alpha) 20155)) foo 35383 4727) delta))
+'(((96933) bar ((((81273 10787 y 9978 24904 gamma) (alpha) (z 51740 2508 27533 item) (16826 alpha 2524) (car 25975 bar)) ((57538 96067) (bar 31661 y) bar (17234 baz bar car 48049) 63490 55190) delta ((delta 42287 79185 car y)) ((y) (45490 car delta 93640) (x 170 y) 36509)) 46031 count (((car 81002 foo) (49758 84551) bar)) (((car 24123 baz 80854) (49518) (74503 delta 22366 cdr) (beta 85369 79812 cdr 81941 65064) 63012) beta ((14554) (car) (gamma)) ((item) (cdr alpha) (56451 56417))) 70981) (6974 ((z (item) lambda (alpha 70896 33158 alpha 91882)) 73629 (74496 (721 91951) (54776 29636 54536 44760 count foo) (baz 49268 90386 66533)) ((88235 18157) (car lambda 93068 bar) (delta beta 13633) 55387 (y cdr))) 41374 foo (60136 foo ((bar 29922 16664 bar)) 4961 ((alpha z car foo cdr 6034)) ((item) (count) (alpha) (z z 33500 42302))))) (((((baz 40618 cdr -575 foo 6656) (lambda y gamma 84005 93517 item) 24935 (foo 11754) lambda (8954 bar)) (gamma count (14129) (91626)) ((32594 59312 62274 42605 lambda) (2992 68598 lambda y baz) (car lambda 62293)) ((50065 cdr 56202 72407) (2716 lambda baz 923 item) foo (y gamma z bar bar 56405) (bar 91972 foo 93284))) (((gamma x) (cdr 78533 gamma alpha 44255 23128) (bar) (gamma 30721 z) 49855))) 81630) car (((((59750 item 80306 54164 z 84237) (26566 alpha count) (52885) (y)) y -174 ((cdr beta) 71154)) (((39561) 64378 bar (cdr 98098 x 94029 64169 19539) (23163 alpha 46994 48328 95244) (z delta car 25266 30548 cdr))) (((z lambda baz y 52023) (43293)) ((car 46409 foo 61660 delta) (item) (65262 cdr) x (baz gamma) (81429 bar 89452)) (3808 (88237 lambda) (item 43296) (baz)) 74764 bar ((count 78172 baz 18281 89379 lambda) 49629 47628 (z 62424) 48810))) (92702) (((33429 (76020 car 29238 73684 41953)) ((58900 11838 cdr 52793)) ((49843 10670 beta) (baz) (delta cdr delta 88386 y 61500) (58684 26436 cdr x count) (bar 25081 z)) ((78727 85649 27162 lambda 84219) 74432 5317 bar (86901 item item 33273 82143) (bar cdr 69579)) ((62131) alpha beta (75185 lambda 23084 lambda alpha))) ((15844 lambda beta (79950 39294 baz 78719 x 29887) beta (4696 20984 delta 23673)) x ((alpha 4103 foo 69909) (92193 y) car (62763 78101 42237 cdr) (57523) (item 48754 cdr))) (count ((beta 48766 51443 83482 6868) z (12047 83759 gamma count delta cdr)) cdr x (33381 (cdr beta lambda) (gamma 79319 47085 cdr) (89901 98233 72445 item)) ((baz baz delta 11464 71590) (cdr 98164 cdr) (alpha beta y 40123 12641 62058) (delta 40632 baz lambda) (cdr))) ((delta (x 41212 foo gamma) (29796 92572 87172 alpha 76538) (28011 foo bar 31511 z alpha) (cdr 97389 22835)) 7187) (lambda) (((5635 93478 car) (99290 delta foo)) ((gamma)) ((bar 69916 94717) (63747 80659 95058) (delta 55724 76623)) ((y cdr z 91799 40181 bar)) ((81923 18059 foo x baz) (60473 z) (lambda 31874 656 13067 59782 39192) (333 60190) (49502 53610 30255 95978 95669 delta) beta))) ((((2169 30742 92650 86458)) 2489 ((gamma 54597 989) (car -638 count) (45646) (5448 y 81677 23492 17567 gamma) (24919)) z (51921 (8433 14028 y 51881 car 79582) (67906 y 89973 37087 43338 x) foo) 43185) y)) delta)
+'((52009 car ((beta ((62506 bar 6994)) (23818 (55977 item 96521 foo) (28791 item 52340) (lambda 93260) (83366 26226 61623 alpha) (bar delta 95660 46566 delta)) (72808 50229 (44952) (item 53497 93848) (y) 27788) (32556)) (((alpha 43875 41391 beta) (bar 4507 bar z 49456 count) (16474 54478 cdr 55473)) 58159 (57292 (count alpha 49414 59442 gamma) delta) delta))) (((((baz 62601 x)) (z (foo alpha 16999)) lambda ((beta) (gamma) delta) ((item baz) baz (lambda 83382 5355 alpha) (cdr z 59638 62241)) 38623) ((22529 (gamma delta)) ((35332 94258) (bar cdr 7446) (x gamma) (19279)) ((item) (bar bar foo) (alpha 11792 61106 8415))) (((36753) (87827 z 25372 lambda) (44517 35187 29912 count 60786) item (y item) (beta)) ((z car foo 45457) (4324 foo 45972) bar (foo 12848) (2835 delta) 51227) (69041 (foo item 92115 beta 3706) (gamma) 81925) ((alpha count) (gamma) (y 62146 16952) (alpha gamma) (54719 54696 beta 65661 bar 53446))) x (((cdr beta beta) (baz) (foo -551 61924 85123 29374) (z 56806 22298 car 35598)) cdr ((bar 59572 2854 65519) (x cdr 2467 baz) (z) (89544 delta y) (alpha 61597 39984) bar) (delta (54538) (lambda bar item 92040 49533))) (((18849 94175) (56730 item 6184 lambda 1116)) ((11716 95636 x) (z 55421 61776 54505) (bar beta 15166 alpha) baz) ((15618) baz (59979) (item bar count foo count 71024)) (97804) ((24459 car 24764 24498 y 57674)))) count (((alpha (car 33013 49721 z 55028) (14104 item 83874) (bar x 76477 39421 22811) 52091 (5663)) ((81183 z cdr lambda)) ((alpha 68921 bar delta) (item) (alpha 58557 item)) 59452 ((77772 54680 baz alpha) (count 83742 x item delta)) ((38987 baz 52248 bar) (23931 17305 foo))) (((89918) 70053 77258) ((36301)) ((19004 z lambda 20443) (31270 count) (42968 -212 item x 42568) (94094 42441 27079 48552) (count) (alpha)) ((70544 lambda) (46458 51753 lambda 1267)) ((-682 foo 91750)) ((42632) (alpha item foo beta) (7568 2465 80796) x baz (60078 23462 68487))) ((z (gamma 45788 19959)) ((car baz 1490) (-551 x 89735 item car) count (gamma 5189 961) 16307) foo 74613 ((gamma y bar baz count 48051) 70515) ((cdr 92756) (96052 y item 45739 gamma) (item 36852 bar alpha 95372 64250))) (((car))) (((beta 20618 x) (29978 z alpha 16276 z) (77266 90343 744 88585 52616) 88457 (delta 55800 item)) ((89937 2525)) beta count)) 1634 ((((y) 64872)) (((63765 58731) -112 (92744 38227)) ((item 2651 85206 baz 37570 96577)) ((47981 x) item (foo 19770 91114) 77924 (24118 x 51335 lambda 97776 x)) cdr (beta cdr (32386 foo) (39794 66744) (26241 alpha foo 69003 29433) (delta item 75796 7149)) ((55107 58738 71135) (88185 car baz 22538) (37066 bar 81516) (54670 73535 54553 18503 52324 18037) (foo x lambda lambda 55101))) x 61605)) ((delta (((y gamma) (baz car gamma) (48941 bar y gamma y)) 70324 ((count x 44736 delta cdr x)) ((lambda y) (lambda bar 84513) count (alpha y foo 19211 85800 cdr)) ((34333 bar y 56455 94909 20511) alpha (cdr count cdr alpha 13552) (x 31684 25868 cdr 28908 64966) lambda 81250)) (78993 (58535 (cdr count) (34208)) (47481) (x)) 9328 x) (((10171 (61093 beta) item)) (beta ((cdr bar 91701) (40553 18812 99929 baz) (37023) (gamma)) ((item)) (cdr (20517 count x 8054) (car 86120 lambda 22922) car) ((13740 -107 31952 15342) 65928 y (count 94209 z beta y) 92821 (alpha delta foo 67990))) ((x beta (gamma) (47987 97596 39163 39329 bar) 43211 (beta z 64900 65658 72267 51650)) 60060 46745 66130 ((cdr 67547 9073 alpha 14739))) 91524) 57838 ((83778 ((40195 y 44585 41936) gamma (20823 y) alpha count) gamma ((count z cdr) (lambda car 81104 61927 beta alpha) (item item 32910) (baz bar 37207) (69726 car) (car 21196)) count 57205) (((y 21545 beta item beta) (delta) (22334 59366 47356) (x)) 25891 ((93863 alpha delta car))) (((3284) (14772 delta 82527 alpha delta) (lambda) 9053)) (((82092 21065 68713 alpha) (60482 16082 38358 72613 cdr) 84313 (29413 57900 11606 25617)) ((item 87951 79304 count 13626 33919) (92871 2543) (item lambda cdr count 82868 beta) (35108) (y y foo 50212 48850 79757))) (2175) 47655) ((car ((bar) (9692)) (alpha (52725 y lambda 16910 41633 79241))) cdr) ((((foo 73419 foo beta 62463) (10942 63006 delta alpha) 37030) ((1777 gamma cdr) lambda (y bar 84490 99654 gamma) (36212 60614 17233 y 72949) alpha) 686) (24936 (z (39907 11914 64904))) ((98277 (63586 14839 74451 81563 count baz)) y ((22811 58753 99383 baz beta) (21475 620) 142 (beta 52416 90792) (x alpha y 17191 99421)) 76614 55667 ((count) (87160 85532 delta 2403 62899) (foo alpha 89978 60333 12963) (item car delta 31797 item) (1154 cdr 88553))) 17319 foo)) (5014 count ((-817 ((lambda gamma) count (gamma 92862) 58018 (y car 54733 delta) (gamma 25804 74871)) (lambda (beta lambda y) (z foo 67597 x 29284) (25196 z) (65182 alpha 33364 gamma)) 68464 ((delta gamma)) ((18462 29597 74906 alpha 43532 x))) ((baz (21139 bar 68789 bar gamma alpha) (count x)) ((9103 1252) (z gamma gamma 6090 30202) z) ((36154 count) cdr))) (79303 (((37186 53639 2507 beta) (61198 16936 beta 15204 88731 82808) (foo) 25405 (62015) foo) ((49038) (x) (beta))) ((cdr (car 75476)) ((93371 40408 43738 75427) 32545 (x)) (beta)) ((bar (alpha cdr) 22303 (56340 z 37634 31732 90575) 48327 (33299 foo count item 98686 count)) 43651 (lambda (bar)) ((foo) 45220 (alpha gamma 12442) (bar cdr)) ((alpha x 45348 79990 gamma) (62115) 77773 (alpha 62118 cdr x 24820 x) (21555) x) ((car bar 85853 bar))) (count ((88801 29255 15193 beta)) ((4374 x 64596 y) (45622 16207) 70145 (bar delta z 51725) (foo) (bar baz lambda bar car)) ((64159 48023 90337) (cdr)) (y y (baz 65233 car 34156) (74046 baz baz 63947 x 72479) (59725 40289 beta 43711 25141)) ((73743 bar y z) 15456 (x car 91952 62605 y) (count) (gamma beta alpha count 85629) (90836 bar 27356))) (((delta 5464 1094 42674 90261 car)) 75555 ((foo x gamma 42710) (4944 gamma x gamma) (cdr) foo (46511 bar 29056 count item 95993)) ((41469 73225 bar)) (y (gamma item) (98284 beta count 13214 beta)))) 38588 ((((37416 count 90580 alpha beta) (item car) (3128 57022) (alpha car 62749 13551)) (cdr (34881 delta z 70516))) (((cdr alpha) (20381) z (45111) (z lambda) count)) ((47891 (beta 89556 cdr) (car count baz baz 43092) (-297 cdr 70809 count) (foo 23495 17545 baz 51374)) ((gamma) 94484 x (1571 76555 25686) item) ((81506 cdr 61204 31858) 31346 (47271)) lambda (94192 83008 (80394 96180 54111 bar) (lambda lambda 61162 82007 y bar) (45655 count item baz) (alpha count z alpha count car))) (((car) (count 28020 gamma) (14072 foo foo delta 20412) beta (47875 4005 60678 94952))) (((55648 alpha z y) (28576 car 66328 26701) (item) (alpha) (22056 41002 74522 baz 91764)) ((car z 96373 alpha foo 82264) (71944 14846 car 23045 item 97591) z (56717 delta 6657 count) (y) (y gamma)) ((10461 beta 81970) bar (bar) (count 70466 81155 14543) 40558)) (((item 98438 baz delta 4941 item) (99278 z delta 24327 87125) (gamma 35991) 47761 z baz) ((63774 car alpha 36981 x) (70275 58954 16272 car x 1995) (51267 alpha 17646 41295 y y) (38131 count 63262) (z 69480 beta count cdr)) ((2369 37931 1209 98212)) (baz)))) (46536 ((79375 ((gamma) (bar delta 94248) (y) baz) 55914) (((33143 79999 car) (cdr bar 26529 82081) z (count lambda baz 17853 84397) 87873) ((y 55270 52956 z) (38035 beta cdr beta 49598 72803) (count gamma cdr)) ((delta delta y) (1309 z foo cdr y gamma)) (foo (5914 45061 lambda delta 46259) (-500 baz 41993)) (cdr count (item 93203) (car) (gamma 834 beta) (18276 y count 59772 gamma 41894)))) (((63969 (alpha lambda z z y) (count) (lambda 49130 6362 42407 delta) (y y count) (x beta 7738 35297 beta)) ((beta count 68256 21540 gamma) (18597 78676 26790 78511 62290 14068) 39365 alpha) ((33931) (8167 44930) (39933 car 85059 delta 69874 bar) (z 21236 72158 z) (alpha foo) (55241 72541 23282 96663 69296)) (31847 19028 (68622 44664) (74479))) (((gamma y foo 56612 baz 46927) (58131 count) (y foo 90135)) ((foo beta 12335) (x 48446 82352 6057 item 23266) x 74059) (car) (delta) ((82200 x 6942 gamma alpha) (car 4010 78294 93270) (delta 49005 62851 44204 car) (item item)) (50015 80018 57606 (78317 count 60234 foo))) (15399) x) ((gamma ((alpha 63846 baz 44191) (54409 alpha x) (34759 car) (count 67133 foo z)) (59905 46167 (95778 84007 44924 beta bar 54807) 36225 (21574 53323 baz 88282) (69857)) ((69408 39919 baz) (15505 delta 38220) alpha))) (count)))
+'(48050 ((gamma ((x (lambda bar beta) delta (x y baz 32016)) ((beta 79702 97546 x 57482 19665) item (lambda x 97903) (41408)) ((11189 45023 20571 x)) (70053 (99873 x 22846) 56627)) (56603 ((39215 count 52134 35516 15354 car))) ((9211 (z 50280 baz 78081) (foo 91167 gamma lambda) (baz 31882 32298 lambda z) (alpha) 94635) ((21472) (38816) 81463 59682))) alpha 50102 delta) (((84325 (49146) ((67862 34983) (gamma 33181 baz 70259) 46270 x baz (x 35872 60886 baz 58214 z)) (beta 77249) 63402 ((y 28599 count 96758 count y) (car 60436 car 51611) (3233 47631 alpha) (bar 73269 9891 baz) (14896 38215) (gamma beta))) alpha) (15816 (beta 61250) delta (((73461 z gamma) baz) 27179)) 79489 bar baz) (57064) (((94018 ((foo) (bar baz lambda) 68711 (count z) (47115) (38787)) ((69151 bar 98588 79721 56443) (y 7630 40817 99279 bar z) (x 12) foo (baz) (delta)) bar ((lambda 72167) (15734 49866 alpha 77276) car)) (((beta) (70649 foo) (alpha bar cdr alpha beta))) (44234 car lambda y gamma) (((78488 x) (cdr) (alpha foo cdr lambda) (48214) (x) (x gamma gamma 15142)) 42880 ((alpha 19339 item y bar count)) (y (beta) 75540))) 89879 (((cdr)) (((99706 baz lambda beta 71757 cdr) (count alpha -957 54033 z 27542) (77261 bar) (53594 55047 lambda)) ((gamma beta foo x)) car 17702 (count (count 64442 70738 14150) bar 40483 59298) ((gamma count lambda 54918 9920) (38874 63017) (86876 13033) gamma)) (37937 ((70678 z) (gamma) (91261))) (item (foo (item 28506 car cdr 74597 item) (12184) count (beta baz 35463)) 54830 49013) (((65441 lambda 89620 23845 item y) gamma) ((car lambda 51631 16562 bar 4567) (65482 cdr 33157) (61507 44898))) (((x 51130) (86414 cdr 27465) (45177 baz) (y)) (19469 (alpha count 22247 car baz bar))))) (((9537 (34267) ((item) (87563 foo item 75557) (70080 alpha delta baz) (74560 beta 37605 item 50443) 82264) ((gamma y) gamma (63332 gamma 39515 72238 baz car) foo (x 96836 x) (gamma baz)) ((68549 count 42193 90826 98767) (43664 72164 53535 delta) z) ((item 87310 lambda 26234) 31998 11063)) gamma z (((item 69555) gamma 50786 (76012) alpha)))))
+'((z z (38591 (alpha (x (cdr 63853 67972 lambda) (y) 59690) ((55127) (21432 delta cdr) (lambda 95149)) ((count 77330 49049) (item x gamma 81400 71771 beta) (59370 81230 lambda) (foo 11904 x beta baz 35629) (gamma gamma 70395)) (item (1703 85700 6934) (85272 lambda cdr 73235) (74590 4195 cdr count)) lambda) z 33419 ((alpha (y 25389 count 48892 91156 27418) 45085 (8385) (21559 baz cdr)) ((38951 delta 49686 gamma) (38740 89496 55936 13943) (y 1473 63194 86386 88066) (51901 cdr count 48544 79155 item)) (96618 (64400) (27503 39616 11661)) ((36894 bar 2913) (beta 13009 lambda 29106) (car cdr x 17487 78411 bar)) ((delta) (baz z) (baz 6636 61983) (alpha))) (((z 57764 y 6513) (47745 x 91200 bar cdr item) (19123 beta)) (89063 (bar 71065 45360 car 52509) (31313 foo -487 7769 6888) (y beta gamma delta delta) (alpha) (24094 12532 lambda 66084)))) (((62381)) (15238 ((24257 72719 car 69132) 92523 (count 51995 53822) (57295) (92384 gamma) 77857) ((delta alpha bar item 85762 baz) 51882 (car) 74381 33337 65779) ((85846 car y 65799) (car 24819 73656 beta 51744 98284)) x) ((baz count (bar lambda 24679 39986 42877 69658) (79278 62001 car 51799 beta)) ((gamma 91402) (alpha 9874 x 30776 7484 foo) 45576) ((54370 y) (403 foo delta alpha lambda) 20430 (17460 z 71249 count 61498) (y gamma) (item 61979 36049 bar count))) 67852) item (-610)) item)
+'(((9112 (lambda ((55608 foo 23621 x 83066 alpha)) (64893 (64023 82738 74597 baz 23480 count) 97237 (50916 5314 30621 z 54923) (cdr count 59021 x x baz)) ((bar 96132 car 50866) 5902 -899 (gamma 65711 lambda) (-633 x 49458 72434)) 20217 ((61121 26732 count item) (84635 32037 count 55807 19024) cdr)))))
+'(delta (14116 26310 (35021 cdr foo (gamma baz 94629 64993) bar (((1265 21221) (delta delta 39749 car 5261) (x car 56565 z -94) (68517 8477 car lambda lambda))))) (38124 ((((80282 y 14287 49044) 73287 (z item 7809 91762 lambda) (gamma 32159 count car 68883 55866))) (y ((z) (86199 lambda 28720 89110) (delta) (2989 38733 item)) (bar (41395) (62810 delta cdr 54166 575) (88238 81777 91479 x 90923)) (92882 68875 27100 (bar z 85106 94940 42522 foo) x (y 38525 59490 97145)) 81507) (((35909 31364 z alpha 67239) (item)) item ((86 delta 22453 31759 51083 count) (gamma 88248 91576 lambda x) (item 43555) (foo)) ((99477 z 69805 14942) (746) (93936 53204 car 95387 98027 bar) alpha) lambda) (((item foo 93198 94191 97543 bar) (item count 54995 z x) (delta bar 89875 14574 90092) 25140 (baz alpha car alpha)) ((z 64031 beta) 34035 (y count)) x ((bar 95038 car 57385 x delta) (x beta 12530 54553)) ((29797 x beta) 8515 (9393)) bar) (((36773 foo)) ((29187 97648) (item 4569) (z 54917 26052 80014 72353 61767)) ((12032 lambda 90348 76407 18024) 46589 (car) beta)) (((foo 76405 y 45575 item 97198) (alpha bar delta 54276)) ((98042 gamma)) (lambda lambda) ((10567) y (gamma count 49153 cdr)) ((lambda) (71217 1506 69343 alpha 93265 68211) cdr (gamma) (y x 9942 car 47468)))) (14733 (((44339 item x) beta (foo cdr cdr 83265 8003 x) (74456 z lambda) (foo foo beta y count gamma) (cdr gamma 98478 bar 94202)) (25222 (z 75957)) 31344 ((count) (26131 cdr 22050 31769 beta) baz (y alpha 27667 8845) y (55830 gamma baz z))) 98188)))
+'((((95472 ((count 29067 26800 6239 24689) 18043 gamma)) (((car foo bar y) (z beta 57538 count z)) (71015 beta (56441 car 42734 lambda item car) (delta 58915) 34264 94254) ((cdr 14042 99829 94541) 95298 (foo x z) x) foo (y (cdr delta baz)) (19576 (foo 71766) 96508))) (25756)))
+'(car ((foo bar (((item bar bar 99105) (63597 car) (gamma 28530 gamma 16834 cdr cdr) (alpha count) 40881 (49843 -157 cdr delta)) x) (((alpha item cdr item 57748 63472) z (58169 87631 foo count 45201) (5801 67068 81210) (33588 53667 car 65256 foo 55101)) alpha 52230 ((19121 count bar) (car 33383) 27578) 67111 ((bar beta y 38495) (15806 item 52030))) ((31853 (y 70072 93359 car 58272 42648)) ((y) (foo) 92424 (cdr count foo delta) (cdr foo bar z foo) (73249 foo)) ((21994 lambda 10982 78701 64601 97941) 63341 (bar 45725)) 16565)) ((((84723 25409 x) (baz 48891 3968 z y 30763) (-602) 416 68189 1356) 75635 ((z z cdr bar foo x) (lambda 73968 22266 cdr gamma) (item 861 baz) (y 97380 z gamma delta))) x (y (count (cdr 83433 foo baz bar))) (((98468 x)) (11158 (item delta cdr 17742 24086 delta)) ((92444 33229 64213 89043 alpha foo) baz 46444 (beta 80309 82896 car) (11577)) 26766 beta delta) (((item count z 52643 -908) (foo x 84841 y delta item) (16779 25046 94040) (gamma foo bar 97011)) ((delta)) delta count) ((car (18972)))) ((((56406 734) (14059 y 36137) (foo 3349 lambda lambda car) (11917 baz 93956 count delta 94537) (98141 x -775 53802 lambda) foo) 57076 (count 7921) ((77140 4760 64766 5579 12089)) 63102 (count)) (96428 ((baz bar gamma y) 32518 (20708 51838 car) (y foo foo 85156 32213 39959))))) (((cdr ((lambda lambda) (56429 20736) item (55973 lambda beta foo alpha bar)) ((16787 13398 bar y) (16962 foo 43477 98089))) (49688 ((gamma beta alpha 57178) 29547 (x item 67071 12599 70599 -264))) (alpha (bar foo (98227 73720 alpha 36593 6810 x) (88083 count x)) ((car 98917 99409 beta) (90432 55473 gamma) (69023)) (88513 (car) (68550 8071) (28590 alpha cdr y count) (93982 bar -889 z item 44404)) gamma) (x) (((foo x count 37597 58535) item 2212) ((z car 72742 44630 26769 foo)) ((baz 75450 lambda 79975)) cdr ((baz 65650 alpha) y) 58838) (((41269 73271) (z car) count (car count) (z) (37252 gamma lambda 42619 bar)) (alpha delta) (20878 (9851 83728) (41012 y) (z 34584 baz 75498 lambda count) (item 12747 bar 72302 57570) (7538 89178 80370 69310)))) baz ((((alpha z)) ((99303 99008 count) 3976) ((delta 12809 69999 53544) (11485 7148 61521)) 98289 count ((21347 91822) (66864 cdr z car item 7254) delta))) 25611 (((delta (17923 54220 count)) (67915) ((8257 17761 21581 42879 z 82059))) (beta)) (z (cdr ((95890 38800 z 99808 5289 gamma) (20676 item) (lambda foo 32802))) (((car) (85064 z 17612 95707)) ((y count cdr beta lambda) beta (x 77240 lambda))) (((58296) (13601 32197 car 45204 baz 15817) (41126) (x))) ((87463 68976 (alpha car 58241) (69270 foo) (77968 y 21330 66174)) ((27729 51717 delta 84261 beta 61771) 78514 (foo cdr 20941 47760 1332 46602) (item delta 98782 z 96339 beta))))) ((delta (cdr y ((5087 alpha 72592) 74495 (33957 42064 65657) (foo) (67958 99201)) ((alpha 18776 lambda bar count) (30006 bar lambda))) ((26728)) (68206 19575) (78960 (87314 (bar cdr gamma 48973 x)) ((x 54532 43122 lambda cdr 69231) (item 82360 delta baz 20995) (-549 10598 89604 delta) 5075 (98121 21906 44341 64566 z 33629) (bar car 38094 alpha bar)) (84144 -646 (72063) 93398 86546 (count item))) (((cdr baz 61811) (27749)) ((90443 19573) 88278 (gamma count gamma)) (x 34779 cdr z 3100) lambda ((34047 88478 80668 item 34683 bar) (96251) (76288)))) 21344 ((((cdr 37893 bar baz) (96512 baz lambda 66601) (61307 item 4355 count alpha) (item) (74218 x beta y) (car 37625 item alpha baz)) ((z bar))) (47910 ((x 67455)) 94776) (((56266) lambda) (car 32284) ((22968) 34833 (cdr 57236 -412 baz 79743) y)) cdr (((baz 44032 bar 93135 33357 41196) (baz x alpha) foo) (beta (alpha baz 40203 67644 foo 47313) (84912 73899) (11242 z) foo) ((27394 cdr z foo) (8141 79796))) (81276 ((lambda 70293 bar)) ((22261 88684)) foo (car))) ((49928 (41646 (56585) (70950 car car)) ((98033 17931 56184 cdr car) (81005) car bar)) (((39913 foo 26646 x 15643) (2791)) (60840 (1892 alpha) (item 92421 55061)) ((22260) (74122 21482 50254)) delta ((bar 67337 38708 70557) (41053 car 47459 61674 56866) bar (x 25206 12041 98083 67346) 38701) 84683) (lambda (x (28018 y) (cdr item 84429 19984 74875) (foo) (47487)) (beta (91420)) x (beta 17260 (35660 54730 alpha) 41244 74363 (75655)) ((82912 81239 y) (23795))) (((x) 91233 beta) (delta 74537 (beta) car (cdr 4373 item)))) 66117 ((((10649 97380) (item) baz) ((y) (33395 gamma)) (47483 (z 49928 y 27925 x item) gamma (17538) (lambda x 56182 79555 6266)) (94726) ((alpha 81464 28922 foo alpha))) (beta) (((baz 69451 91526) (33482 alpha beta 25982) 84057 (14083 31662 64465 75194) (item 84593 76850 count 91215)) (count 75397 car count (cdr alpha lambda foo 22433)) (68230 count)) (((16256 23637) 90862) 94059 ((car 29539 delta baz) (cdr bar lambda beta 62808))))) (((beta ((gamma 68639 53330 gamma 74282) (16837 delta alpha cdr 1289 10739) gamma) ((5749 59758 94134 3101)) ((lambda alpha delta 41822 cdr x) 90203 x 67364)) z 22991) ((item ((item 2079 55318 45663) (z baz 34549 y 7407 -127) beta (14454 17639 99931 x beta)) 41939 ((cdr 31045 27460) 34153)) ((count 36934 88255 (bar))) (((56874 46074 80926 24805 66792)) 30379) z)) 3176)
+'(85648 ((((gamma (y beta bar 16005) (74026 78458)) ((item delta bar x 78514 alpha) (gamma 88650 40650 59123 car foo)) ((-160) (10331 z 83988) (x count 18061 77994 foo) (5626 delta delta 10228 88609) (73528 alpha foo foo 63748 baz)) ((27904 71347 z 33201)) 21332 ((16362 1371) (y 63878 foo 84625) (34003 73144 x))) ((68359 (34589) (alpha 41644 beta cdr 38452 68823)) (54262 (23616 27262 item count)) (car 31379 alpha (50751 72126 count 69224 item) (bar 11607 delta) (6717 lambda))) lambda (beta ((2670 62932) (59930)) ((17119 89337 z 88242) (alpha) (beta 9164 77916 delta) alpha)) (((bar 74746 91580 91302 alpha) (32076 beta car y x cdr)))) 41898) ((12378 z) alpha ((((foo 96852 y) (23074 y bar 63738)) (z x foo (16834 96629 85923 alpha 3649)) ((41375) (y count 46283 lambda 29332)) ((21356 52643) 93789 item (y) (42129 13316 y item)) (foo (lambda) (cdr)) (car)) ((64355 cdr (delta 67516 35479 baz alpha)) ((x) (12293 46185 bar) (12569 alpha) (z) (50549 15148)) item ((beta 90258 84663 45310 29574 cdr)) 89412 ((71724 foo cdr 4468 x 71735) foo (59967) (65614 cdr beta 43605 21355 68610)))) (beta (17729 (beta (cdr 97102 delta 66348 94886) (49593 26144 24942 13727) (52447 39121 beta cdr 16372) (1643 35046 70593)) ((beta 84820 beta 31418) (y count 26568 75379)) count) z (x ((25192 gamma 50761 28227) (car gamma) (92708 alpha) bar (4295 lambda foo delta car y) (z 17790 cdr)) (baz (44340)) ((35135 49374 x 85450)) ((gamma) (car 80893)))) ((((41489 alpha bar 30780) (y) foo) (39681 (beta 11251 47571) item (baz 87048 72204 alpha) (97833 beta)) (car (11511 33603 89722 49777 baz) (gamma 51835 x 6990 97060) (y 53179 y)) car) (((40794 39885 33405 39748 baz) (foo 26864 49608 52461) (foo bar baz beta 23709) lambda (delta delta) item) ((delta 68426 count z 77457 x))) 50815 (((41223 63496 item 27936 baz 29306)) (lambda 34324 (z car cdr) 25200 (delta 1216 62671) (38975 beta 15336)) y (alpha (car 56497 66528 32407 27681) alpha) ((52216 car) (69027 baz) (foo 10267 y) (48278 alpha 77852 51409 62722 item)) ((91590 38041 beta 62562 item))) (((5894 86292 77689 39587)) (beta (cdr) (x) (gamma 74848 y) (foo count baz 360 69582 72669) (27979 17578 bar 2038)))) ((cdr ((36518 bar bar z) (98507) (y cdr x) (86526) (z) (67324)) ((beta) (z) (37928 17734 64150 delta) gamma foo)))) (((50573 78542 foo 9926 ((53251 foo x x 66302) (delta gamma bar count 23727 3161) 50952 (47166) (car baz))) (((60594 delta 73150 baz alpha x) (baz))) ((30872 (43431 24186 24795 lambda cdr item) y)) (((car 90988 alpha beta 1550) lambda (18852 foo car cdr 88759)) ((gamma item car 55613)) ((baz count 1060 delta) (foo cdr) (22029) (94978 87853 16583 15496 79841) (baz 63064 30451 foo 34643 52753) (76340 15015 46413 82722)) 32719 (4655 (cdr 1246 91430 62432) (44123 65263))) (((gamma) (x 9452 alpha x) (beta lambda)) ((68366 beta) (24650 34393 y baz 49018 92223) z (82409 82205) 95833) ((12479))) ((63759 (62783 84515 45486 69263) (80546) (45556 48272 count) (83635 85594 73730) (gamma)) (42367 (z 48791 baz 38478 y) (z y 73512 bar 69843 z) (78609 16104 car 15394 bar 14477)))) 60106 (40998) (delta (((bar 718 10903 delta) (foo count baz bar 69330 51952) (80147 47651 item 14777 93766 count)) ((54612 95874 1375 foo) (bar foo 35825 25032) (91155 count z) (36204 77863 item 92872 y)) count ((17300 item 9118 x) (z 83117 91616 32021) (lambda 67050 41523 alpha 20793 82972) 45572 (lambda alpha foo))) (((76659 y 13010 51446 delta) baz (5340 99873 68294)) 63093 ((19259 15653 y alpha)) (58118 (beta 43024 89276 84540 bar -713)) 66690) (((29424 lambda 66354) (65480) (gamma z 34456 78883 66667)) ((delta)) (beta (40357 77057 beta cdr) 24 item (98639 bar 13529) (13860 54669 70844 41569 foo)) ((y 61569 49105 bar 99441 foo) (12055 84693 beta 38805) 78940 (alpha 48658 y z) (beta 85842 89916))) (count (lambda cdr 25788 (beta delta item car 17227 92834))) (car ((69999 baz 32398 z) 35666 (42306 cdr baz cdr) (z z)) ((81643) (lambda 52297 7570 91645 30641) beta 88352 63267) ((28027 delta beta 6357 48322 88635))))) (((foo (bar item gamma (11411 lambda 66967 foo foo z) 43861) (baz (count 79694 gamma 80742 78472) cdr count) baz ((20082 87831 63016) (foo beta) 91352 (-374 cdr 67320 delta lambda 37178) (13541) 68121)) 85816) ((1500 (246) ((lambda delta x beta 74285 baz) (delta car) x)) 66136)))
+'((((((27059 65279 foo 22178 58776) (car 17844 30656) (71334) (31283 cdr lambda count lambda 20043) (77182)) 74918 ((74203 lambda bar) (37231 7616 60364 65200 y 17938) foo (83217 x 16121 lambda lambda y)) ((82337) (cdr delta foo 35585 bar) (60586 bar))) (35938 ((80331 36235 9026 cdr) (count 8 84897 delta delta) 31609 (cdr)) ((y 83734 66480 92887) y beta (70239 car gamma foo item)) y (58396 (beta 79173 73003) (403 z foo) (cdr count 15133 x) (count car count 3108)) (count)) 45820 ((beta (z) (20906 count) (lambda 24402)) count (lambda (beta 63351 gamma) 32563 baz item (57390 foo 78649 15553 z))) (((z 81408 90581 1090 85483) (lambda y)) (82638 (cdr foo 33407 y) (x 94076 x)) x) (delta ((15398 alpha 96687) 77020 (gamma 92900)))) 51654 ((((95357) (bar) 17985 (count y delta bar) 58390 40024)) (((38209) 65256 (item foo 29832) (25934 98970 beta car 61612) (foo gamma car bar)) ((26821 y car 96262 bar)) 51453 (lambda 57478 (82044 23562 cdr 14160 beta delta) (37189 69625 45507 delta foo)) ((y baz beta) (foo y 95325) (foo) (77641 40390 50499 beta baz) 36678)) 68582 ((x (15076 count cdr 94835 7229)) ((beta delta) (z) (6148 gamma foo)) ((item)) 22616) (((bar 28919 lambda foo) beta 9228 alpha (beta)) ((61071 71129 46097 y 21213) (beta 29244) (44483 alpha 55949 item 55683 48034) 13842) (36455 (cdr x) 57047 (lambda 52337 85461) (gamma 79432 92396)) (34308 (delta count)) gamma) (((beta count 95972 26705 83456)) 47464 z (gamma 65892))) (z delta ((y (23082 z 94000 53463) (foo 49271) (lambda y)) ((count bar) -948) ((27697 49496 91176 99555 50654) (48280) (66693 x 72699 x) (92094 43667 z car)) ((80057 86945 cdr alpha 28013) (item baz 17067 98671 z item) (87925 42673 35707) (alpha 59492) (beta 87047 car 58396 beta gamma) 57258) bar) z) ((69929 34670) cdr (54219) ((x (item 1383 baz) 65681 (item lambda 84703 gamma 91289) (26545 item 63132 17484)) ((34582 21790 93709 46046) (item beta z) count) ((z lambda beta x 93119 foo) 50194 beta (45967 2355 80176 33754 31022) (87206) (15075)) ((z baz 28996 22827) (95547 car gamma 99237) 71933 (6653 30003 gamma) (foo 10964)) ((10910 25508 delta 34637 55127) 63179 55661 alpha (19098 item 57315 28662 gamma)) ((beta 1331) bar (bar y) (46891 52674 alpha y) (16496 47242 93326 40640) (6763 delta 9811 46176 baz 36944))) car ((foo 91837 (32687 40613) (delta 7954 cdr gamma))))) 66881)
+'((49468) (((((90674 28205 85108) 51648) 18420 ((16626 delta) 67752) (y (gamma 58998 87164 gamma 1314 lambda) (44543 22916 7573 32655 foo z)) ((63984 y 56276 beta) (gamma 40273) (foo 82190 bar z z 35591) (46085 49026 delta) lambda) (y (bar bar foo alpha 19468 67518) (x 22566 item count))) (((lambda 48219 count x) (24393 59226 12014 alpha delta gamma) (86734 item 40838)))) ((((15072 item cdr) 1007)) (cdr 26080) (((z z 58059)) ((91150) (89599) (count 69449 47057 beta) 41971 (21307)) z ((cdr alpha)) ((89828)) (lambda (4167 71246 70456 86704 2829 69943) (80883) (delta 92749 77989 car lambda))) (bar (45373 (lambda count alpha 70245) (baz beta 85009) (car 18946 66382 z item 86629) (29937 82294 z foo 99732 y)) (bar (z 72497 38873) (9886)) count) ((x (delta delta foo 10944 198 17979)) 24136 ((delta item 89787 cdr 82656 cdr) (z baz 93803)) ((alpha 77780 alpha car 14157) (31661 count cdr delta 24539 22681) (gamma))) (((gamma z 21048 alpha 99892) (70721 alpha) baz (70298 9201 bar x) 86148 x) (75154 y) ((94223 foo 63608) baz cdr (27176 57925) car (77738 car)) (item bar (item)) ((17122 96496 delta) (32622 beta) (foo) (6432 32185 13507 67682 car gamma) (beta) (car)))) ((((cdr 94259 bar z y) count (lambda x x 88507)) (20684 (delta lambda 6889 -814 80069 delta)) ((65561 4544)) (lambda 61458 (92897 bar 41354)) ((foo z) 5063)) (((gamma beta 11634 36913 baz count) 46470 44321 (lambda z 29526 24312 cdr 85606))) 72229 (87220 ((delta 95747) lambda)) car)) lambda delta)
+'((((((21762)) ((baz) (x gamma 76399 item -655 beta) 92518 (24893 car x 72326 10366 beta) -91 (car item 67896 lambda bar lambda)) alpha ((lambda) (25695 90727 63187) (lambda x lambda 97912 gamma car) (foo 21740 27867 85800 90607 alpha) (94743 -543 17920)) (z 95794)) (car ((cdr) (70832) (lambda baz 23030 foo lambda) (x) (42699 37887 delta 61643 66792)) ((18157) (53076 lambda) 69214) 55526 delta) ((gamma (78007 delta 63507 item 50620 delta)) 45740 ((beta delta bar y 32030 cdr) (z y 57799 9117 87073) alpha)))) 13491 (((((83215 alpha) cdr (item delta 92783 94953 lambda baz) (delta 97043 14052) (foo 49936 62213))) (((85044 beta y) (27706 cdr 53866) (foo item 93626 12529) (delta 61629 11951 z) 29667 (81977 lambda))) 88162 (y ((73343) 12652 (delta item car beta x delta) item (bar car 19769) (67773 23783 cdr)) bar (cdr 57891 (count) (13323 foo foo 14772 38988 63803)) (12435 (z) (15405 75560 61569) (49008 43022 43150) bar))) (35059 (((58534 70414 34266 29948) (8856) (2557 z 86397 99761 21289) (59225 cdr lambda 18725) (47470 delta)) ((86512 6440 18667 lambda 21394) (baz bar 6252)) 57803 ((85768 6526 5270 75746 beta) (delta 39964) 87887 (alpha) (gamma 60686 85579) (alpha 36458 71293 44090 z)) ((baz y count car lambda) (36630 lambda gamma 22152) (23190 cdr 89380 beta)))) ((delta ((-312 2758) (z 2497))) (((gamma z) (y 35108 alpha 96206) (bar) (93423) (item x) (y)))) beta) (((((10207 item 48817) (beta) foo (81124 93770 z gamma lambda) x) beta ((29201) (43117 98930 88831 item 56357) 88058 lambda) ((x item y 53057 20904) (76127) (4320 43867 4761 72924 96481) (alpha bar 76194) (59167 44151 cdr) (x cdr)) (gamma (count) 62353 (y) (delta) (22070 28887 count 42538 baz cdr)))) 64415))
+'((((88379 (foo (-68 bar 80529 delta) (62817 bar z x)))) (56122 18221 (((47892 19746 43201 1298 foo) (49437 delta beta count)) (77464 (4682 51331) car (71396 foo lambda 46129 lambda) (lambda x 98367 y bar) (baz 83176 delta)) 77380) (((y item item 76067 66026) (cdr alpha beta 22866 2843 foo) (item 21923 foo 93168 98015 73241) (98826 87580 97232 z) (50232 lambda alpha))) (((baz beta 99396 92247 y count) lambda) ((21693 z 45544 cdr cdr) (81902 74650) (59057 alpha 99862 lambda 2220) alpha (alpha gamma) 68681) (70061) ((89967) (16798 12828 9257) 79820 25229 (x))) baz) ((((gamma bar) x (y 92909 -347) (item z) (15360)) z) item (43969 ((beta foo 13021) 30079) beta) (((beta 68498) (88738 52491) alpha 45779 24669 (72998 91237 94814 83788)) delta foo (29582) ((beta z 64856 65114 61645)) 94403)) y y) ((43589 (((85383 72854 16435 7932 car 6171) 57992) ((bar 26256 58046 60096) 72054 (66747 13439 cdr 54588 72743 baz) (8359 foo cdr 91286) (18603 53169 30337 cdr beta)) ((bar 16768 bar 53317 beta) (x 50525) (lambda gamma 27023 33573) (baz) (alpha) item) ((z 21279 cdr baz 55073 beta) (foo 31066 33369 y))) (((bar 82499 x) 69429 (foo 11243) (y x) (foo))) 12201) ((2240))) ((19 ((delta (lambda) (item 75216 baz y 38840 gamma) (89461)) 99894) (((lambda 32182 96273 85611 53973 bar) bar 26336 (99557 item 86833 beta foo 91747) 35604) ((delta) (z 17) (55460 29594) (car x 17859 foo 9361) (46952 71787 gamma y 95480 11111)) ((57249 lambda 59398 cdr gamma)) ((24070 36205 73988 y) count (92381 55937 x 81323) baz) (55168) ((25529 y bar 43712 35627) (5211 y) (delta gamma alpha 75087 44136) (23121 25996) baz (39932 lambda cdr))) (gamma (13069 72940) ((beta)))) (((lambda (z z count) (0 94628))) (((6735 z foo cdr) cdr (gamma car 93421 beta alpha 86313) (32334 lambda 25415 21692) (foo count 77426) (x 54688)) ((66771) (beta foo bar 70393 foo 78462) (alpha x baz 33838 83013 delta) 95774) 39038 ((alpha 56583 47145 80095) (29055 z 25837) (foo baz))) (((70829 64665 lambda 28031 cdr) (51952)) (lambda (54763) (9971 55195 car 17830 46228) cdr (91816 y 55684 25236 x 16654) (item 43154)) ((19682 38724 55769 13237) cdr (cdr foo item bar) (21539 67613 42667 63569 41009 delta) (24242 40448 70420 78515)) ((delta item gamma alpha beta) (73314 count -445) (4759 52136) beta (car 68588 38834 alpha foo) (item 96252 99841)) ((gamma 71878 9220) 77150 (bar bar 57406 97080 98431) (97653 lambda 98151 5386 43436)) (3607 (foo bar) 20604 (5192 item 63342 lambda))) ((52914 (gamma 22499 19079 car 81612 27684) (22357 cdr item delta 21409 2257)) ((car 97556 89341 31308) 78657 51018 (2974) (22745 delta cdr 42162)) count (63640 (foo) (z) (34134 lambda) (count 5214)) ((29055 82718 lambda) (count 27440 68789 count) 97593 (z)) count))) 49462)
+'((((84978 8189 (69189 beta 64609 70085 (89316 baz alpha bar)) (64802 (91356 bar count) z (count 25645 56847 93194)) beta) (((77051) (28115 delta) (94223 alpha alpha 8537) bar) (51409)) delta)) car (((((beta 28307 gamma gamma y delta) (count 86636 car 87203 cdr 39038) (38648 45570 car 70360 28457)) bar ((11392 55783) 33600 (4151 bar 39504 item 99118 30040) 11757 (gamma) (foo)) ((67797 car cdr)) ((y z y beta x beta) (89601 gamma gamma 40342)) ((90195 baz car item count 88173) (count beta 36074 48046) z 11568 42905)) (((delta) 33162 (bar bar 98763) foo (15455 13815 46568 43116 bar)) ((49451 63440 x) (cdr 7268 90549))) (foo delta ((23028 86546) (58348 count) (cdr x) (20819 37356 79120 50618 foo 41847) (bar) 15464) 47145) (((47289 82225) (item 41301) (lambda 59695) (36144 86556 bar 68735 z) (x alpha) (53259 count))))))
+'(((37102 (((alpha car) 95144 (delta foo 77341 gamma)) (delta (item 96718 37095 -292 85523 8940))) (((y item item delta 94955 65965) (item bar) (91348 y)) 64922)) (53026 (lambda ((delta)) ((alpha 20391 car 93083)) ((delta x cdr 64942) (delta 72995 61170 94264 79757 item) (9746 car 10136 91327) (bar 53249 cdr) y) ((79321))) 19046 ((lambda (bar) (14147 18536 alpha 96444 2431)) (14830 y) (delta delta (cdr x bar 4296) (x lambda 76956 68262 29244 6905) (bar beta 62473))))) (((((x 72342 81448) (z 36942 cdr) 82336 (gamma x 46488 41513) (y bar beta 87438 69341)) ((foo) item)) (((68538 65411)) beta ((46488 69825 11203 95629)) 33895 ((-742 y 10600 13363 beta beta) (cdr bar) 99656 (50410 cdr 27238 98840) y)) 87297 ((49818 47461) ((car) (z) (lambda 17559 11792) (96347 56080 beta x) foo)))) ((baz (((item delta 76690 y 87807 50484) (foo beta 2869 alpha 5784 8606) (count 19788 count)) ((beta x bar) cdr (7490 gamma z 66178) (car cdr bar 17986) (bar 62566 bar 11393 lambda) (item 32018 lambda car lambda)) 90678 ((car beta) (item x 76219) (7504 cdr)) (45079 (32689 8257 count 37433) 12552 (38637 delta))) (((53652 gamma 25312 3118) (31379 46363 item 59712 94758) (lambda baz) delta (foo beta z z)) (item (94477 x beta alpha 26230)) ((count)) ((59141 beta 23712 car x car) (51228 93342 83610 23288 cdr)) 28234 car) (((48217 x item) 92293) (61864 (93481 baz 95063 65854 bar 24503))) (((count cdr beta z 61501)) count ((52706 car 20313 bar car alpha) (foo y) (50291 z 84141 53688 72927 foo) (58312 car z cdr lambda item) (cdr 61943 26958 87225 95971 34788) 82338) ((33532 delta 68217) (count cdr x alpha 73919) car (alpha) (9033 x 4771) (z))) 43294) (59046 (((79690 53828 gamma) (7650 item 21756 37310 bar gamma) (lambda 20765 item gamma x 23720) (delta lambda x car item 61022)) (x) ((beta 37713 22211) (beta gamma) 77275 (76733 bar gamma 77472) 4746 beta) 96011 (count (car 33793 bar 96908 count) (x 79230 48608 baz 79773 39998) (6818 item gamma x) (87420 x 6387 foo 61397) (z 99429 foo)) foo))))
+'((((76319 (lambda (car x item) (23861) 71651 (22413 count 28988 item bar) (61815 84212 bar y alpha)) ((delta 14392) (alpha 26753 count bar) bar (58781)) ((19366 delta y) bar (55740 count) cdr (foo 66292 car 2177 98924 count)) ((cdr x 38954 lambda) (63913 77544 71277 delta 80644 4080) 67470 (delta)) ((38226 item 25950) (5898 gamma) 54024)) 14779 x (((bar cdr 55516 car 42359) (52085 bar z 23339) y (12517 bar) (36755 y gamma 82163)) 96266 96566 ((7246 gamma 80004) (y baz y cdr 74310 alpha) (79002 z 27779 61623 3552) (bar 68031) (lambda 72896 car)) foo ((car 24191 alpha count) (36843 x lambda foo 21627) (7701 25354 beta alpha) (car item 81430 20703 25785 7988) car))) (z lambda (((72255 car z) (count 38446 bar bar 92768 cdr)) ((69011) (y 3205 delta 98390 59315 78158) (cdr 826) (25832) (z x 63227)) ((car item beta) (46291) (alpha)) (bar (gamma 91191 y foo 42176) delta (83425 67397 25663))) (((77434) (delta 84245 lambda 20134 foo lambda) item (gamma) (cdr) (car 61584 baz -412 1460 23432)) (91472 (75191 95544 delta) 36860 (79123 bar 89677 77149 26168) 93971 (count 94977 3434 53901 z))) (((7470 lambda item foo) (68599 21445) (baz) (18830 lambda 94527)) ((gamma alpha alpha count 26654 y) (alpha 91099 foo 4886) (61484 81138) item)) (((x) (6361 y 89559) 86597 (gamma 24985 bar 79989) 69868) ((item lambda delta gamma 39813) (31984) (15462 z 9183 gamma) (83747 car x item 2776 78698) item) ((80818 49172 foo 56237) (79352)) 94009)) delta (bar (((lambda lambda count 48407 52096 car) (95764 75247 item) (65197 45913 lambda 72403 delta) 80632) alpha (97440 (z 78741 beta delta 61500) (count bar) (x cdr) (foo 96332 delta 4518 x 78568) (98288)) beta ((baz beta alpha 39876 bar) (61139 51659 beta 11383 84450) (foo 5087 53851) (gamma bar 76333))) 64616 (((baz z 66102 94806 z) (10832 x beta) 31920 (alpha foo) 73244) (cdr) 68807))) (alpha (gamma)) count 55284 ((((baz 70483 (64068 cdr 63027 z 90652)) (56118 (82863) 27427 gamma) y ((beta y) 46766)) (((foo 80317 81799 72775) (26265 19611 81889 93551 5022)))) delta ((((z) count (9735) (z)) (foo)) (((x) (y 46148 bar 27184 23516)) ((29720 y delta item 7223 item)) 80580)) ((((bar x car) 96088 (57699 48339)) z 51674 ((91968 car item 68758 38196 35027) 98676 (53979)) bar ((86053 count 6105 alpha) (delta cdr bar bar delta) baz)) (((z delta 17974 x lambda baz) (80498 alpha 46552) 59798 (90066 cdr) 71040 y) ((53423 delta 39609 cdr 7530) (90956 86309 beta) (count cdr z)) (alpha 19911) (20689 (car) (51079 car cdr item) count 27308 (52108 19515 car 73704 66029))) 86839) (foo (((item z))) ((70842 (62105 baz x 17001) item (lambda 60380 item) delta) (64426 (count baz car baz 53369) bar (-37 bar) (18153 38612 31208 22270 lambda) (bar)) ((74358 gamma 85978) (72925 z 59164 50277 90190 51122) car z) 84646)) ((((98476 count) (31499 11552 x y beta 51932) (14907 26227 gamma) (count cdr 5824 car) (x bar gamma foo)) 23865 (15728 74013 (bar 92551 count 32284 bar) (30248 20379 80192) (24063 97902)) ((z item car foo 43706 delta)) ((78401 lambda foo) item (y 73187) (car) 92213) ((beta 42999 x 826 2266) 38588 gamma (66864) cdr (lambda bar delta 51601 car))))))
+'(count 25892 (29580 ((((z cdr 51238 count))) (((cdr gamma 34671 47741 count x) (foo bar) (beta car 32135) (foo foo lambda)) (cdr cdr lambda (alpha)) 74806 (50678 (5692 31522) (z) alpha (10845 94097 cdr 2247 45905)) ((60370 gamma))) (((91576 -240 delta car 44578) (51700 gamma alpha cdr bar) (cdr 68209 lambda)) ((x 52995 z 12050 3987) 10463 (alpha) item (31436)) 18466 (58750 (43452 52877 delta) 8171)) gamma item (car (97513))) (((42861 (z 55279 96342 baz) foo (56117 gamma) (64625) (alpha 15795 29953 55946)) ((car delta 45027) (x 81320) (delta 55157 bar) 14258 (beta car 76969 40084 count 99807) (delta 85712 gamma beta))) (((x)) (cdr 94933 (49770 15683 gamma alpha alpha) (y bar item 67447)) ((36279 14670) (beta 31180) bar beta) (lambda (y 66892 bar) (alpha)) ((beta) foo z cdr bar) (car 78275 (58163 24741 bar))) ((39576 car (99612) (99677 gamma 38217 y delta 56007)) (42702 z (17770) 39156 33988) (lambda (83162 70382 55100 cdr) 98782)) bar (((beta car gamma x 35395 92309) (foo)) 85475 (42722 5712 (74771 48323)) (x 69174 (14580 77957 47413 89049 alpha) (21559 50933 92554 55237 63577) baz) beta) (90943 ((13757 84361) delta (cdr y 11904 83196 alpha) (40213) (83682 baz) 92744)))) (((((68263) (count) (x 46455) baz) (z (foo) (alpha 15232) (84032)) ((x cdr) 23087 (y)) 69985 ((lambda 37129 lambda) (93837)) 66946) 27655 ((3330) ((beta count) (78471 cdr 86838) (x cdr) (21909)) y) (foo ((lambda z y 63646 31400)) 90091 (gamma (46123) 78589 (84818 beta 25091 cdr) (34799 foo) (y gamma 68486 y)) bar ((beta 53108 x) (56583 85864 bar 4975) (lambda item 73867) cdr (15640 5878 count car) (19015 99376 30044 x))))) 58972 13575)
+'((((alpha (lambda (40638)) lambda x alpha alpha) gamma (((x 26301) x (40265) lambda) (beta (41399 car alpha 15003 37658) (74251 y -255 x 91847) 62887 (12994 66275 delta beta lambda 26044) delta) 15246)) 73348 ((((49662 45142 x 73672) lambda (32544 58967 32173 x) 55420 cdr) ((car) (baz 55395 81945) y 3791) (36285 (bar gamma baz 52290) (49550 33341 48904) (67197 14550 z x lambda 22230) (lambda z y cdr))) (alpha) (x (bar 59127 (39417 54288 alpha) (z 42551 78607 22623)) ((delta x) (bar x foo) (80254) (6731 76675 foo delta bar z) (baz item) (count x foo)))) (45198 (((77116 x 89718 alpha 61346) 59534 (foo 30689 58873 foo) (gamma -198)) ((item) 42204) ((26077 alpha) (20212 51010 77626 baz 20552 item) (66029 71878 gamma alpha) 46035 (90027 83190 69445) (-710 car foo)) cdr 43447 70061)) (39413 (((93704 41302 30415 3091 baz 17491) z 73383)) cdr)) (((55506 delta ((x) 4178 (36606) (bar 77925 x bar) (16302 34344 25340 26392 42308)) 62366 ((item 16305 97452 lambda item cdr) 38711 (90822 car 65085 36878) (count y lambda 73171 11682) (19951 x 83593 z 16967 foo))) (((33095 beta foo) 75514 (83568 baz lambda) (67432) (78136 cdr 30741 alpha 20532 87483)) ((bar 76101) (foo count 82289 y 18792) delta 25288 (delta 24806 item foo bar)) ((28455 84147 z 57960) car (gamma delta x 75806 y bar)) ((63090 delta y) beta (lambda 85525 lambda bar 27411 foo) 60863) (bar) z)) (beta)) (beta) (((baz ((baz) (item y 14238 gamma) (alpha item y 82495 90774 82393) x (lambda 67428 3158 38776)) ((cdr 94442 965 55239 lambda) y 2528 (gamma 11122 83004) (item 37766)))) gamma))
+'(7968 ((delta ((51082 (count z beta 89387 14239 9480) 6754 (83783 97250) (6515 76933 gamma 71773 16959)) ((82378 x) (918 x) (25173 60024 73863) (count 15794 bar foo 2297) (27724 58904 17824 76442 54124 92129)) 56655) (((98883 71485 88543 cdr lambda z) (foo)) ((33652 55398 56354 beta) (46648 96401 80746) (gamma 61563 82457) (53643 90274 baz)) ((74483 alpha bar) (foo lambda) (bar) (y count foo 33703 count)) beta ((81994 lambda) 42922 (64530 car beta 41722 y) (45865 82210 66522 84772 foo) (car cdr bar 88033 delta)) ((beta car 99173) 70835 57542)) ((baz (51978) (84595 delta 58381 42448 y car) 77687) ((beta 95294 99265 bar 10397) 91607 (37123 car 88949 79167 18637) (cdr) count cdr)) ((83752 (z alpha lambda) (1234 13448 40867 gamma delta 15116) (44156 car 80211 z)) count 66998 ((x 30666 82547 99930) (62013 delta 56956 14751 delta) lambda (y 87962 beta 6980 car) (31017))) 3178) (((count (48671 44634 delta)) 11282 lambda baz) (79786 beta) (gamma delta alpha)) (((30665 x) (99666 car (47665 lambda 91364 x 70264)) ((7507 64401 car 8978) (3123 15022 10863)) x (95217) baz) 3139)))
+'(((((foo (x x y cdr z) (car bar) 53271 (61566 z cdr foo 99971)) ((count count beta z delta) (41705) (8316 32268 y gamma) (84228 25508 alpha 99344 bar) (beta 76224 26370 83067)) ((90077 6629 9917) (41138 beta) count (lambda 25381 67485 beta 91169)) ((foo gamma 44753) 44656 (50256 26772 51906 count item baz) (94765 44530 87196 delta bar) cdr (421)) z ((y y y) baz)) 13142 baz (((99071 item 54302 16593 x) delta 85928 (gamma gamma x y item) (alpha 27055 beta 14961) (71810 42371 item)) (46791) ((35579 y) lambda (lambda 10201 z) (delta bar)))) 10437 67065) (z ((((23487 count) (79394 x 8987) 11300 (bar 17680)) ((car 33576 5922) (count 15005 97487 22381) (count) (gamma cdr z 85951) 86404)) car ((bar (z beta beta 41783) 63722 (18282 gamma 27119 z) (96681 delta count lambda 37234 count) z) ((delta beta foo) 79868 (78137 x 75137)))) 86726 12154) 62903 50638 (((((cdr) (bar lambda) (43344 bar x) 10307 (5648 67215 38349 lambda 15688 bar) (gamma beta 31092 65691 y 67017)) 78384 (73309 (cdr) (y delta 6946) beta item 46429) ((bar) (88684 bar y lambda delta 88698) (33368 65203 lambda 49110 z))) 13254) ((((beta lambda 14259) cdr (82548 20436) 25791 y 93599) ((37036 y cdr) (53442) 74697 (29865 94094 z) cdr) ((1787 96955 alpha) (x) lambda) ((item alpha z 91317 85513)) z ((99795 cdr delta) (lambda 9284) (count 56301))) (60288 ((car 3137 71130 13328 alpha) z (cdr baz 39987 38401 z) (y))) (((baz y 42539) (82268 81081 foo)) 78065 (4631 (cdr alpha) (delta 10083) (61377) (10057 foo lambda 23284) (z 15871 foo 19671 74291)) 9722 ((57281 beta) (68195 y 93983 count 84735) alpha (90782 98968 cdr beta))) (92207 ((80540 baz 52915 count) (73633 item 30757 lambda 79755 car) (57968) cdr) ((count foo 47709 alpha alpha) (beta 98930)))) (84460 foo 69533 (((cdr foo 18310 foo)))) 97147 73547))
+'(((car ((1312 (y count foo baz) 688 (alpha 25419) 56891 (28 count)) ((delta lambda) (33228 33077 beta lambda 79493) (gamma 96480) (97122 81912) (x 32073) (67914)) gamma ((z) 32964 (alpha cdr delta lambda lambda 74718) (99441 cdr)) ((83736 95591 alpha) 84209 (gamma x) (84841 x 60558 beta) (z)) ((71636 28269 count) 33279 (cdr item))) (alpha) (89076 91274 (y (z y bar) (35564 98434)) x ((67417) (74743) (5192) (90183 31982 cdr) (43825 lambda z 93233))) (((z 34318 10104) (beta 20196 car) 33596 (51903 16370 10458 32576) (55696) (beta)) ((64671 72889 lambda) (x car 18948 46345) item (60115 count car) (24099)) ((48740 baz 81976 item lambda)) 86892) ((78101 (57280 20087 9669 83344 83132)) 23630 ((delta)) (90173) 59870)) ((((beta) (baz item 31653 lambda 7546)) ((cdr 20857 85186 56207 73025 90335) (gamma 76393 51313 gamma 9157)) ((34492 90636 y 29620) (x) (item foo 34679 beta) (40035 count car 5678 14862) item (64754 beta gamma)) 33906) (count (35689) 41849) (((item 51369 gamma))) (y (bar (z y) (11140 lambda 27807 79971 56197 33935) (z item cdr x car)) ((6136 31945 47824 1867 62056 item) (foo baz 20048 12305) (52295 84068 count 87285 z 95481)) ((70754 95785 28954 34480 29042 delta) (69140) lambda (z 24086))))) cdr)
+'((((((39319 lambda z lambda item) (62001) cdr (12661 z 97425)) ((12849 6049 bar cdr) (29319 87675 21851) (beta 6347 car beta car 35628) baz foo (26832 30534 delta 91262 count 15130)) ((15739))) (z ((baz item 83541 foo item 57012) (65536 x beta 29968 item 70718) item 14592 37690 (baz))) lambda (((gamma item item bar) z (65341 89068) (79455)) 49183 ((gamma 25977))) (24850))) 65321 (((((item count alpha bar 41136 79362) (67714 bar item item y) (baz) count 41279 (lambda beta 44277 bar 86794 44872)) ((27097 24787) 26692 57159 58861 (27179 gamma)) ((car) (2685 beta bar y 33866 alpha) (foo z 60691)) (delta (1270 83507) (cdr car 57382 delta z 72945) (11853)) ((cdr lambda 53879 88426) 86511 (41198 93198)) ((44009 bar alpha))) (8882 ((y 27188) (52639 delta baz 9541 16936 beta) cdr (car 76471) (beta) (gamma)) beta (car (cdr car y 6899) (66826 baz 37632 44145) (96953 alpha) 1195 (62118 57613 72067 item cdr 65410)) lambda))) (((((20221 32488 car 96000 1806 bar) baz)) (bar beta 39561 ((89688 17036) (baz 33521 61923 38438) 40681 (91442 96713)) ((y gamma 14162 delta 53840 34716))) (89658) (72541 z)) foo ((((item 54361 37345 cdr 15397 86282) 19237 (91881 car) (beta alpha) count (cdr)) (71425 (93950) (7679 item foo) (41617 foo 15093 car 82501 161) 81386) ((38440 56993 15865 19795 43664 baz) (58968 27643 foo) (1893 lambda beta 15940 1397) (17809)) ((45463 86421 gamma alpha bar 999) (alpha bar) (41756 75294 8870 38693 car gamma) 83387 (54539 delta)) 2747))) baz)
+'((38511 (lambda (((36685 77942 83216 car alpha) (x baz 64135) (cdr 68937 43657 24136 38076 car) (65539 baz lambda) count) baz (x car (gamma beta) (count y x) (80616) (bar))) (((car) (item gamma 26134 58535 lambda 51292) 86745 (cdr 12474 alpha y) (7575 count foo car 8874) (x gamma item 53600)) 85225 alpha (30361) ((car y 96293 14937 92378 60191) 2677 (90971 z car 8940 cdr) (delta 23690) (baz)) ((bar 51968))) (delta ((cdr 83257 34894 x 21838 49019) (car) (y gamma 32662 bar 73827 baz) (y)) (25502 57576 (z 93660 7672 41043) 65965 71588 (25035)) ((x)) ((baz z bar 2331)))) (98588 ((54538 (x))) (((gamma baz z bar foo) gamma) ((item bar 65166 car 92679 19521) (10086 count delta alpha)))) ((((x y 50050 bar 7878 foo) 77713 (beta item 99464) (11534 cdr 93376 89178) (item 88277 89863 z 44381 11004))) 65875 (bar ((99028 count item) (55200 z gamma 66611) 34172 (beta 99737 item 51251)) ((51800 38747 alpha baz 19575 56330) (lambda 14418) (56564 car 79683 baz) (66822 x 81561 51435 delta)) ((count 75625 41962 item gamma) 89359 cdr (63763) count 32330) car ((y beta 12008 x item) (cdr 9137) 91297 (79170))) (((8306 52666) baz (53131 34939) 47449 (61991 97457 9224 90330) (bar 60033 gamma bar 63835 41454)) beta) 55248)) 52579 (((((27097 90360) (cdr 69455) foo) ((73086 item 9505 cdr) (67342 96290) (71226 alpha lambda 97137 47545) (lambda 34946)) 6618 ((70783 lambda 36532 79188)) 41291) (((87973 delta delta y 35749) (84691 z) 90376 952 (61050 cdr 14240 74916) count) ((alpha 36951 61750 foo 42252 87496)) ((81263 5782) (52308 46281) (15956 count y) z count) (10107 (62875 car 60972 item))) (((70449 12347 50253 item count y) 2368 2983 (x 44214 32974 item) (beta item lambda 15755 29146)) 44369) ((beta (4292 x 76529 32565 89251) 9721 (92920 76864 count 74206 7302) 99084 31851) (baz)) (79370 lambda ((delta lambda alpha) (89534 83500 19970) (cdr 98807) z) ((beta 46457 count 52529 52972) (cdr 16168 53615 57381 61834) (bar lambda bar) (alpha)) (44183 (93615 24339 78536 45699 car count) (baz) 87652 (72617 58143 item count) (45463)))) 24982 beta beta (baz (8252 ((baz 97598 car 64699 81635 94275) (25665 cdr) y) 49829 baz ((98259 bar delta delta) (count 34395)) 44868) 34406 delta (((84252 19303)) ((89598 31749) (foo y)) count ((cdr 36237 12911 y) (84994 bar 54977 z) (490) (84043 74919) car)))) ((z (((70459) (64142 car 31261))) (42334 ((baz foo y y 197 43920) (88360 z 35422 89923 26694 88509) 24121 (lambda 12363)) ((car count count 19582 alpha 60168) (88435 x) (60622 94905 67426 14610 11635) (gamma) (x 88560 y 74338 37839 item))) item foo) alpha (z (((z 20140 y 61527 -387) 22451) ((11482) (beta z 53922 cdr y cdr) 21366 (64429) lambda) (foo (55476)) 23309 lambda foo) (((84059) (60492 foo 14399 count 60554) alpha (24511 y 63641 foo) (5658 count 2420 y alpha z) cdr) 5358 (24530))) ((lambda) 12293 beta 86181) (73063 baz)) (72618 ((((x 44867 74421 59464 alpha delta) (z gamma) (46948 9207) (34549 item x beta 49554 16690) 10138 (item 51031 lambda 99423 x))) (((car 98334 alpha) 53499 5946 20215) (gamma (cdr 94834 67552 car cdr))) (((z baz item baz y) (75835 69813 93467 y 41097) (delta 79070 84705 z gamma 64418)) ((count 92204 bar 70508 36143 beta) (beta) (52095 61614 57328) foo)) ((7999) ((foo 76335) (beta 81949 alpha gamma item beta) (beta 34704 97422 3918)) ((x gamma alpha 70891 delta cdr)) ((cdr 44658 87014) (car) (bar 14558 91766 z) baz) ((14577 lambda) 1577) ((17105 38077 lambda 46526 70333 51550) (lambda car 89248 94843 32129))) (((63793 64229 25099) (79788) (58021) (delta cdr) (beta 87976 74 z 92721) z) 33990)) (gamma x alpha (((18657 alpha) (90114 item 5511 69896 4011) (bar)) ((45466 car 64485) 55517 (5840 car x) (62465 lambda) (12422 25503 51693 67947)) (79523 delta (y 80032 lambda bar y) 39067)) (((z alpha 87255)) 75861 ((41022 10237 30372) 76588)) 91838)))
+'((((((bar 41676 51650 4303) (count lambda bar 16543 baz 75222) (car)) ((78924 item z alpha z) (56323 16391) (71849) (beta) 56458) ((gamma 16812 gamma) (bar 44683 73441 65905 z 37826) foo) ((car count item) (7198 69281 92320 89881) 78576 (item 5228 car y foo) (alpha alpha))) (bar 27784 z baz ((10856 bar car) gamma 39572 43899 beta 15072) 88930) 48591) bar x) 55038 (((((94063 delta x 37980 77091 82496) (bar 68992 59498 2887) (cdr 5730) (beta alpha item 52554 52576) (56747 38302 90166 41276 57186)) 58719 ((baz delta) -344 (cdr 77615 delta 20089 54820 68639) (2662) (53607 84847 57223 75418 33418 38512)) (48651) ((86809 22707 lambda 21220))) (((x 91525 79175 bar 39167) (bar)) (baz (25135 cdr 65130 baz count x)) ((z x 51178 99296 count 25200)) x) 43792 (((46965 delta 7275) 49207 (x) (19117 x beta 32714 41749) (lambda 54559 foo 32262)) ((73105 x) (count x) (36040) item) (4269 delta) (30370) (95449 (83703 lambda 16230) 60874 delta (83534 gamma 23533 car 80802))) (gamma 45217) (((car 84588 95017)) ((45212 foo) (46738 bar)) ((51809 x 16053 85856 bar) (lambda 46376 delta foo x) (z x 3072 x 94242) (car) gamma) ((22522 61646 30051) (64278)) ((z)))) ((21375 ((612 foo 41316 93272 25079 99088)) (z 39836 (64042 93989 72951 19453 77267) (item 97503 delta lambda 80823 gamma) (gamma 9041 bar gamma 61784) (46983 61704 39551 41643 alpha))))) (((((58329 z lambda 26486 37218 64874) 68217) 8708 ((foo 53667) 15120) (car (30075 29361 7377 97565 64286 30987) 50516 (79345 gamma 20150 alpha))) (((92203 20677 lambda baz 31704) x 95325 86241 (41588 70056 cdr alpha 24959))) (39787 (68888 (20074 baz) 75567 (y delta) (90893 beta x 81865 83764)) ((baz 76211 37806 44744)) ((foo y 62695 x 48091 cdr) (item z 47973 alpha gamma) 48770) gamma ((39800 foo 68101 bar 98331) (foo) car))) count count (bar (((15480 baz 45705) 4926) ((beta 72715 36717 baz) 56602 (lambda 75067 delta z car lambda) (32718 18843 car baz) (75781 car 87449 count lambda alpha)) ((delta 48009) (lambda) (x) (84567 2870 x 13485 x 90161) alpha (baz 58804 70093)) ((alpha car 85109) (baz 15026) 23658 car (68734 beta item)) ((alpha 52342 bar 33412) (97864 20944 x) (24633 65287 gamma 51425) 15606))) ((((gamma 86863 y car 35649)) ((alpha) (1199)) y) y ((beta (foo y) delta cdr) 18912 1708 (x)) (item) (25571) (((46265 16324) (x 96420 15814 cdr foo 16862) (lambda baz) (baz gamma) (95538 lambda foo car 60784 54886) (90416 76260 31015 28079 84147 72975)) ((47462 57676) (y 65550 41872) (53802 88961 x 57395 77697)) ((foo car 43720 alpha y 30519) (75810 gamma x alpha))))))
+'((item (foo cdr (baz (lambda (car x 30880 55351 18945 beta) (alpha 53880 88950 68715 74580 65183) (42872 67415))) lambda) ((((x)) 84153 (z) ((foo) (bar 68847 38646) 88675 beta 92590)) 22405 (((62686) item (count item foo cdr) (car 82857 2220)) delta) lambda)))
+'((((((baz lambda cdr 7126) (89734 baz z z) (69118 cdr x 84437 82089 69686)) ((83283) (25100) x alpha) ((83190 49133 28126 item 8928 79240))) (((car 10 74509 bar lambda 83748) 50529) 78774) 69965 delta) 55738 (((count x 82288 (x 74820 delta) (89203 89434 alpha count)) ((32116 23600 87938 56448 item bar) (alpha) cdr (z 78841 60655 92738 44658) x 99190) ((baz car alpha 56429) (73567) (gamma -77 -978 beta gamma 33634) car (22527 74742 75519 92826 z) (6398 52253 63766 gamma beta)) (95508 (baz baz 21594) (81752 y cdr z) (15815 x))) 98698) ((((34372 70935 32481 z)) ((foo 86760 59937) 32953 delta 65792 11904) ((24158 y 1695 47889 foo 3305) (50877 49253 97630 98879) (bar item count) (91609 85591 car x x beta)) ((cdr delta y count) lambda (49617 74226) (61475 364 54169) (28765 gamma)) 93627 (60793 (15206 92037) (delta 30328) 22436 (77494) (7508))) (((baz item count 23641) (52200 45905 alpha bar 89545) 6947)) (((46494 foo baz baz) (delta 66354 baz)) ((7252 90922 56174 bar 67574 92971) x (item bar 92666)) 47681 ((delta 22099 item 71187) (42316 28437 84112) (39573 beta x 79554)) z))) (((42632 item 12436 ((delta) (42622 bar car 75534 y item) (80452 21359 lambda) (52917 33476 cdr cdr 34797 cdr) (foo foo) gamma) (z (99111 53355 188 67668) (x) (59125) 47055) ((53686 21246 51989 74801 alpha) (25098 baz) (84983 car 3054 alpha 68102) 21112 z (68594 gamma))) 77973 z gamma (((34603 item 45156 alpha)) ((97077 z beta cdr gamma) 7940 (87593) (88778 alpha)) 73853 10169)) 50062 68316 ((((bar y z x) 43025 59232 (50700 beta) 94995)) baz (63286 (91854 12648 (51272 lambda lambda) (47127 item gamma gamma 50993)) (delta (11717 67774 10706 lambda cdr bar) 58659 car) 67277 foo (69286 (item lambda delta))) (((cdr x bar delta beta) (69413 beta 45391)) 20330 (9718 gamma) ((gamma) (87712 54163 49298 43735 76170) 36281 (delta gamma 35973 31024 49272 12471) 94675 (lambda 79928 foo lambda 63481 z)) (98148) ((98850 x 17597 gamma 53211 54605) 16719 10083 (alpha baz) (11642 item 5452 gamma car) 62870)))) (beta ((((6647) (count) (39572 23478)) (foo y (1620 16186 3915 7139 21388) (83265 gamma 12458 49825 count) (51340 14758 64792 39634) gamma) 97625 ((7667 baz) (8974 gamma 15574))) ((16655 64065 (33805))) (((alpha 32848 89768 delta baz) (77737 item cdr) delta (item 75605)) ((lambda 44125 95465 84162) (52320 count foo 15962 count) 49118) 49671 beta)) delta 5652 item) foo (((item ((gamma 65915 y) (28665 z 97642 cdr z 74465) (41281 47882 x)) ((8294 82529 foo 88310) 44333 (86165 bar car 73151 cdr 45953) 36200 count) 72391) (((cdr 5907 bar 17752) (lambda x z 43716) (75284 58128 99765 42766 x) foo (gamma cdr 96667 1501 count))) cdr (count 18492))))
+'((((((11143 27664 76884 28396 28492 95366) (gamma)) bar (96086 z 94677 (foo) (99469 33536 gamma 59156)) ((37997) (92948 alpha) (94922 foo 81991 count bar) 4406 (76347 alpha 81791 count) (foo alpha 15718 27704))) (item) 11359)) (item (((x 46393 (27571 77965 baz baz))) (98743 bar (x) (75150 (65111 59908 79945 10425 91842 36158)) 95193 foo) ((alpha (36519 delta alpha lambda) (30720 96251 22976 beta beta) count (29100 39328 x 99571 67017) (40990 94197 car)) (48845 (75355 77637 55682 54251) (43399 9398 count 51375 baz))) alpha ((31410 (-143 item) (alpha 90664 99441 20964) 51490 z) (11639)) ((27383 (foo) (delta bar 20484)) ((82545 97328 beta 20577 lambda)) foo)) ((item ((44157 60765 46412 21618) (66069 78616) (z bar x beta beta beta) (lambda 11583 count 70562) (bar cdr)) (22654 y (6641 cdr 78900 7573 7317 baz) (23810 gamma gamma delta lambda) 22305) x ((46301 33573 43749 car 2756) (x beta) foo 56621 (car alpha 57481 bar item)) 24098) (alpha ((alpha) (83224 90753)) beta) (((98597) (cdr -696 36767 item alpha)) ((alpha z 29838 beta 78835 4834)) ((96858 z 86574 55870 51291 lambda) beta item (49920 58964 bar alpha 12995)) cdr ((33357 12858 baz car baz gamma) (lambda cdr beta 39036 baz x) gamma cdr (gamma item 40696 85285 39031)) ((83580 lambda -448 z 18307) 72709 (lambda) (7916 gamma bar) (item bar 42872 z gamma y) count)) item (((delta z count baz 68076) (x 79984 car 15395 26485) (41380 lambda 61482) (baz 47935 50364 item gamma) (delta lambda)) ((61096) (44807 61072 65750 gamma z item) alpha) (car 31512 93177 (foo 28118 70989 56300 42736)) ((76237 91303 61886 32299 z)) ((40849)) lambda)) 1748 45969) (((((68599 14198 22568) (count 90524 81085 baz 44510 29453) (delta 15380 item gamma foo) (y gamma 28733 82326 83577 lambda)) ((baz 68401) (73322 75741 33283 3411 83014) 17738 (85847 35845 95666 7823 item)) (34196 (92226 beta gamma 87178) (26196 62210 35087 bar foo)) (93642)) (((86174 40918 49732 31607 74290 alpha)) ((bar) (69828)) 70124 ((31293 51632 lambda 57208) (y count baz 88094 foo 47820)))) (71124) (89652 ((car) ((bar foo 81405 cdr car)) 90372 (baz)) bar (((24894) (50305 gamma 30273 89679) (94495 item 37645 cdr bar 44969) (60851 33220 42210 30372) (56109 item 62283 18769 25970 40804) (4968 gamma))) (((foo 6428) (y beta) (baz x)) item item 70899) ((47802))) (72941 25259 (((60343) y (15517 lambda) foo (71478 16728 43339 delta car lambda) (96391)) cdr ((8944) cdr) (z (17874 baz 57582 count lambda) 38277 (90884 car foo 51614 70830) (80608) (bar alpha alpha)) ((gamma 59283 count 8405) (94247 46757 alpha gamma) 60745 (alpha x 8854 lambda) (60111))) (((78741 cdr 54743 25874 88238 cdr) 12375 (11113) (gamma count item 99348 83343) 35832) 82479 (62261 (95869 z count 17736) (alpha gamma count gamma) (delta gamma) (lambda count beta 50372 item 87883)) ((74590 count) (cdr) 27403 (count cdr)) 54894 ((54117 y car)))) (35412 baz (((count alpha 82378 cdr) (gamma x baz 60655 63493) (9994 67922 foo) (88395 lambda)) ((item z z foo)) (x) delta (bar (z alpha cdr 48126 beta 24793) (foo z 50282 80096 73983) (83490 bar 49151 alpha 52405 56790)) ((260) (z item 83696 17394 alpha))) 54543 (gamma (15910 (52197 58479 baz foo 75571 238))))))
+'((((17338 (bar (car 46019 beta item car))) foo (((bar 55070 beta) (gamma 12060 delta 6630)) ((93745 baz 75234) (80147 count alpha 2032 z)) ((83682 83010 93053 49813 80600) (39259 lambda car) 88998 (99041 76574 17837 y 54481 93237) (z 24561 alpha 43896))) foo 86648 (((baz -635 alpha 4584) car (foo delta 47751 y 5552) (y 78669 beta cdr) (92862 17038 lambda 65537 49020 91410)) (24552 (30918 beta 630 48647 26278 47510)) ((26178) (79061)) (11234 (car alpha 35043 11963 baz 4318)))) 33959))
+'((((((38586 60638) (39107 x)) 10309 ((45101 66982) (75917 baz)) ((68595 foo 61458 gamma x) foo (beta z delta 28132 80221) (baz lambda 85690 48178 3563)) (bar)) gamma ((alpha 13802 (16531 18991) 8623 (73271 45356)) ((z 57178)) (item 77979 (50136 lambda 25103 22473 cdr 57332) 32536 20523) ((delta 71 car 11908) (lambda alpha 94181 7262 24265) (87161 gamma 99336 8814 44757) (z car 7126 32682) 90184) (bar (41238 45358 beta 96938 z) foo 46120))) (69155 (((28779 y 7828 car car y) (92647 80652 z) car (57151 baz cdr item y alpha)) ((gamma car count) (bar 12274 33010 alpha x 33796) (29808 count x z item) 83723) (42414 (73245 y)) ((43357 cdr lambda gamma) (49457 88999 48770 item baz 23954)) 19106) ((39664 (lambda bar alpha cdr) (foo) (z y 76297 beta count) (1813))))) (bar) ((((32718 (38706 car) (20012 79587 alpha 62973)) ((y car 23594 cdr 61412 delta) (x 41632 66071)) (69897 (12135 93921 13359) (4346 48287 73168 gamma) (x lambda 64353))) (((cdr delta cdr beta y) 50741 88524) ((beta 27280) (314 lambda x 59591 baz) (bar) (gamma beta)) (35508 3558 33774)) 65870) (((77958 61398 (31118 645 77498) (59787 count 76710 car)))) ((((45870 47584 car 32715 z 89098) (14729 bar y count 59075) 67578 beta) ((264 67422 lambda 99283 6767) 63140 (40345 cdr 63480 delta) (item 48184 alpha 36886 beta)) 5912 item 43578 ((delta x x 94696) (30575 bar y 81342 x) (gamma 12902 80945) (31465 count foo item 36844) (40200 77376 84793 lambda 60946 alpha))) 84759 (beta ((beta 26950 7768 x 37300) 94390) ((gamma 62613 cdr 93094 baz) (car foo 10309 53338 car gamma) lambda) 87526) ((item (16967 z 60090 10759 32360) (97862 71310 y 55641 6906 car)) ((13558 692 y 2357 7030)) (count (34166 67640 27476 35878) (79104 80639 53922 x delta)) 63074))) (item (63926) (count (((22920) (84842 z car) baz (689 y 40861 25278) (baz beta gamma 79746) (91321 gamma 89514 79214 baz 96950)) (beta (gamma 92876 gamma) (item 87877)) (40225 83618 (76992 delta))) 17173 (9346 ((40586 z 13702 item bar 79889) car 2970 (count beta item 25760)) 59935 (49967 car) (45678 (6497 12882 lambda) 93556 (11860 5427 x lambda car)) ((lambda bar delta) (baz) 63978 32404 (delta 84767 39588 16481 y 69768) (y gamma car))) car (((95284 14810) (47272 53234)) ((19133 foo) beta (58613 62641 baz 368) (alpha 9288 count cdr) (83826) count) beta ((foo 56919 bar) car (x) (67037 45078 54043 lambda z) (gamma 17111 19135 62368 cdr) (35419 11458 y 46345 40633)) item)) 83256) (foo (((cdr (76713 cdr 27233 -565 gamma) 79276) 35671 ((count 88483 8887 96852) 73020 (x 56746 987 89155) 58610 lambda)) (((652 13914 44077 x)) ((z car) (72191) (74722 item) (count x alpha 70035 22867) lambda) ((22150 count) 2106 (cdr 5274 z 63964) (69437 22262 y) (62214 car 30704 17772) (56728 30552))) (((77059 cdr) 94983 (77799 70586 baz) (foo item car)) 32152 (gamma (39825 61139 76623) (68487) 92729 (29571 car item 87356) (delta)) ((41112 gamma 4630 z 85506 bar) (2845) (alpha 43515 7525 8395 lambda) x (54044 -193 y alpha) (2468 bar 22448)) (car y (gamma 57598 z alpha)) 53131) ((item (90464 baz)) ((car alpha) (87681 61992 72212 80967 baz))) ((72675 (5380 baz bar) cdr 3011 (36909 delta gamma z delta -22)) 94701)) cdr ((((37197 bar baz) 10213 (alpha bar 98424 25616 22673 baz) (82958 baz 13906 foo) (x beta item count item count)) ((90973 60760 baz 78605 count 54567) 96843 (delta) (alpha 23377 car)) (item (delta 73663))) 15967) ((((16369 cdr 29639 baz car 26328) (foo beta)) (79933 (57063 33157) 26273 (baz delta item beta 62328 17709)) z ((71855 83032 x y) alpha (car car foo 59259 delta) 73370) ((beta 67556) (y foo bar gamma delta) item alpha (delta 81358))) (80651 ((car y z)) ((x delta 98231) count (34620 x))) (((bar count) 12702 (delta delta 27870))) ((beta (car z cdr y)) ((58852) (lambda item 52814 674) (59745 58027 gamma z beta)) (11782 (cdr 62737 count 9477) (6996 foo) y (item 98399)) delta) (57005) (((4785 baz bar baz)) (car (32746 count) (y)) ((bar 10957) bar (lambda x cdr) 32298 (55820 lambda) (29542)))) 38531))
+'(5885 ((((cdr (16191 bar item 68468) 8108 (34572 cdr lambda item 49889 57801)) (y (delta 22744 66570 bar 86862 18564) (-998 35044 car 2806) (lambda 38069 x 46792 92611)) (delta 20149 (45796 delta 61596 car 31470) (foo 89612))) (((x 19500 bar 57320) (72416 gamma 87330) z) ((39420 92562 56742) (85368 17706 bar bar 79574 97376) (z) delta) ((58672 count 1250 99541) x (item 3596 lambda 78234) cdr (lambda beta alpha 9435 delta 80125) (item 55488 baz)) ((alpha 50277 item z) cdr 95111 (item car y x 57167 count) (48980) (75227 44432 bar 51146 y))) 27371 (98271 ((36150)) (bar (gamma x 84341 68472 delta baz) (18404 57266)) ((33587 67503 gamma beta foo) (60573) (y car 55473 5736 64239) lambda (49238 30316 17816 beta) (car 55744 98928 82024)) cdr ((item beta) lambda (63770 18136 baz 62996) (cdr 30090 24764 baz item)))) 60229) ((1723 (((foo item)) ((19583 foo lambda 41466 count))) 21319 (50169 x) (((76585 alpha 33822) (58406 bar cdr y car 62992) (y) (37784 90027 32280 alpha -392 lambda)) ((94751 baz 23710 z z 45708) 43633 (27868 gamma 63765 8665 82425 car) (64054) 75601 73201) lambda ((57136 14346 z car) (31516)) ((foo) beta (lambda x 64579) 20418 (car 57970 8324 alpha 43460 y) (52474))) (((baz 98478 50891 23354) (baz 98268)) item (63161 (52444 lambda) (25163 36526 54816) (beta)) x)) bar ((((car x foo 18064 8010) (20328 beta 68885)) (gamma (34085) (73496 lambda 1282) (35344 8465 baz 24120) (car 60389 lambda 24069 foo) item) bar (beta) bar) ((y (35874) (80955) (car 33058 lambda z gamma 93209) 53825) ((cdr alpha foo) 63111 (13046 item 29518 foo 29136) (count 2860 lambda cdr)) cdr) (((24317 z) bar (alpha z 76359 car beta 44145)) ((31877 32651) 38668 (z 6946 x item delta) (beta 51658 23177 foo item lambda)) ((56027 2510 x bar 40058 z) (31836 68625 98924))) (y baz 74561 (56115 (15085 74881 17230 30033 y beta) (23570 77442 9775 97261 baz 33606) 38374 (alpha 76026 34342) (81480 47205 z lambda 89666)) (69258 32789 item)) item) ((((41109 28830 67297 14482 count) (79892 car car 71753) beta 16772 (52835 59007 baz x bar)) ((foo baz x) (54308 x z 43655 delta) (59983 delta) (x foo count 35980 z) (86825 84079 gamma z) (34437)) bar ((7285 item 50287 delta 47496) (cdr 17464 35551 bar) (bar 43670 26228 foo 54337 87139) (y 7113 z beta x baz) (40402 car) item) car) ((1199 (1732 1484) (lambda 26358 y 21036 85927) (67437 11290 10295 79137 94865 23669) (56989 gamma) (delta)) ((beta) (item 55777 65621 lambda z) (94974 74200 gamma 28460) baz 6521) (cdr 42937 (count 1712 lambda 71998 26003) (32927 baz gamma) (foo item beta))) (((count 29276) (x 75822) (2973 cdr z 9940 delta 33168) (58905 bar bar 33885 41433)) 31424 bar ((65671 94011 82554 cdr 20285 z) (5802 4832 6198 50686 alpha)) ((foo car -779))))) (((63218 ((delta 39908 x 45607 67230) (50864 alpha cdr 3363 alpha) (10338) (77142 26978)) 19416) 19529 32128 56448 (19111 baz ((count 7518 y 62732) (51801 71892 delta item) (delta 35322 lambda 31274 58365 cdr)) 37830 count ((cdr) 70895 z 18872 (cdr z 99676 77962 90981) (lambda 41879 22045 bar 84162 z))))) ((49769 x lambda (((96766 12753 alpha x) (delta 23194) (x) (cdr baz count) (96502 70266 43873 94446 car 17482)) (bar (count 14038 92765 79841) (baz)) bar cdr item -672) 68981) (lambda 79633 (((count) (44743 z cdr 52156 94731)) ((cdr 56653 car 61828 66832) (83449 29972 43268 40355 17005) (y) (65757 74430 25625) 25826 alpha) y)) ((((beta 19985 gamma lambda) 7233) (baz (85489) (62547) 80861 1454)) (45131 94370 car) (((cdr) (104 lambda beta lambda 49254) (cdr 17645 z) 96311 (x 57469 59558 count)) 3781 delta (baz 47051 (cdr gamma 85528) (item count gamma 89339 beta) (3598)) (gamma)) item)) car)
+'((290 86236 (car foo) (alpha (((beta delta car 303) (42499 cdr count 77065) (x 86384 57383) (74415 45952 78392 50298 gamma lambda) bar 20754) 9675 baz ((35894 count lambda) (item 31012 46921 alpha gamma lambda) (90964 car gamma beta 2336 48584) (33148 lambda cdr 47917 31783 5717) alpha (gamma 37562)) (foo)) 24583 gamma (((gamma 8677 62496) (count alpha)) (gamma 81141 (beta beta) (car) 98082 (19799 lambda 79699 gamma delta)) 83312) (((foo 97000) (93278 bar 60542 baz) (delta 97821) (18359 80104) 97839 31368) (alpha 12123 27844 y (89970 36793 y 3816 baz 10886)) ((46512) (84611 30343 foo 89659) lambda (count y 40689 alpha 13046 41106)) beta ((5202 43759 48942 37207 4494)))) (((z 48144 (y 47330 67571))) ((5326 (14947 foo 48407)) 84966 99601) z ((item delta delta) ((bar 2147 z 73966) 98589) foo ((cdr 58875 90573 beta item) (63311 gamma 68740 12289 76586) (count beta) (72371) (54297 x 54840 14946 gamma 16836) (34177 delta 89060 count 12858)) ((49970 car cdr gamma) (baz) (x 35942 alpha 16018 foo z) (beta cdr car count)) ((66823 alpha 7968 z car) foo (bar 29321 bar) (bar 9603))) ((3396) baz ((80044 47374 45317) (55686 foo delta)) alpha ((car) (bar 61381 61051 beta beta) (count 43733) (baz delta 52116) 87199 cdr) ((28265 alpha lambda foo 48282) (55646 23818 6008) (22611 foo 93344 cdr bar)))) 10184) ((alpha (beta ((55613 37263 85114 item 65985) (item 64427 27615 50028) 20020 gamma) 63711 (x 87792) ((86858 baz lambda) (65413 8975 delta -53) (3971 gamma alpha) cdr (62279 45106 38620 x 79677)))) gamma (32395 y count (((gamma baz) (alpha alpha alpha 78694) (26894 8481 66093 baz) (delta y 47383 62565 count) 37910 (lambda bar 13467 81284 20098 1027)) (84154 foo 42702 (lambda 22951) (70389 62483 count 55192 96909 x) (24745 13867 z item delta beta)) (alpha baz) ((count) (lambda y 97991) lambda (20957 x) (alpha 55360 80706 7435 29450 alpha)) ((44879 z 17530 89689 beta bar) (count 72512 99389) (z gamma 98071 24831 alpha) (delta y 64167) (3035) (bar 54786))) 26545 ((86423 (gamma bar z baz) (68559 27973 25759 15203 cdr baz)) ((79225 lambda 69800 bar 61998 31058)) ((23100 alpha baz 2102) (x) (x 39301 bar z alpha 52332) 92400 (lambda gamma 16004 delta 6243)) ((19512) (lambda z) 63830))) ((car (19701 (baz foo gamma) beta (car 65893)) ((28848 8896 baz 32857 89110 lambda) (lambda 89241 baz 76643) 90312 (car 17266 18798 39931 34678)) (item (45843 48596 26578 8294 lambda) (baz 60155) (gamma) (bar)) ((x lambda 51235 lambda) (96017) (beta) (count y)) (item (y 15273 30271 17194 48021 foo) (beta) (72232 83529 46626) (item baz gamma 22851 y))) (((13866 baz)) ((74084 74713 baz) (beta 87563 16520) 18609) (x bar (70044 bar 59068 z) (item 59269 delta)) z 20975 alpha) 58441) 21076 99691) baz ((y item lambda x) ((beta ((item) (y car 86318) lambda (79643 83192 27566 61981 33131 97534) (alpha car count bar cdr)) bar) (((4963 beta z 45705 baz baz) (70000 52710 69922) (34487 car) (baz 35531 81554 88058 48981) (beta foo cdr) (beta count)) 17112 ((17550 alpha))) (((82565 baz lambda 15098) 76863 (cdr 34893 item) (87188 gamma)) 2592 ((cdr y beta) (alpha lambda item 13871) 90162) (car y (65060 33264 y 85388 75853) (y 67639 y alpha) (alpha 88185 1223 99550 6205 item)) (cdr (97996) (foo car) (x 8432 87464) (72329 baz 77561 10054 alpha) (9675 94015)) ((83362 79047 bar car 48984) (15047 64050 31156 83113 91070) (bar 48955 10269 2161 220 bar) (35767 x 70261 11237 36230 82913) (lambda gamma beta) (4206 57491 x 68391 car))) (((74260 x foo) (77764 delta lambda) (foo) (95663 80745 91125 cdr)) ((36956 90616) (beta) z 682)) (((17658 beta delta car 81757 97465) x (item 89588 gamma lambda 86726 z)) x) ((lambda (y 26951 83207 48094 94141 60918) car foo (22368 baz baz cdr item 30657) (bar foo)) ((count 49763 cdr gamma) (82425 item 93617 foo 34325 6770) (31148)) ((16175 alpha 80275) 72387 (cdr car 6343 64021)) ((beta 85617 1603 78435 cdr 1674)) (46173 14517) baz)) ((((y) (50051 40461) (lambda 778 y x 59890 62718)))) y))
+'(82673)
+'((cdr (beta (y ((67408 68969 bar 85282 count) (40240 foo lambda item beta) (37594 1 lambda)) ((car) (z 19718 66616 28902 x 16793) (1097 cdr alpha gamma gamma car) (z 30022) (87166 alpha) (74340 alpha 19020)))) cdr 80894 ((((cdr) 46204 (91918 gamma gamma 62039 89585) (70467 y 23369)) ((98300 50674)) ((5302 81936 14913) (alpha) (84863) (18201 79888 92744)) ((delta 29405 25198) 77314 (delta 5111 item 98703 -542) (50489 y foo x 16873 x) (item 48180 98729 23816) (baz 65517 cdr y)) (29285) (54646 -826 (12887 delta 99154 cdr))) 89112)) 26890 (alpha beta (beta (23996 cdr count 17092 ((81631 79345 69966 item) x) ((baz 29823 beta 59775 44952 85414))) z (309 ((car cdr item z 35828) (69915 beta) 12551) 83621 ((52567 30718 gamma 83472) (foo)))) car) (((((car) (baz baz 34698 lambda 53262) (17125 z 98623 car 26528)) lambda ((y) (foo 71541 42056 item) (count baz beta x) 5326 (43259 gamma 24933 46087 46832 7487)) ((76462 y item 55092 40346 foo)) beta) (80531 ((gamma) delta 32195 (46251 gamma 31783)) (y (1939 44523 y) 81031 (90304 81542 61963 51336 car alpha) gamma) cdr (7635))) 78235))
+'(alpha)
+'(29195)
+'((((((car count 84511) (z 5414 24091 lambda 92861 item) (z count 52572 cdr beta beta) (28913) gamma) foo) (((item lambda baz 57179) (item 41523 56557 50791) 3040 (beta) (item lambda 68192) 95189)) (((x 53923 28466 39011 66331 z)) 49214) (((car gamma baz 95284) (x) (beta 37427 alpha foo delta) 10168) ((76031 bar gamma 21189) (car 57806 12229 79069 x) (14952 21317 baz bar y) (9232) (83160 2157 x)) 5184 (90625 (71610 car foo) (45099 83778 15647 item)) (x) 28209) ((count (15833 77572) (44074) (65621 86421 count) (41537 baz) (22283 delta 75802 item bar)) ((beta car y z) gamma) 49763 item) 14936) ((((79485 gamma -592 19231 foo 97037) (98372 24848 22049 5867 lambda) 6118 z (59621 foo 31256 y z 17869) (91438)) (32680 (beta) baz (88617 45367 x 60423) (y alpha 74126 delta bar baz)) 80180 90654 (77379 (39464 foo gamma) (68404 53948 beta 73827) 12979 car (50943 29837 bar)) 8445) ((30561 (bar 56565 lambda) 60751 (item alpha alpha 14729 bar) (beta 89690 25842 x 57323 item))) ((25319 (gamma) (z 53493 beta 69844) 6306 (delta 76534 beta gamma beta 43870)) ((20960) 94049 (28287 38580 16256)) ((y 64565 32712 foo 90058) (3479) bar foo (87616 85534 26795) 2974)) 86614 1075) ((((39714) (z 39692 43405) 1133 (15475 7124) x) (z z 75578 (-229 cdr 89403 28018 bar 45507) (24227 59903 baz car z) (x 79319 75713)) baz) (54505 ((x 51929) (alpha 46203 cdr cdr cdr) (89016)) ((7029 16076) (bar alpha 76494) (51169 47527) (64137 74726)) ((cdr x beta car) lambda (gamma 62420 cdr) (cdr 38133))) (40015 ((59368 x) (lambda beta) 25961 x 80378 (83670 95372 30753)) foo) 82579)) (((foo (4407 (y 39083 lambda car x baz) (car gamma y cdr) baz (37861 12787 88230)) ((gamma 13897) 76834 (18959 67202 82966 8712 76984) (24153 49590 cdr 74405 29131)) ((foo 35653 9376 gamma 30950 beta) (car) 88403)) beta ((87301) ((13997 5174 14832 96197 76282 79193) (37576 51689 beta)))) (delta (23545 94661 (52624 (52158 z 46938 83018 foo) (21235 37760) (34438 bar) z foo) ((item alpha 60340) (count 10073 item 69036 97965 cdr) 71680 (44256 75486 29588 gamma) (4111 y foo item item item)) 21804) 6803 gamma) (beta car foo)) (((((44670 79566 baz 37824 alpha) (count baz car item) (car 74190 6417) car (gamma x 37053 87956 81042) (beta baz))) (((gamma alpha) 8969 (78348 65145 item) (57348 17843 lambda 95916 58845 4534) (car)) ((gamma) (55189 94685 24089) cdr (88529 17248) (delta baz) (baz bar -403 41899)))) (99231 (80319) (((y) (20904 foo delta gamma)) ((87893 delta)) ((item foo 77847 alpha car 29675) (73915 18507 40988 car) beta (car cdr y y gamma)) (y (z 67449 76789) (beta car 7850 count) (car cdr lambda z foo 93339) (15458 y beta 30887 baz))) ((gamma) 43518 (72713 4401 97390 61123) ((y 79036 x 4819 count) (83797 21364 15526 20295 lambda) count item (76852))) (bar 28239 ((alpha) (51509 gamma 40894 49842 66353 z) (x foo lambda 8737 18337) gamma 74968) ((88200 x 91780 69057) delta (alpha 33466))) 92960) ((((alpha 96334 item 60208 86131) (52339 cdr 90699 49503 foo car) (68160 gamma 41502 34197 bar) 5493 13903 (item y)) (delta (44703 38314 car bar 6746 97830) (lambda foo)) 96668) (x 93784 64793 ((delta 93491 z) (x 76301 45869 94841) (37164 71397 31637 92853) z (y 28704)) (12547 (72124) (y gamma) (73594 item beta 12265 80196) (delta 69660 foo beta)) (gamma 29746 (78925 74756 4489 x) (65258 beta lambda 26010 67368))) (((37969) 46859 cdr)) (((alpha 19701 lambda 83416 gamma 2573) (cdr) (89367 78195) 7964)))) 32118 (((((49346)) (93510 cdr delta beta 31096 gamma) ((z 76832 z foo 30150 bar) 53135 (69018 x alpha car 85102 23008) y (17675 26418 z foo)) ((37555 68369 y) (80987 y car 66680) count (lambda 42987) (x 54898) (y 33033 93566 11913)) (22637 (82146) (70983 58780 47595 45279)) (44531 x (98793))) (86963 ((27050 66837) (x beta 26407 cdr 86844) 93427) ((bar 58859) (delta gamma 98863 24640 63801 10227) (car y 85062 52715) x (63939 x 45271 y count) (96067 beta y 35995 x)) 10698 (11103 23205 (y z baz 22011 y) 71269 gamma (count 27188 82287)) ((cdr cdr 12770 31660 8850 32352) (24426 car item) alpha bar (92870 x))) (((x 70926 delta beta gamma 96766)) ((baz) (z car 43415) (y y item) x)) (11148) (((93190 37000)) ((48437 38187 29873) (foo alpha) (2327 90537 97048 baz) (48448 baz 88223 count 78233) (beta 49274) (lambda)))) (53261 (((delta baz 1626 38581) (z 44373 12740) (-136) -991 (98545 36001 count 3613 98520) (57404 82418 19304)) ((63290 72738 34711)) ((bar) (z alpha 7111))) 52523 (gamma ((6133 44643 29993 50062) (x cdr 78699) (count foo car 36776) alpha (delta) (68248)) bar))) (((((88323 63846)) ((84849 1265 22247 foo x 53901) 11763 (67867 lambda) 45864) bar ((cdr) (gamma 36639 73044) (22372))) (84751) baz (((68883) (73454 car lambda))) 13058) ((x ((z gamma 20795) (gamma 73428) (90142 14253 23500 71019 lambda) (lambda 65369 14961 13573 car) 44952) 49566 85563)) beta (566 (((x gamma alpha)) ((gamma item) (67905 50674 foo delta) (85161 beta alpha gamma 3672 item) (item)) ((51116 63072 36389 96924 68833) (beta cdr x) (24490 17087 1822 x count) (53868 28774 73602)) cdr y cdr) 14775)))
+'((cdr count ((((car 94701 83628 lambda) (baz beta lambda 10096 80328) delta (13862 26854 66102 beta item) (24115 car 11513 baz 42710 50142) (96613 78364 y beta 87693)) (count 72710 (63554 87420 baz cdr 90558 y) (45167 alpha 3460 gamma 72703)) ((count 96058 beta)) ((25194 81823 baz 25657) 80213 (33504 cdr z count) (88287 34270 y) (95561 count) (cdr y 66855 57156 5393 54164)) (19767 54488 (15154 79299) y delta)) (((count beta alpha 78505 cdr) (gamma) (27460 47204 bar) (y) 6134) ((93261 30079 beta)) ((gamma x baz)) ((88452 76464 lambda 74626 84363 delta) (81647 64540 32283 14169 41899 35758)) delta count) (((cdr 4544 gamma car) (46517 baz) (13222 x 23114 y 30386) (60165 x 6369)) ((28445) (count car) (50935 23703 41505) (x)) 96745 ((82443 x 6930) (x lambda 82529 59519 81202))) (((alpha 10488 4247 lambda x) (count) (83245)) ((3698 car x 79792 bar) (41341 6652 12281) (51275 delta 9797 86636 delta car)) (x (52476 item -461) item 11270 beta count) ((43343)) foo)) (((lambda (60111 gamma 67685 car 83246) (10952 45232 cdr car 74464 beta) y) x 39060 ((count foo 36484 25188 32406))) 53711 (((58398 76674 beta 96856 4741) delta baz (bar 87978 bar cdr 62313 foo) (y alpha count 32449)))) 63784 58964) ((((x (cdr count 76979) 64516 y) (58724 (item 7607 foo) (81831 44480) (baz lambda baz 53247 count beta) (x item car delta 97050))) (car 57548) (((84142 baz cdr) (28204 53927 y bar cdr)) (x x bar (item gamma 41533 97200 foo) (33128 delta delta 50475) (32938 18919 83362 50020 32508 45670)) ((y foo 81024 16637) (x 26826)) ((bar 10034 4119) 51694) ((count baz y x) bar count)) foo (baz)) ((99870 ((cdr 8510 cdr foo) (gamma 61601 cdr) baz) item (alpha)) (((delta bar 8170 58103)) (74688) ((foo 25941 bar y cdr) (40093 alpha 48527) 81460 (99824 52310) (66946 79979 car beta 11680 19311) (cdr 39500 14156))) (29074) (((cdr beta 35903) delta (gamma 10702)) (alpha) count)) 15992 ((((90553 lambda y) (38023 alpha 65208) (alpha)) 11268 ((y 76906 beta 24968 baz) (82841 53421 20840 x)) ((item 72463 car) (45991) y) 3887) (((52348 65642 y 47933 80161 alpha) (cdr 56320 car 44587 bar) (y cdr) (lambda car 91737)))) ((foo ((item item) y (58453 36563)) ((27599 1387) (5242 count 80997) (lambda 80940)) (93436 (lambda) (x gamma 28052 73138 75779 36660)) gamma z) (((beta 79735 75021) (foo delta) (3862 gamma 33577 delta)) ((z) (x 25908 y count foo) (85791 alpha) (cdr 2730)) lambda) ((62887 (count) (5694 77740 z 14591 11487 baz) car 5951) ((41625 baz delta 4505)) count) (cdr (51352 (76139 lambda delta delta 32589 cdr) (36889) (bar) (y 70822 15670 9320)) (4251 (y 65478 80138 baz item 47766) (gamma 95007 24297 item beta gamma) (beta) (80617 y 91938) (beta alpha foo foo))))) (17542))
+'(delta)
+'(((lambda) ((((foo foo 7967 56050) (53357 foo delta item) baz) ((cdr 95404 30710) foo (18223 bar lambda y 24622 36540) (75485 19408 63529 bar car 57103) 49051) lambda baz) (((y 46720 cdr foo 70848 55245)) baz (18388 z (7535 19828) (41006 29714 item delta)) bar ((53757))) (((20380)))) ((((foo 29556 baz) count) (21170 (45667 10745) (63841 84260 bar) (baz 40971 65885 x item lambda) (92881 43265 90860 baz)) ((25469 46471 delta 27759 item 70984) item (bar 40546 56521 baz count) (beta 43986 31630 baz 72689) count) (5608 bar (cdr car 25338 cdr)) ((34578 41323 73579 cdr 29465) car (car 96037 bar 1027 lambda))) ((99972 (foo)) ((90659 58138 beta) y (1158 baz)) (24295 (76395 77720 60049 beta gamma 81973) (70652 35821 foo) (19897 lambda 47444 36647 count 31421))) (((29998 count 74796 57815 53773) (x) (bar car)) (35603 (alpha bar 41242 lambda 92311) 35124 (alpha 37532 93737) (bar alpha 4343 z 1777 96221)) (alpha lambda (66282 19838) (84554 y delta) (z delta z 18585 60166) (55655 car item gamma baz 43726)) (49035 (39118 54368 baz baz car baz) (count)) ((59091) (lambda 7739) (318 count) (y 80456 car 92295 beta lambda))) (((49509 35149 28783) lambda (2554 140 72357 45875 22530) 29752) (49744 (z) (15764 3673 86432)) ((cdr 74180) item 54531 (18154 33368 alpha) (y lambda lambda item)) (77466) ((item) (count alpha car) 46410 car)) (((93571 84620)) 76393 92313 38019 (lambda (item))) cdr)) alpha (((delta (78414 (car) (61386 alpha 77969 89710) (88948))) (beta alpha (82402 (43848 31282 29585) (count 48717 foo 85701 64690) (lambda 49740 gamma beta baz) (gamma z lambda x car) car) ((34331) car (63321 beta) (delta 98992 11199)) (car (y 65052 z))) (gamma (81754 (baz lambda 33338 alpha bar 53497) 58178 (beta x 90832 20987 12287) (22018 lambda 68378 49938 lambda 90062)) delta)) ((count (foo (cdr) car (43187 baz 34905) gamma) cdr ((beta) (count 53587 78296 cdr) (y alpha) (24687 76502 3797 car item) (-176 z 59004))) (((alpha foo y 81518 94283 z) (4619 alpha item) (41105 lambda beta) (baz bar 93782 gamma z) (59134 74455 y 14106 57279) (foo 37262 30333 baz 46654 39807)) 37984 z ((7688 73880) (count 67603 78967 14533) (62332 8102 lambda) 94620 (4242 y 86857 car 68731 car) (x count 91872 47680 72376)) ((beta 31427 delta) 36216 (baz) 54282 (4083) lambda)) (((66489 62049 65419 6183 17690) (42466 beta 47031) (37370 lambda) (item y item 45679 25909 delta) bar (beta 14953 52673 bar 69285)) cdr ((y)) 85579 ((86869)) ((26790 49629 gamma 44943) (88186) (lambda 85963 item 98981 item bar) beta (z 38600 57832 gamma bar z))) 89763 (((bar cdr) (x count beta 43307 car 24061) (gamma y count count) (2640) (75643 item)) ((lambda 38616 alpha item) (17797 11498 delta alpha cdr) (foo z 87613 car delta 95660))) count) (46507 (((35490 count) 80666)) (((count 30685 car)) ((89668 20900 count 13903 67754) car) 59481 80806) 38764 beta) 88638) (z z (y) ((64202) (((item)) ((7292 beta) (count 62538 bar item 86549 beta) 19766) ((car) (59650 25191 cdr 57765 46278) (beta car cdr) 33570 59512) ((item 45663 gamma)) ((x gamma) (91394 delta))) 82904) ((((42721 31497 gamma 37712) (car foo x 42848 count)) ((27643) (z 18273 32050 baz) (alpha 5664 17605 alpha) 19054) ((item) count (32729) (delta item item) 87510 (z))) y (85305 (71308 (31028 gamma) (baz 81822 50608 baz 12756 lambda) (z 92840) (48489)) (29055 63737 (y 35604 baz) (93663 item 91999 27775 27422 31681) (32131 item car)) lambda ((alpha) (baz) (foo 88068 lambda 94829 lambda)) (foo count)) (((15656 90939) (bar) z 26373)) 86325 (((55539 71275 36723) (beta delta) (79544)) ((item 51671 96077) (73665 beta 5217) (93602)) (45910) car ((39059 item 70069) (33148) (item 3259 30236 4523 y) (29002) (item 60571 bar gamma 52776 x) (foo 5442)))) count) (((((4058 85921) (1399 53915) (30926))) (((bar foo 57280 baz foo) 70997 (lambda delta x x baz)) (z 90454 (75097 delta 98315 count) (35776)) (15085 (alpha 25026 alpha bar) 55937 (27334 15655 93529 baz z)) foo 33999 ((delta item baz) (10760 alpha alpha 63868 bar) (79848 19367 80801))) (49703 (94107 (y) (bar count) (car 50928) (57204 97777) (item))) (((bar count)) ((30393 17547) (baz) (98349 12001 count lambda) 39043 bar) (38253 (51101 alpha 74985 69936 17694) (38923 z foo) (alpha 87918 20620) (baz cdr cdr 76460 40820) alpha) ((foo 22505 alpha 14751 45535) cdr (cdr 61538 36346 31732 10283 y)) ((x 77173 5987 lambda 13387 40491)) (cdr)) (((delta) (60648 36308 44259) (82225) (car 99232 57538)) ((45595 foo item delta 98875) (lambda x cdr 25143 10850 10988) (901)) ((beta alpha x 48750 46524) (x 20288 beta) (alpha) (foo)) ((11223 baz 25881)) 70297 bar) (((43456 58070 31584 70757 count) (count cdr 31495) 99618 (count)))) z 67157 (baz (((y item alpha 81126 cdr) (36269) 25619 lambda (z 45034 beta 7081 99811)) ((delta x item baz 33258 26560)) (8095 (x x 12332) (6416 count cdr 68874 40324)) (x (53797 cdr)) item) (((18174) 93074 (x foo bar)) ((93408)) ((x y beta 56271 61891) (delta gamma) (97607 59865 11514 baz 12326 baz) (98957 76930)) (73893 8715)) ((y (31465 z car cdr 94589 91922) (89129 55682 count delta x) 82960))) ((74552 ((89753 beta beta) (alpha) (34040 alpha 5398 64883 34086 bar)) (z foo (97932 72061 delta count 53214)))) lambda) cdr)
+'((item) ((((alpha (97673 31767 beta 50870 baz 32963)))) 64692 (((51898 (75478 cdr)) delta) ((38800 91063 (62482 13288 bar baz delta 82126) (beta 61963 alpha 8519 88497 x)) 43656 64567 ((z) (beta cdr 69719 83538 44474 count) (car delta 68558 gamma delta 53107) 41057 (car))))) ((((89578 54881 (baz car car car)) ((77435 count baz gamma car)) ((60547 gamma) (y 63893 x 95968 alpha) (car) (foo) cdr delta) ((84984 foo beta 51830) (x z 84630 z foo) (gamma 55821 gamma 54755 beta 21473)) ((alpha) (alpha item) (84488 93043 76958 58076 car 47422) (item x delta z 95133 foo) (baz) (7477 car)) ((77745 lambda 52493 88636 bar z) (delta count 53311) count cdr (baz 45414 foo foo car))) (87548 ((20478 z 8885 count 68905 beta) (beta 72343 item)) ((foo 89423 beta 62141 delta z) (y))) 55427 (lambda count ((48482 65460 item count 57932 82540) (1701 item gamma 68717 car) (89678 33225 80024 62166 6557) 7295)) (27191 (71043 (z x 14741 beta 47581 32310) item (beta count alpha 95490) y (x)))) bar ((((37684 99004 18361))) (((65271 86013) (51834)) ((74257) car (22523 baz 71417 foo baz 36238) (6433 x 63098 bar 74099 beta) 28551 (59718)) (73915 (delta 28182) (21442 21662 foo 60520 beta cdr) cdr) ((bar item) 9227 item baz (39119 70785 -805 12654 z) (85031 baz 98131 cdr)) (92647) 36337) (car ((alpha foo)) ((bar bar) (54364 alpha 84878 95881 60727) alpha (4985) x) ((20616 bar) (2235) (73702 x item 5221)) (16914)) 34013 (34393 ((45488 item) (item y x) (59029 delta count 45296 y) lambda (gamma 30037 64367)) ((53866) (49946 lambda gamma 81506 23584 60149) 23744) ((x 92280) 32514 74050 (34715 y 88299 16416 12035 82185) 7014))) x) (((15806 ((cdr) 15975 (lambda 79965 88921 6830)) (count (y delta 29751) (59962 44929 59541 64440 beta x) (98800 z 15045) (69525 39358 alpha cdr 37072 78931)) 60808 count ((76862 7096 31313 y 56863 foo) (83398) 56051 (36966 80668 30620 43034))) (((72217 y x x) (lambda foo 75004 count 19764 65577) (foo alpha lambda 90640 gamma)) 60701 (26037 (97698 y 4997) car 75785 (foo count 26723 87560 x car) (13638 98682 31509 97418 z)) ((88276 9055 5910) 73873 (77621 16539) delta) ((beta) (car 52425 z) count) ((33761 bar 37933 83151 41861 55696) (36716) (foo 7193 31663) (64307 51826) (bar 14266 y car beta)))) ((((5610) 82815 (28184 count beta baz) (z foo) (car 20647) 61523) (alpha (47391 76766 34941 68525) -387 (14610 x 58351 car gamma) 55507 cdr))) 85264))
+'(x (((((5946 95546 3208 count 48672) 51457 (delta 19353 alpha 3106 32863 lambda)) (35697 (38009 bar alpha 11588 bar bar) (baz foo)) (beta (beta beta bar 77630) (bar item baz gamma item) z (24767 25896 gamma 46006 lambda gamma) (7466 y item cdr item))) ((foo) ((baz 17451 delta) (69357 foo z) (2547 51326 gamma cdr x delta) (baz bar 74874 delta 97790) (58841)) (car 67606 (13014 47296 car bar) (66167 beta)) ((bar) (80828 32848 foo gamma) (23035 23445) (62059 50426 89576) (z 91290 41926 z)) count ((15728))) z) (alpha (((79658 car 41352 baz baz cdr) (12447 99283 beta -574) (beta) (80529 count baz 79796 46878) (count y)) ((z 24509 73196 15087 gamma car) (37135 car z 30708 beta) alpha) ((car 2338 x 21182 79527)))) 81011 (22871 (((42049 21264) baz 1162 count)) (alpha ((x foo)) ((z delta y y count) (19053 83198 z baz)) 49056) (((86970 98073) (80107 bar item bar bar baz) (x z alpha x) (51903 delta 73957)) ((12415 alpha 73343 56252) (cdr lambda 99249 52872 60533 z) (37467 81297 lambda 95059) (car)) 56749)) (46586 (item (86255 gamma (58953) (gamma 9976 delta baz beta 78047) (34308 27305 gamma -764)) ((x 44587) (bar 2973) (item) (48863 delta cdr) (alpha 22256 9310 foo count 27008) (34690 3990 61574)) ((28643 beta) (baz 22664 84770 x delta car))) (((cdr 57713 34118 5263 count)) (54648 z)) 46848 ((bar) 95809 ((count) (76911 gamma 47302 lambda 43309 96221) 68573 (foo 47098 beta delta) (29187 51511 delta y z) lambda) 55746 9423 (lambda)) x) (31236 (81881 752) 96387)))
+'((alpha (delta) z ((((car z item beta) (76543 y) (97370 car)) 81058 (alpha (y 20690 baz y) (23326 delta alpha 55963 56505) (92517) (58729))) 92843 (75454 ((8922 baz foo 93615 73782 foo) 73734 y (84883 z 87068) 25100) (47030 (25758 baz car item) (foo) 80971 99583 (81798 beta baz beta bar)) ((alpha car 30631 2397) (35655 lambda 59826 cdr 36447) (46706 beta lambda) (60609 alpha baz z) (3869 9272 y) (gamma delta 43410 alpha 92680)) ((baz 91665 51352) (cdr) x (count 31038 gamma car) bar (alpha z 94015 alpha 21865))) ((count (car) (y 53863) (z 91808 beta cdr 17880 alpha) (bar cdr 71965 baz z baz) (item 19701 58948 2920)) ((23126 42554 car 87064 gamma) (54284) 14472 foo) ((lambda y 24817 2389) (car 84265) (foo cdr) car))) (foo ((gamma (51781 alpha 58855 18435)) ((52021)) ((bar lambda) (lambda 40826 27392 item 73529) (y gamma y baz 71391 cdr)) ((foo car 8899 count 88229) (65632 foo 63422 bar 43619) (y item baz 64258 16167 11729)) ((12292 x 23759) lambda (baz z) (27069 46899 y delta car cdr) (23333 85622) y)) (((bar alpha 95629 99373 37701) (24361 36974 bar) (52026 30653 count cdr alpha)) 84036 (88554 12240) lambda ((68906 car) count (delta 76172 x))) 46986 (((baz 28989 item 99944 41017 lambda) (x z 92999 85866 beta 40548) 4612 (12758 y 4529 51566) delta cdr) ((74879 80071 car y x 61458))) (79457))))
+'(delta bar (cdr) 40664 (((((beta y 89232) (98392) (5413 7986 y bar 35418) (cdr car 65385 30357) (alpha y z z gamma) (x 43221 count lambda 41813 82880)) ((84926 x)) ((98259 55207 17513 21004) 46257 (delta x foo gamma) (91627 cdr) (count 14340 x)) 23597 bar ((beta car 18965) (car 34238))) 10624 ((gamma (75822 40875 1760) (67872 79717 x beta count item) (gamma count alpha 39525 57720) 20250) ((65634 99757) (beta cdr 64532 94338 72327 count) 11303 (9715 25355) (y 48997 bar) z)) (85905 (83350 -482 74805 (96178 alpha 39861) (49369 item bar) (7445 car 4811 item lambda)) z ((foo) 8980) ((lambda 54747) (bar 42897 45399 lambda cdr) (17043 98574)) item) 70178) (10283 alpha (((54692 alpha) (lambda y 63602) (z 47045 baz 43571 baz 60366) (alpha 66823 56216 z))) ((beta 77036 26960 (count alpha bar count)) ((count 53278 3253 beta 41583)) (baz) (x beta (71127 item 74441 88937) 74040)) beta) delta (83829 (((gamma 45253) (count count 6993 y bar) delta) ((62381 y count) (40045 cdr 84693) 57147 (12029 delta 11961 z) (baz 36445) (foo)) 11636) ((62491 car y 76558) ((foo lambda) y (cdr) 80473 (83277 40234 x 52530 64567) 93689) ((88329 26919 lambda -56 81566 lambda) (delta 10819 cdr baz) (baz 61889 bar 75292) (count) 34609) ((foo delta item 5637 car) (54245 item) (delta 78579) z lambda (33868)) 73586) (((19319 alpha 34898 item) (z 70476 58509 cdr 8310)) 30270 ((cdr 48305 delta x x)) (count)) 46240 (((78314 car 29918) (97299 item) (92128 z alpha 23217 48128 beta)) ((delta 49002 item item x) delta) ((bar 87700 cdr) 39706 (x alpha y 47173 item) car (y x) (bar beta count gamma alpha)) (beta (car 53696 92733) (delta alpha 53715)) car))) 45841)
+'(84404)
+'((cdr ((beta) (((cdr 76772 10135 66717 x 25093) (86406) (57359 item) (5780 cdr foo 65014) (y alpha 15427) (6787 x delta 14358 item)) 35531 (delta 31881 baz (17007)) ((item lambda item) (x 56115 count delta 63534 beta) 31374 (21927 88526 count))) (((15010 24601 67909)) ((-577 bar) (23996 141 alpha y 67299) (22452 item z) (80645 53772) (count count y 21392) 28847)))) 85176)
+'(75457 (lambda z) ((((alpha (gamma 8187) (foo 38413 54271 34260 87962) (42435)) ((80300 delta 97592) (bar 57228 bar gamma delta) (car cdr baz 30685 2429) count)) (91199 alpha ((59443 81965 39001 cdr item cdr) (cdr) (foo) (baz) 70561 beta)) (((9997 37424 63057 38445)) ((21203 31207 754 car 44289) (car lambda 93452)) ((item 60460 63362 beta) (85192 29503 53862 cdr 62972) 69844) ((59263 62430)) ((9762 lambda 35180 52144)))) ((((baz) (75252 34908 lambda bar lambda) beta 4103)) (((delta beta cdr bar car) 87189 (83269 72468) (53777 alpha alpha 82852 30282 z) (32574 y lambda 84954 5090 91659) (cdr 32473 91197 67457 45585)) (y count (36421 alpha 76882 x 70699 92050) (alpha foo) (foo 47129 45450) (44110 26961 96223 85546)) 56440) ((lambda)) (((y 44825 48138)) 47462 ((z 86815 car) (baz 13180 x 91803 74592) (90787 24053 11183 68306 alpha delta) (37532 23498 cdr delta) (16525 97089 26086 bar lambda)) ((item)) ((21551 5677 64525 -781 79952 z) (z) (car 71874 74016) (12826 x beta foo car) (6113 63024) (23434 beta car 10317 87951 foo))) (33221 1391) 26995) (car (((count 66743 lambda) 54036 47875 bar (70188 y delta y 53935)) (bar) ((91487 car 41542 56937)) ((y baz 59612) gamma (68401 81015 z) 35732 (alpha 58473))) ((bar (delta baz 6809 car y baz) (23159) (97537 26479 x baz lambda) (foo)) lambda ((gamma))) 1483 (((48086 76676 cdr 86362) (87719 69450 bar)) ((67561) (count alpha bar) car (9773 item) (beta 41340 foo)) 28283 car)) (count ((bar (42759 26591 foo 20739 52476) 95605) alpha) 44124 (((72327 79472 43005 bar) (74035 beta 88485 x) (82136 beta 57458 gamma 66423 88254)) ((y 76114) beta gamma 2039) (count (61056 66690 z bar 37714)) 50683))) (51748 ((alpha 75434 cdr ((83022 82460) bar (z 15658 foo 53635 22757 -569) delta (51602)) ((83062 66789 count lambda y) (beta count 40718 71122 85418 cdr) (43370) (31624 cdr 36345 foo) (3358 88547)))) z ((alpha 75240 (delta (8834 foo 43382) (54922 x 831 count 96375 z) (delta gamma 96848 71303) (y 66209 car cdr) (alpha 94677)) (alpha))) ((gamma item ((count 72977 38203 cdr 61898 71819) lambda (bar count z 42861 delta gamma) (70618) (beta gamma bar 38185)) ((9023 37887 386 22871) (62910 45815 35550 66366) (36475 52918) (bar 42149 x beta 75171 y)) (cdr (82117 beta) (alpha x 16614 30796 21897) (baz 82355 12947 35587)) ((y) 60233 (66978 alpha 7844 alpha))) (((19582)) ((42178 63872 9722 cdr gamma) 14075 lambda (count 19047 foo 30464 44081) 71163) ((44653) lambda (lambda 67491 43315 z 49244)) (60966 count)) 13972 (44213 x ((foo 28570 delta) 73791 (57171 54358 85043) (58572) (35877 33066 28388 car) (item 35363 3385))) (((12242 y 1673 40775) (85262 35801 y cdr) (alpha) (73206 alpha 70124 x 56567 gamma)) ((item z car x car) (car x foo x count) (foo 55930 count 63921) (78227 beta 83636 60605) 40184)) (y)) (((45829 (foo beta 73062 lambda -247 bar) count (foo 11587 10875 lambda 34782) 50735 baz) bar ((cdr 67520 8661 item) y (delta 93785 count z bar 49989) (delta 59667 item bar z) (7920 96182 bar z count cdr)) (car)) 78741 (((97342 x) (96154 51045 z car 76177) baz) ((48746 beta cdr) (13360 75675 82661 y 2341) (68500 14439 27686 31632 63558))))))
+'((23745 ((z ((x 57903 y count 16851) (bar 65096)) ((39465 baz 12508) (21142 y 77309 cdr) (lambda car 12292 66418 88831) beta (80859 19144 59324) (car 29775))) (((93826 80870 76942 y)) ((foo 24041 31497 48184) 2233 (x 56634 gamma) (73245 79935 98857 25154)) ((delta) alpha (baz y)) ((item) count (x) (38954 cdr 5905 count) (count lambda 85367 56559 74170 count) cdr) ((58912) (19715 foo 6714 52020 72725 item)) ((x 89317) foo (gamma beta 62433 66872))) (item ((12377 x 47328 x 7125 2009) (93586 bar 84523 y 93210)) ((77803 car baz lambda alpha) (x)) (92823 (87597 83960 5686) (1485 12149))) ((37483 (56247 count 28313 16781)) ((52372) (item 87311 18386 cdr) (87592 97054 88743 item 2464)) (78827 (21957 item count 17335 beta) (6507 z) (alpha 62042 758 alpha bar)) (x (82045 69066 car 47220 31926 y)) (9628 75294 foo (z 1390 67018 baz)))) baz) (baz lambda (70022 ((87301 (35206 67678) (beta count count)) (count z gamma) car ((gamma) (x z z alpha 17570) foo))) car))
+'(91838 baz ((y 1276 ((85913 (beta) (88825 3047 foo bar foo foo) (59987 gamma item 39337) item (item gamma cdr delta)) ((47244 50221 55748 40207 z) foo (count count 22469 620 count lambda) 51843) (18338 (x 61714 2464 lambda delta) (33660 delta alpha 89484 delta beta)) (x y) ((28918 baz 24070 beta 52122 car) (91254 61950 5047 20962))) ((cdr 63841 count (z 95580 foo 2342 y alpha) 38100 bar) (94458 93764 16807 99622 car (count z cdr z 3587)) (59795 (88981) (count 12388 x) (count 29078 85287 28354)) (delta (-546 60390 foo item lambda) (baz alpha item) (26090 beta 87729 67241) (z 65413))))) 49667 x)
+'(93969 (79316 beta))
+'((((((x 21435) (34162 63232 z) (25610 car 47334 z) (beta 54509 lambda 98221 item) (9125 28512 beta) (94650 4413)) 6606 ((43167 15377 38667 70794) (47475 foo 87992 baz) (97560 lambda item 24350 36258 bar) (45529 foo 60577 gamma 62779 91781) gamma)) (foo ((foo 17444) (foo 42302 89747 cdr) (alpha 9379 z cdr 56474) baz 38997) ((78871) 5710 (alpha 95705 lambda car 67309) (88227 88378 3124 cdr foo x) (x delta 84140)) car) (((count 61051 gamma)) ((count gamma car 63367 -420) (12734) cdr (z car) (delta 54858 18978 foo) (alpha 57116 49904 -84 198)) ((bar 83188 12281 47183 21465 delta) (bar 88702 62495 delta) (count cdr 59567 alpha) (18888) (x gamma))) (((delta 39468 87986 9137 alpha alpha) (cdr 69684 -327) 74816) ((y 22892 z 61525 54208) gamma) ((95056 94138 beta delta) (20869 87073)) ((cdr 26468 85140 96255) (74113 10459 81673 lambda) 63763 (81521 lambda z) 13578 (72462 y car bar)) ((delta 26549))) gamma (((32970 80061 baz 21929 beta)))) 21854 car 54012 ((lambda alpha (18421 24118 (70905 beta) (lambda) (alpha gamma 49743 item) (16956 count bar 48884 x 66366)) 38526 bar) bar ((lambda x (45996 item 77601 baz 2198 76678) (x) 22382 (lambda)))) (gamma ((lambda (delta item 33717 lambda 64043 x) (beta))) (((car y) (item) (y 96283 count))) beta ((baz lambda (50586) cdr (x y cdr 11619) 11288) 31894 (delta (41759 count 46789) (65486 alpha) (41472) (70207 17607) (item baz gamma gamma delta)) 94392))) 81159 (12635 ((((count 81020 83722 bar 63239 bar) (alpha 92972 delta)) 25150) (gamma ((lambda lambda y 11168 x bar)) 53901 77088 (4853 (beta z lambda 56178)) 10571) item) ((93622 ((x) bar gamma (delta cdr z delta 28326 count) (33865 x))) (((43101 -190 71782) (36878 96077 count 51038) (item car 90716 12506) (alpha count) bar (alpha bar 10588 22937 foo y)) 21360 ((11414 item) (item 47843 34760 86793))) (96485 x ((16857 bar 55696) 60486 z) ((32506 count 22882) item gamma (x) (39856 foo 93704 12005) 97921) ((64685 lambda)))) (((z (z car alpha) foo 5211 (71798 95287 52539 foo 54465) (73886)) ((foo 99622) 82253) ((gamma 48686) (y y 20692 12721) (alpha 50856 68310)) 10774 ((29955 beta bar) (alpha 77616 49010 51138 57912 car) 51962 (alpha) (68934 y) (17457 47405 item 92877 83973 z))) (foo 84753) (bar item 9006 (count (cdr cdr foo) (bar item bar 30975 54321) (x 70541 21765 54193)) (33671)) (foo ((car 51507 z 41579) 34000) 57750 (29596 (delta foo delta count foo 83508) (11717 lambda 9339 bar) (26614 92332) baz (56525 41842 82842 93661 bar beta)) ((baz 28974 delta 92646 cdr))) (81841 ((item 73318 60324) (lambda 63118 44522 car x) (item 5989 20755) count 82708) 58978 ((80464))))) (foo 55996 ((((55170 x)) (13199 (item 7417 33785 item) 61780 (y 13768) 53546) ((foo bar 70278) (alpha) baz (55462 33915) (x 46436)) ((96178 86763 44593 75221 43311 y) lambda)) (foo ((foo cdr) (car bar) (car 89645 y y 87479)) lambda 34003) 64833) 28844 60240))
+'(item ((((gamma) ((18642) 11887) ((16165) (77233 37467 baz 95493 27558 baz) (delta 8091 bar) (30742 gamma) (39127 50644 car lambda 13795 71307))) ((alpha (1071) (84877 z 15151 91906 27485)) ((alpha y x 71806 bar foo) (67994 count alpha 57140 count) (beta) (84824 64591 z z 40418 54432) beta) ((x z 4079 16810) (89988) (47779 6542)) (beta (bar gamma 38409)) ((88751) (3244 77813 36863) (50125 35054) (55376 17639 71885 gamma) (baz beta 88225)) ((24981 62280 y 35127) (310 item 13445 beta 29493) (foo foo 16080) lambda (36500 70560 58700 27439 -126 car))) alpha 14836 lambda) (11444 (((baz 7127) (-534) (88229) (12242 56936 85319) 95064) (lambda gamma) item ((car) (30918 count 21489 99300 beta 15563)) ((97033 70999 delta foo 94698) 62244)) 9299 70464)) 71411 gamma ((alpha 90903) 67770 count ((((car lambda delta) (9829 alpha 29615 foo) (y 51837 10775 5627 y baz) gamma) beta) (((60151 delta lambda 68294 19473)) ((beta 99548) (x alpha y baz beta) (x baz bar 14894 43800) (z 58699 61404 delta) (alpha y 59932 bar)) ((56374) (81058) (count 43514 32337 alpha) (1934 foo 94877 53995 car) (cdr 11642 z 24524 48772))) (lambda bar (count (baz 21958 alpha)) ((92536 95079) (65891 car) (lambda baz z count) 49113) ((11178 84169) (gamma 14817 beta car 98963 23873) y y) (count (56642 98949 x 65239 93251))) (58607 ((52636 beta count) (beta) (56185 lambda 46197 8432 baz 9917) (item 25783 baz alpha car) 32686 (gamma 98717 cdr 72045)) 14640 31293 (35803 2744 (92643 82835 item) (26220 65276 gamma 23301 21090) (57265 baz)) ((bar alpha) (foo) 21752 (cdr))) (((z 24079) (item 29322 11340 61500 cdr 41171) (3792 14625 lambda baz cdr y) (x 91249 foo z)) ((34088 87048) item (car item 17651 bar 92804 742) (52839 count 23236 30950 29538))) (((67563) (beta) 71944 lambda (65508)) ((76618) (delta 27110 y bar gamma 62539) 45364 8882 (y delta 46594)) ((53265 1888 delta)) ((97184 82391 2923) 72759 y (91631 18562 62275) (64221 lambda 51446) alpha))) ((34012) bar) (46986 (25139))))
+'((((((y cdr cdr 22304) item (80602 lambda 98112 68592 98090 73786) (delta bar 44337 78801)) ((57010 -610 27044) (31292 z car alpha cdr count) 17877 y (baz car) y) 8666 ((80914 beta 96530) (lambda 54987 59366 18752) delta) ((19258 73815 x car) (5651) 3356 (item foo cdr 81165 z delta) (9546 59971 beta z) (bar 17886 alpha)))) ((13726 ((7383 23129 item lambda delta) (bar 99182) (63039 bar 23233 beta) baz) ((95318 beta y) (delta gamma delta) 65816 (46066)) ((49058 50340 25040 z)) ((50438 count 93447 bar item) count (lambda) (11463 81857 x y) (baz))) (37138 78392 (17267 (62153) (91829 29143 z) item) (beta (16957 gamma car car)) (66456 (8623) 29115 (25565 beta 61166 x) (10845) (beta 96115 58167 8757 41331))) (((15934 49983 51482 87509) cdr) (11952 foo (bar 41562 55316 18691 79579 19971))) (((56027 15698) (78208 72550 delta 67672) (25760) (26519 delta 80305 z 78652) (11652 x gamma cdr)) ((lambda beta 69800 11043 21233) (gamma) z (80566 baz 57982 z 5703) (27765 foo x))) y (((cdr 83374 42701 3261) 69443 (beta 21991 delta) count (43632 bar 8699)) ((lambda count item delta foo cdr) (52756 76658 cdr 85423 55194 gamma) y (foo 13506 alpha) 98732) baz item)) (((lambda (73944 baz 52980 item 83094) (33124 bar item 51922) (25552 cdr) (89089 78850 delta 2441)) ((74719) (8240 62374 lambda baz 85770 49444) (foo delta)) lambda 47706 (item (lambda 74687 59098 98924) (count 29978 79182 1561 car) (99228 64155 35443) (z count beta 30306) (alpha z)) (count gamma 19816)) (((beta y x 34244 8384 car) (alpha item alpha 63290 beta y) count (34288 count) (61254 42126 lambda gamma 29410)) ((63493 23280 y 15429) (31332 delta 75999 48689) (15553 13445 30397) (gamma 85548 delta x) 2926 99804) ((y 68948 65749) (33848 delta 72317 65969 96647)) 1882) (((7965 gamma y 35412 62078) (foo 6899 94434) (89892 84905 71873 9598)) ((foo beta delta 27618 car) x 71487) (car (z 77651) (55013 16131 33354 62004) (88336 cdr 69015 8995)))) 64268 ((gamma (39343) (55499 (delta 3461 83270 car 8292 baz) bar (bar baz car) (delta delta 92816)) (30778 (79123 bar lambda item cdr 88764) 11173 (lambda 53768 1089 item)) ((23296) (alpha 74136 alpha foo x) (8010 lambda) beta (x 79419 beta 10400 93268 x) (alpha bar))) (((beta foo 88447 74136 z lambda) 53626 (x 75858 19836 item delta 31973) (y 26358 25477))) (delta ((67360 25577 baz 29743 baz) (51557 86172 27353 lambda 16176)) ((foo cdr item) (x item 21916)) ((24438 count z item 46178) (21329) 35133 (51894 46831 gamma 12413 lambda y) (baz 56599 y) (32256 gamma beta gamma)) baz) (9570 ((bar 12095 y) (35930 26524 bar 58449) beta) ((26444 bar y 81344) (10214 beta 8041 3491 baz) (count)) 44625) (6141 (bar (2945 27507 baz) (bar count z cdr foo) 9675 (beta gamma 21554 bar cdr y) (alpha 75076 82426 x car y)) ((20387 32571 620 beta cdr 95896) (cdr 65000 68487 56132 33154 32537) 18925 (65920 98122 29743 52500 96663 79745)) (item (11521 87377) (cdr 89293 58628 86601)) ((4939 35887 37214 lambda 58828 y))) baz)) (((((alpha 40922 lambda) 28699 alpha) ((81498 12402 25031 beta) (x 10159 gamma 49499 baz)) (alpha (alpha 49876)) ((72862 item delta x 84700 foo) (67462 35716)) ((y bar 77628 59354))) 1106 18169)))
+'(2989)
+'(bar (((((48307 bar item 93042 40028 94098) 32675) ((beta 24784 95818 93224 z 42756) (car 71502 item) (delta item) (67701 44170 90297 foo 57151 49409) (alpha cdr 44532 count alpha lambda) beta) car)) (((y) 95487 ((z lambda 17409 27553 item z) gamma (x z 10875 38323) (55365 gamma delta) 66437) ((count car gamma foo) item (gamma z 10874 alpha)) ((83809) (y 47860)) ((x baz) (item x y foo) (y 17840) (78547) x)) ((7273 (y 99870) (bar count bar 88118))) x 15570 (z ((beta)) ((baz) (alpha 88638 baz 80295 lambda 59032) (33874 car 90661) (41828 71207) (cdr))) (((item gamma) (43084 60203) (57587 2997 y 67860) 27837))) (67797 (31413 ((count 95631 y 99904 8362 cdr) (31382 baz beta) (alpha 47380 51947 cdr delta 96678)) (z)) (((71586 x alpha bar 6399 58539)) 77976) 61355 (((43047 y 69076 73923 31532 67124)) (bar car (46977)) count) (((8967 bar) (count 94595 foo 58297 cdr alpha) (35443 baz) x (beta) gamma) (16483))) (31978 (((lambda beta 61944 55142 4179 item)) ((36906 cdr 71288 34843)) ((46607 41663) x (baz count x 77751 35620) (z 87683 cdr 81677 lambda 8884) delta 71693)) (bar ((car 37210 y) beta (beta 56548 alpha cdr 6505 x) (bar 71721 y) item (item 25077 lambda)) beta ((23429 cdr foo x 86846 cdr) (6813 49863) (78357)) count (item)) (((baz beta 67807 y 76654 63261) (13037 81923) (cdr 1482 lambda) (x 80126 count bar) 88571 (22215 13299)) ((43600 43216 5599) (count 14806 x 31907 lambda) (delta baz 89821) (gamma car bar) (31865 17409 lambda x alpha z) (gamma 6918 73636 count 51592)) ((baz 62608 foo) (52677 lambda 30564) (14602 48061 foo car 55825))) (((95651 y) (bar 32701 item z x 25034)) delta (count (16044 item 99617 foo) (bar lambda 11584 45433 delta) cdr delta (99155)) z) (((80403 92088) 90182 (28355 68110 70516) 64687 (44151) z) ((28973 item 10793)))) (foo) (((2490 69898 (x) (15182) (item z item)) item ((37067) count) ((foo 50421 foo gamma 45792 car)) (69947 (44545 12297 alpha 68580) y) ((bar car lambda 23809 44681 33463) (bar) lambda 42745 43939 (93763))) delta (((delta 32167) (baz 41491 91876 48412) 49479 (88577 z count 27285 y 50583) 17860) ((51566 beta 11885 1498) 20660 (foo 9482) (91661 lambda 75778 lambda) (77878 64312 33685 25332 beta lambda))))) baz (13111 (z (delta ((car 88529 94452) (96136 32086 count bar) (3476 lambda) (4223 gamma y count) (beta 49723 alpha foo car) 68819) (gamma) (69754 z 88403) ((baz 36966) (83657 beta 79767 lambda) (car count alpha car lambda) z item (61336 y 29492 64772 x)) ((car 95241 item bar bar) (67566 bar 48411 item 32060 baz) 5009)) (((beta x) (alpha 64297 85912) (20745 alpha count delta) (count 77345 72158 29616)) ((75045 26012 lambda) (y gamma 55807 cdr car z) (19176 17342 beta item) (count lambda)) bar 32764 (lambda 91578)) (76100 beta ((29784 bar) (31088 count 28680) (beta 79613 z) (54429 bar) (lambda 86364) gamma))) ((((43005 1369 alpha car foo 36196) 63764 (22355 13123 12979 19767 car 21014) (9126 59663 baz) (gamma) (item)) ((87308 83094 delta) (beta foo) (beta 59728 91568) 80415) ((item 28525 lambda) car) car ((cdr bar 94200 9241) (z 7360 lambda 16288 23685 62503) (9669 -432) 18923 (item 69604 y gamma 52507 item) (x 55903)) bar))) (((((y 47350 81035 45052 delta z) (77281 55196) (y 54037 51358 cdr 97710 lambda) (17260 3625 26285) (lambda bar) (lambda gamma 34118 baz 67667 2480)) ((5485) (74175) lambda) ((99303 71077 93018 70991 59803))) (((17383 bar)) 57439 car) (6519 ((count 49809 alpha alpha baz count) (beta) (18621) (63543 alpha 53230) (x car car 78862) cdr)) (((car count y) 61370 (lambda 49204 y z))) (((69877) (33394 car) (23322) (beta 41915 beta 23156 lambda cdr) (lambda)) (alpha (52025 y z)))) alpha (((47976 (89692 car 25780 84868 count z) 85442)) (((3030 32017 gamma 611) (2857 42535 79196 62949 94973 x) 68077) ((45416 cdr count 53049 39256) (foo 1389) (baz) 73612 (40104 z 76627) (93097)) (baz) ((84363 362 39268 count y) lambda)) baz z (((98648 66830) -919)) (((baz 7153 10253 21795)) 56352))))
+'(foo (((((96264 delta gamma 2297) (23489 36247 lambda 39090 x 33484) (baz cdr) (item 45895 alpha lambda 59032)) gamma ((y item baz) (gamma) (x count baz 81207)) (delta (foo 26404 x 70810 car) count) ((bar 50040 alpha cdr 33821 bar))) (((35426 car baz))) (((delta delta 46348 car 39088) (y) (62089 69643 51198) (x x cdr 28182 45735 12574)) ((24073 y 39151 car 30670 item) (30262 x 1487 2270) (31490) (cdr 76232 foo 93486) (12197 69646 25377) (89207 76246 86885)) (count x (beta cdr) 72329 z) ((19252 z) 15381 (gamma 89651 baz 24976 y) cdr (56710 alpha delta gamma 24318) (baz 28472)) ((bar alpha 89702 bar 86073) (21226) (19068 item x x) lambda (87111 y 68605))) (((56687) 78793 (count 6403) (count 65537 foo beta 85739)) ((baz) (35221 25354 79635 count x) (92405 x 736 bar lambda 59437)) ((car alpha) (29227 64705 71809 delta))) (((19222 55621 gamma z 88273) baz 38548 (foo) car) (66181 (70511 8161) y 94192) ((12738) (88781 alpha) beta (x foo x 94099 lambda x)) 24268)) (gamma) ((((83757 gamma 13737 10699))) ((29557 (97218 z) (z beta 78845 37692 beta 25967) gamma (cdr 82124 59917 -810 x)) ((lambda bar -193 count count) 7697)) (cdr) ((baz (car) delta (z beta 75956 84083 cdr)) (50073 (x car) (baz 52954) (alpha delta 50741 87625 38625)) 39822 (26862 (38611 gamma))) (((920) foo (z)) item)) (91769 alpha (((52307 gamma alpha baz foo cdr))) lambda 78643) (((81244 (delta car y z) baz) z ((car)) (alpha (12063 foo)) ((22756 33550 29532 item 40232) (baz) 13005 (baz bar beta beta)) bar) (((79872 baz car 64983 beta y) (67277 53860 65947) (70475 57134 67847 31659 bar) (7416 69562))) (((50755 cdr x 69287) alpha (x 76186 97441) (60092 beta item cdr 74032 count) (beta 36685 71286 77478 42404 21811)) ((9345) 70071 (alpha 65172 51096) (56208 beta 10040 baz count y) (car z delta)) ((91035 x x y 33977) (43184 86391 bar) (73201 foo 34007 905 6810 y)) item 15831)) 78909))
+'(((29656 beta ((4797) ((34235 36966 gamma 60300 beta) (1012 99649 beta)) ((3614 19206 gamma 53918 car) (lambda 46233 x foo 49630) 26875 (10570)) y 22789) x (((2094 41275 count) (49044 lambda 72359 z) bar 70033 (cdr item 27522 beta 11896 36755)) ((lambda 79367 z bar alpha cdr) (cdr bar) 56637 80456) alpha ((98142 delta delta) (z) (lambda 31843 baz gamma foo lambda) (x 74609 x 24801 y) (cdr 59258 48118 7508 78918 99640) (alpha 69753 45381 bar y cdr)))) beta ((baz (beta) 25590 (baz) ((17878 gamma item 82112 3591 gamma) 78243 baz baz)) 30385 (cdr cdr) item) (alpha) (64330 (((foo 22149 50016 40168 item) gamma (alpha 74487)) ((29421) (81482 foo))) (((baz 5694 21050 lambda) 57072 (foo 52955) (gamma 10793 y lambda 89665 beta) (gamma x) (baz beta x z)) ((z 26417 delta 2520 beta 18323) (76422) 66447 cdr (count) (15745 delta 75763 count 8972 22407)) (32257 48958 (lambda) delta (delta 66941 76730 bar x 22137)) ((41265 16412 32754 count item 88785)) -187 x) 62838) ((((58089 z) (19260 87139 lambda) foo) delta 6785 10982))) 3648 delta ((((89281 (cdr bar 17539 lambda)) (gamma (29442 38700 85494 cdr) (baz 23296 74948 foo 51162)) cdr)) (y 21817 (car 87314 ((69390) (z car baz) beta (cdr 78573 count) beta)) 87990 3 33513) (59499 (65131 47053 (gamma) (alpha) 33238 ((gamma z beta) (lambda 73703 baz))) beta) ((33523 ((gamma 3276 car lambda delta)) ((84745 alpha 30338 y baz 75462) (60643 y 26447 44396 49820) beta (z 78280 z 59142) (foo 51483 9872)) 49728) (89994) (delta (y (78720) (car beta) (gamma 64925 84055 99717 bar baz) 47154 57217) 88721) 49365 (((bar 62887 beta 27826) (32682 89954 73842 cdr) (count alpha 77454) (4118 24104 3365 57864 12997 item) cdr) ((beta 79493 foo) (beta baz) 95282 (4131 47070 81749) (alpha 73024 72859)) ((delta) (36998 57079 11903 59181 beta) (car 95105 77927 beta 63940 65898) bar) (83732 gamma beta (25068) (bar 38007 z 51836 delta) 14428) ((3883) foo lambda (87952 13534 50903 42609 beta) (x car beta count)))) ((((34573 gamma 78055 gamma) (86632 count 27121 55630) (65940) (50774 cdr lambda 62879 95181 foo) (65108 delta gamma bar)) (delta car) 78487 (95036 (cdr bar gamma alpha count 48495)) car) (z) ((90892) (x (66398 alpha alpha 37162 z) gamma) (car (16727 6265 baz lambda 55690 8702) (count 31470 58622 23355) (count item 929 92929 car 33559) (baz alpha alpha y)))) ((((32632) (cdr bar z) 67555 (y)) beta ((cdr z 66842 29583 z) (baz 1722 89553 75738 foo) (45066 foo 61850 delta) (baz baz baz car x) (6045 59714 y car) (delta)) ((-429 69024 58941)) cdr) (((-301 69001) (38603) (y 81148 32790) foo)) (((lambda 65934 alpha count baz) (beta 88832 74817 alpha 94287) (57111 49835 z)) ((x 88972 96734 gamma 39870 48107) 47322 (delta beta 55775) (beta lambda) (gamma) (-269 25612 count z car)) 52374 ((75397 beta item count) 3801 (delta 38467 x beta z) (cdr 50464))))))
+'(0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 55 56 57 58 59 60 61 62 63 64 65 66 67 68 69 70 71 72 73 74 75 76 77 78 79 80 81 82 83 84 85 86 87 88 89 90 91 92 93 94 95 96 97 98 99 100 101 102 103 104 105 106 107 108 109 110 111 112 113 114 115 116 117 118 119 120 121 122 123 124 125 126 127 128 129 130 131 132 133 134 135 136 137 138 139 140 141 142 143 144 145 146 147 148 149 150 151 152 153 154 155 156 157 158 159 160 161 162 163 164 165 166 167 168 169 170 171 172 173 174 175 176 177 178 179 180 181 182 183 184 185 186 187 188 189 190 191 192 193 194 195 196 197 198 199 200 201 202 203 204 205 206 207 208 209 210 211 212 213 214 215 216 217 218 219 220 221 222 223 224 225 226 227 228 229 230 231 232 233 234 235 236 237 238 239 240 241 242 243 244 245 246 247 248 249 250 251 252 253 254 255 256 257 258 259 260 261 262 263 264 265 266 267 268 269 270 271 272 273 274 275 276 277 278 279 280 281 282 283 284 285 286 287 288 289 290 291 292 293 294 295 296 297 298 299 300 301 302 303 304 305 306 307 308 309 310 311 312 313 314 315 316 317 318 319 320 321 322 323 324 325 326 327 328 329 330 331 332 333 334 335 336 337 338 339 340 341 342 343 344 345 346 347 348 349 350 351 352 353 354 355 356 357 358 359 360 361 362 363 364 365 366 367 368 369 370 371 372 373 374 375 376 377 378 379 380 381 382 383 384 385 386 387 388 389 390 391 392 393 394 395 396 397 398 399 400 401 402 403 404 405 406 407 408 409 410 411 412 413 414 415 416 417 418 419 420 421 422 423 424 425 426 427 428 429 430 431 432 433 434 435 436 437 438 439 440 441 442 443 444 445 446 447 448 449 450 451 452 453 454 455 456 457 458 459 460 461 462 463 464 465 466 467 468 469 470 471 472 473 474 475 476 477 478 479 480 481 482 483 484 485 486 487 488 489 490 491 492 493 494 495 496 497 498 499 500 501 502 503 504 505 506 507 508 509 510 511 512 513 514 515 516 517 518 519 520 521 522 523 524 525 526 527 528 529 530 531 532 533 534 535 536 537 538 539 540 541 542 543 544 545 546 547 548 549 550 551 552 553 554 555 556 557 558 559 560 561 562 563 564 565 566 567 568 569 570 571 572 573 574 575 576 577 578 579 580 581 582 583 584 585 586 587 588 589 590 591 592 593 594 595 596 597 598 599 600 601 602 603 604 605 606 607 608 609 610 611 612 613 614 615 616 617 618 619 620 621 622 623 624 625 626 627 628 629 630 631 632 633 634 635 636 637 638 639 640 641 642 643 644 645 646 647 648 649 650 651 652 653 654 655 656 657 658 659 660 661 662 663 664 665 666 667 668 669 670 671 672 673 674 675 676 677 678 679 680 681 682 683 684 685 686 687 688 689 690 691 692 693 694 695 696 697 698 699 700 701 702 703 704 705 706 707 708 709 710 711 712 713 714 715 716 717 718 719 720 721 722 723 724 725 726 727 728 729 730 731 732 733 734 735 736 737 738 739 740 741 742 743 744 745 746 747 748 749 750 751 752 753 754 755 756 757 758 759 760 761 762 763 764 765 766 767 768 769 770 771 772 773 774 775 776 777 778 779 780 781 782 783 784 785 786 787 788 789 790 791 792 793 794 795 796 797 798 799 800 801 802 803 804 805 806 807 808 809 810 811 812 813 814 815 816 817 818 819 820 821 822 823 824 825 826 827 828 829 830 831 832 833 834 835 836 837 838 839 840 841 842 843 844 845 846 847 848 849 850 851 852 853 854 855 856 857 858 859 860 861 862 863 864 865 866 867 868 869 870 871 872 873 874 875 876 877 878 879 880 881 882 883 884 885 886 887 888 889 890 891 892 893 894 895 896 897 898 899 900 901 902 903 904 905 906 907 908 909 910 911 912 913 914 915 916 917 918 919 920 921 922 923 924 925 926 927 928 929 930 931 932 933 934 935 936 937 938 939 940 941 942 943 944 945 946 947 948 949 950 951 952 953 954 955 956 957 958 959 960 961 962 963 964 965 966 967 968 969 970 971 972 973 974 975 976 977 978 979 980 981 982 983 984 985 986 987 988 989 990 991 992 993 994 995 996 997 998 999 1000 1001 1002 1003 1004 1005 1006 1007 1008 1009 1010 1011 1012 1013 1014 1015 1016 1017 1018 1019 1020 1021 1022 1023 1024 1025 1026 1027 1028 1029 1030 1031 1032 1033 1034 1035 1036 1037 1038 1039 1040 1041 1042 1043 1044 1045 1046 1047 1048 1049 1050 1051 1052 1053 1054 1055 1056 1057 1058 1059 1060 1061 1062 1063 1064 1065 1066 1067 1068 1069 1070 1071 1072 1073 1074 1075 1076 1077 1078 1079 1080 1081 1082 1083 1084 1085 1086 1087 1088 1089 1090 1091 1092 1093 1094 1095 1096 1097 1098 1099 1100 1101 1102 1103 1104 1105 1106 1107 1108 1109 1110 1111 1112 1113 1114 1115 1116 1117 1118 1119 1120 1121 1122 1123 1124 1125 1126 1127 1128 1129 1130 1131 1132 1133 1134 1135 1136 1137 1138 1139 1140 1141 1142 1143 1144 1145 1146 1147 1148 1149 1150 1151 1152 1153 1154 1155 1156 1157 1158 1159 1160 1161 1162 1163 1164 1165 1166 1167 1168 1169 1170 1171 1172 1173 1174 1175 1176 1177 1178 1179 1180 1181 1182 1183 1184 1185 1186 1187 1188 1189 1190 1191 1192 1193 1194 1195 1196 1197 1198 1199 1200 1201 1202 1203 1204 1205 1206 1207 1208 1209 1210 1211 1212 1213 1214 1215 1216 1217 1218 1219 1220 1221 1222 1223 1224 1225 1226 1227 1228 1229 1230 1231 1232 1233 1234 1235 1236 1237 1238 1239 1240 1241 1242 1243 1244 1245 1246 1247 1248 1249 1250 1251 1252 1253 1254 1255 1256 1257 1258 1259 1260 1261 1262 1263 1264 1265 1266 1267 1268 1269 1270 1271 1272 1273 1274 1275 1276 1277 1278 1279 1280 1281 1282 1283 1284 1285 1286 1287 1288 1289 1290 1291 1292 1293 1294 1295 1296 1297 1298 1299 1300 1301 1302 1303 1304 1305 1306 1307 1308 1309 1310 1311 1312 1313 1314 1315 1316 1317 1318 1319 1320 1321 1322 1323 1324 1325 1326 1327 1328 1329 1330 1331 1332 1333 1334 1335 1336 1337 1338 1339 1340 1341 1342 1343 1344 1345 1346 1347 1348 1349 1350 1351 1352 1353 1354 1355 1356 1357 1358 1359 1360 1361 1362 1363 1364 1365 1366 1367 1368 1369 1370 1371 1372 1373 1374 1375 1376 1377 1378 1379 1380 1381 1382 1383 1384 1385 1386 1387 1388 1389 1390 1391 1392 1393 1394 1395 1396 1397 1398 1399 1400 1401 1402 1403 1404 1405 1406 1407 1408 1409 1410 1411 1412 1413 1414 1415 1416 1417 1418 1419 1420 1421 1422 1423 1424 1425 1426 1427 1428 1429 1430 1431 1432 1433 1434 1435 1436 1437 1438 1439 1440 1441 1442 1443 1444 1445 1446 1447 1448 1449 1450 1451 1452 1453 1454 1455 1456 1457 1458 1459 1460 1461 1462 1463 1464 1465 1466 1467 1468 1469 1470 1471 1472 1473 1474 1475 1476 1477 1478 1479 1480 1481 1482 1483 1484 1485 1486 1487 1488 1489 1490 1491 1492 1493 1494 1495 1496 1497 1498 1499 1500 1501 1502 1503 1504 1505 1506 1507 1508 1509 1510 1511 1512 1513 1514 1515 1516 1517 1518 1519 1520 1521 1522 1523 1524 1525 1526 1527 1528 1529 1530 1531 1532 1533 1534 1535 1536 1537 1538 1539 1540 1541 1542 1543 1544 1545 1546 1547 1548 1549 1550 1551 1552 1553 1554 1555 1556 1557 1558 1559 1560 1561 1562 1563 1564 1565 1566 1567 1568 1569 1570 1571 1572 1573 1574 1575 1576 1577 1578 1579 1580 1581 1582 1583 1584 1585 1586 1587 1588 1589 1590 1591 1592 1593 1594 1595 1596 1597 1598 1599 1600 1601 1602 1603 1604 1605 1606 1607 1608 1609 1610 1611 1612 1613 1614 1615 1616 1617 1618 1619 1620 1621 1622 1623 1624 1625 1626 1627 1628 1629 1630 1631 1632 1633 1634 1635 1636 1637 1638 1639 1640 1641 1642 1643 1644 1645 1646 1647 1648 1649 1650 1651 1652 1653 1654 1655 1656 1657 1658 1659 1660 1661 1662 1663 1664 1665 1666 1667 1668 1669 1670 1671 1672 1673 1674 1675 1676 1677 1678 1679 1680 1681 1682 1683 1684 1685 1686 1687 1688 1689 1690 1691 1692 1693 1694 1695 1696 1697 1698 1699 1700 1701 1702 1703 1704 1705 1706 1707 1708 1709 1710 1711 1712 1713 1714 1715 1716 1717 1718 1719 1720 1721 1722 1723 1724 1725 1726 1727 1728 1729 1730 1731 1732 1733 1734 1735 1736 1737 1738 1739 1740 1741 1742 1743 1744 1745 1746 1747 1748 1749 1750 1751 1752 1753 1754 1755 1756 1757 1758 1759 1760 1761 1762 1763 1764 1765 1766 1767 1768 1769 1770 1771 1772 1773 1774 1775 1776 1777 1778 1779 1780 1781 1782 1783 1784 1785 1786 1787 1788 1789 1790 1791 1792 1793 1794 1795 1796 1797 1798 1799 1800 1801 1802 1803 1804 1805 1806 1807 1808 1809 1810 1811 1812 1813 1814 1815 1816 1817 1818 1819 1820 1821 1822 1823 1824 1825 1826 1827 1828 1829 1830 1831 1832 1833 1834 1835 1836 1837 1838 1839 1840 1841 1842 1843 1844 1845 1846 1847 1848 1849 1850 1851 1852 1853 1854 1855 1856 1857 1858 1859 1860 1861 1862 1863 1864 1865 1866 1867 1868 1869 1870 1871 1872 1873 1874 1875 1876 1877 1878 1879 1880 1881 1882 1883 1884 1885 1886 1887 1888 1889 1890 1891 1892 1893 1894 1895 1896 1897 1898 1899 1900 1901 1902 1903 1904 1905 1906 1907 1908 1909 1910 1911 1912 1913 1914 1915 1916 1917 1918 1919 1920 1921 1922 1923 1924 1925 1926 1927 1928 1929 1930 1931 1932 1933 1934 1935 1936 1937 1938 1939 1940 1941 1942 1943 1944 1945 1946 1947 1948 1949 1950 1951 1952 1953 1954 1955 1956 1957 1958 1959 1960 1961 1962 1963 1964 1965 1966 1967 1968 1969 1970 1971 1972 1973 1974 1975 1976 1977 1978 1979 1980 1981 1982 1983 1984 1985 1986 1987 1988 1989 1990 1991 1992 1993 1994 1995 1996 1997 1998 1999 2000 2001 2002 2003 2004 2005 2006 2007 2008 2009 2010 2011 2012 2013 2014 2015 2016 2017 2018 2019 2020 2021 2022 2023 2024 2025 2026 2027 2028 2029 2030 2031 2032 2033 2034 2035 2036 2037 2038 2039 2040 2041 2042 2043 2044 2045 2046 2047 2048 2049 2050 2051 2052 2053 2054 2055 2056 2057 2058 2059 2060 2061 2062 2063 2064 2065 2066 2067 2068 2069 2070 2071 2072 2073 2074 2075 2076 2077 2078 2079 2080 2081 2082 2083 2084 2085 2086 2087 2088 2089 2090 2091 2092 2093 2094 2095 2096 2097 2098 2099 2100 2101 2102 2103 2104 2105 2106 2107 2108 2109 2110 2111 2112 2113 2114 2115 2116 2117 2118 2119 2120 2121 2122 2123 2124 2125 2126 2127 2128 2129 2130 2131 2132 2133 2134 2135 2136 2137 2138 2139 2140 2141 2142 2143 2144 2145 2146 2147 2148 2149 2150 2151 2152 2153 2154 2155 2156 2157 2158 2159 2160 2161 2162 2163 2164 2165 2166 2167 2168 2169 2170 2171 2172 2173 2174 2175 2176 2177 2178 2179 2180 2181 2182 2183 2184 2185 2186 2187 2188 2189 2190 2191 2192 2193 2194 2195 2196 2197 2198 2199 2200 2201 2202 2203 2204 2205 2206 2207 2208 2209 2210 2211 2212 2213 2214 2215 2216 2217 2218 2219 2220 2221 2222 2223 2224 2225 2226 2227 2228 2229 2230 2231 2232 2233 2234 2235 2236 2237 2238 2239 2240 2241 2242 2243 2244 2245 2246 2247 2248 2249 2250 2251 2252 2253 2254 2255 2256 2257 2258 2259 2260 2261 2262 2263 2264 2265 2266 2267 2268 2269 2270 2271 2272 2273 2274 2275 2276 2277 2278 2279 2280 2281 2282 2283 2284 2285 2286 2287 2288 2289 2290 2291 2292 2293 2294 2295 2296 2297 2298 2299 2300 2301 2302 2303 2304 2305 2306 2307 2308 2309 2310 2311 2312 2313 2314 2315 2316 2317 2318 2319 2320 2321 2322 2323 2324 2325 2326 2327 2328 2329 2330 2331 2332 2333 2334 2335 2336 2337 2338 2339 2340 2341 2342 2343 2344 2345 2346 2347 2348 2349 2350 2351 2352 2353 2354 2355 2356 2357 2358 2359 2360 2361 2362 2363 2364 2365 2366 2367 2368 2369 2370 2371 2372 2373 2374 2375 2376 2377 2378 2379 2380 2381 2382 2383 2384 2385 2386 2387 2388 2389 2390 2391 2392 2393 2394 2395 2396 2397 2398 2399 2400 2401 2402 2403 2404 2405 2406 2407 2408 2409 2410 2411 2412 2413 2414 2415 2416 2417 2418 2419 2420 2421 2422 2423 2424 2425 2426 2427 2428 2429 2430 2431 2432 2433 2434 2435 2436 2437 2438 2439 2440 2441 2442 2443 2444 2445 2446 2447 2448 2449 2450 2451 2452 2453 2454 2455 2456 2457 2458 2459 2460 2461 2462 2463 2464 2465 2466 2467 2468 2469 2470 2471 2472 2473 2474 2475 2476 2477 2478 2479 2480 2481 2482 2483 2484 2485 2486 2487 2488 2489 2490 2491 2492 2493 2494 2495 2496 2497 2498 2499 2500 2501 2502 2503 2504 2505 2506 2507 2508 2509 2510 2511 2512 2513 2514 2515 2516 2517 2518 2519 2520 2521 2522 2523 2524 2525 2526 2527 2528 2529 2530 2531 2532 2533 2534 2535 2536 2537 2538 2539 2540 2541 2542 2543 2544 2545 2546 2547 2548 2549 2550 2551 2552 2553 2554 2555 2556 2557 2558 2559 2560 2561 2562 2563 2564 2565 2566 2567 2568 2569 2570 2571 2572 2573 2574 2575 2576 2577 2578 2579 2580 2581 2582 2583 2584 2585 2586 2587 2588 2589 2590 2591 2592 2593 2594 2595 2596 2597 2598 2599 2600 2601 2602 2603 2604 2605 2606 2607 2608 2609 2610 2611 2612 2613 2614 2615 2616 2617 2618 2619 2620 2621 2622 2623 2624 2625 2626 2627 2628 2629 2630 2631 2632 2633 2634 2635 2636 2637 2638 2639 2640 2641 2642 2643 2644 2645 2646 2647 2648 2649 2650 2651 2652 2653 2654 2655 2656 2657 2658 2659 2660 2661 2662 2663 2664 2665 2666 2667 2668 2669 2670 2671 2672 2673 2674 2675 2676 2677 2678 2679 2680 2681 2682 2683 2684 2685 2686 2687 2688 2689 2690 2691 2692 2693 2694 2695 2696 2697 2698 2699 2700 2701 2702 2703 2704 2705 2706 2707 2708 2709 2710 2711 2712 2713 2714 2715 2716 2717 2718 2719 2720 2721 2722 2723 2724 2725 2726 2727 2728 2729 2730 2731 2732 2733 2734 2735 2736 2737 2738 2739 2740 2741 2742 2743 2744 2745 2746 2747 2748 2749 2750 2751 2752 2753 2754 2755 2756 2757 2758 2759 2760 2761 2762 2763 2764 2765 2766 2767 2768 2769 2770 2771 2772 2773 2774 2775 2776 2777 2778 2779 2780 2781 2782 2783 2784 2785 2786 2787 2788 2789 2790 2791 2792 2793 2794 2795 2796 2797 2798 2799 2800 2801 2802 2803 2804 2805 2806 2807 2808 2809 2810 2811 2812 2813 2814 2815 2816 2817 2818 2819 2820 2821 2822 2823 2824 2825 2826 2827 2828 2829 2830 2831 2832 2833 2834 2835 2836 2837 2838 2839 2840 2841 2842 2843 2844 2845 2846 2847 2848 2849 2850 2851 2852 2853 2854 2855 2856 2857 2858 2859 2860 2861 2862 2863 2864 2865 2866 2867 2868 2869 2870 2871 2872 2873 2874 2875 2876 2877 2878 2879 2880 2881 2882 2883 2884 2885 2886 2887 2888 2889 2890 2891 2892 2893 2894 2895 2896 2897 2898 2899 2900 2901 2902 2903 2904 2905 2906 2907 2908 2909 2910 2911 2912 2913 2914 2915 2916 2917 2918 2919 2920 2921 2922 2923 2924 2925 2926 2927 2928 2929 2930 2931 2932 2933 2934 2935 2936 2937 2938 2939 2940 2941 2942 2943 2944 2945 2946 2947 2948 2949 2950 2951 2952 2953 2954 2955 2956 2957 2958 2959 2960 2961 2962 2963 2964 2965 2966 2967 2968 2969 2970 2971 2972 2973 2974 2975 2976 2977 2978 2979 2980 2981 2982 2983 2984 2985 2986 2987 2988 2989 2990 2991 2992 2993 2994 2995 2996 2997 2998 2999 3000 3001 3002 3003 3004 3005 3006 3007 3008 3009 3010 3011 3012 3013 3014 3015 3016 3017 3018 3019 3020 3021 3022 3023 3024 3025 3026 3027 3028 3029 3030 3031 3032 3033 3034 3035 3036 3037 3038 3039 3040 3041 3042 3043 3044 3045 3046 3047 3048 3049 3050 3051 3052 3053 3054 3055 3056 3057 3058 3059 3060 3061 3062 3063 3064 3065 3066 3067 3068 3069 3070 3071 3072 3073 3074 3075 3076 3077 3078 3079 3080 3081 3082 3083 3084 3085 3086 3087 3088 3089 3090 3091 3092 3093 3094 3095 3096 3097 3098 3099 3100 3101 3102 3103 3104 3105 3106 3107 3108 3109 3110 3111 3112 3113 3114 3115 3116 3117 3118 3119 3120 3121 3122 3123 3124 3125 3126 3127 3128 3129 3130 3131 3132 3133 3134 3135 3136 3137 3138 3139 3140 3141 3142 3143 3144 3145 3146 3147 3148 3149 3150 3151 3152 3153 3154 3155 3156 3157 3158 3159 3160 3161 3162 3163 3164 3165 3166 3167 3168 3169 3170 3171 3172 3173 3174 3175 3176 3177 3178 3179 3180 3181 3182 3183 3184 3185 3186 3187 3188 3189 3190 3191 3192 3193 3194 3195 3196 3197 3198 3199 3200 3201 3202 3203 3204 3205 3206 3207 3208 3209 3210 3211 3212 3213 3214 3215 3216 3217 3218 3219 3220 3221 3222 3223 3224 3225 3226 3227 3228 3229 3230 3231 3232 3233 3234 3235 3236 3237 3238 3239 3240 3241 3242 3243 3244 3245 3246 3247 3248 3249 3250 3251 3252 3253 3254 3255 3256 3257 3258 3259 3260 3261 3262 3263 3264 3265 3266 3267 3268 3269 3270 3271 3272 3273 3274 3275 3276 3277 3278 3279 3280 3281 3282 3283 3284 3285 3286 3287 3288 3289 3290 3291 3292 3293 3294 3295 3296 3297 3298 3299 3300 3301 3302 3303 3304 3305 3306 3307 3308 3309 3310 3311 3312 3313 3314 3315 3316 3317 3318 3319 3320 3321 3322 3323 3324 3325 3326 3327 3328 3329 3330 3331 3332 3333 3334 3335 3336 3337 3338 3339 3340 3341 3342 3343 3344 3345 3346 3347 3348 3349 3350 3351 3352 3353 3354 3355 3356 3357 3358 3359 3360 3361 3362 3363 3364 3365 3366 3367 3368 3369 3370 3371 3372 3373 3374 3375 3376 3377 3378 3379 3380 3381 3382 3383 3384 3385 3386 3387 3388 3389 3390 3391 3392 3393 3394 3395 3396 3397 3398 3399 3400 3401 3402 3403 3404 3405 3406 3407 3408 3409 3410 3411 3412 3413 3414 3415 3416 3417 3418 3419 3420 3421 3422 3423 3424 3425 3426 3427 3428 3429 3430 3431 3432 3433 3434 3435 3436 3437 3438 3439 3440 3441 3442 3443 3444 3445 3446 3447 3448 3449 3450 3451 3452 3453 3454 3455 3456 3457 3458 3459 3460 3461 3462 3463 3464 3465 3466 3467 3468 3469 3470 3471 3472 3473 3474 3475 3476 3477 3478 3479 3480 3481 3482 3483 3484 3485 3486 3487 3488 3489 3490 3491 3492 3493 3494 3495 3496 3497 3498 3499 3500 3501 3502 3503 3504 3505 3506 3507 3508 3509 3510 3511 3512 3513 3514 3515 3516 3517 3518 3519 3520 3521 3522 3523 3524 3525 3526 3527 3528 3529 3530 3531 3532 3533 3534 3535 3536 3537 3538 3539 3540 3541 3542 3543 3544 3545 3546 3547 3548 3549 3550 3551 3552 3553 3554 3555 3556 3557 3558 3559 3560 3561 3562 3563 3564 3565 3566 3567 3568 3569 3570 3571 3572 3573 3574 3575 3576 3577 3578 3579 3580 3581 3582 3583 3584 3585 3586 3587 3588 3589 3590 3591 3592 3593 3594 3595 3596 3597 3598 3599 3600 3601 3602 3603 3604 3605 3606 3607 3608 3609 3610 3611 3612 3613 3614 3615 3616 3617 3618 3619 3620 3621 3622 3623 3624 3625 3626 3627 3628 3629 3630 3631 3632 3633 3634 3635 3636 3637 3638 3639 3640 3641 3642 3643 3644 3645 3646 3647 3648 3649 3650 3651 3652 3653 3654 3655 3656 3657 3658 3659 3660 3661 3662 3663 3664 3665 3666 3667 3668 3669 3670 3671 3672 3673 3674 3675 3676 3677 3678 3679 3680 3681 3682 3683 3684 3685 3686 3687 3688 3689 3690 3691 3692 3693 3694 3695 3696 3697 3698 3699 3700 3701 3702 3703 3704 3705 3706 3707 3708 3709 3710 3711 3712 3713 3714 3715 3716 3717 3718 3719 3720 3721 3722 3723 3724 3725 3726 3727 3728 3729 3730 3731 3732 3733 3734 3735 3736 3737 3738 3739 3740 3741 3742 3743 3744 3745 3746 3747 3748 3749 3750 3751 3752 3753 3754 3755 3756 3757 3758 3759 3760 3761 3762 3763 3764 3765 3766 3767 3768 3769 3770 3771 3772 3773 3774 3775 3776 3777 3778 3779 3780 3781 3782 3783 3784 3785 3786 3787 3788 3789 3790 3791 3792 3793 3794 3795 3796 3797 3798 3799 3800 3801 3802 3803 3804 3805 3806 3807 3808 3809 3810 3811 3812 3813 3814 3815 3816 3817 3818 3819 3820 3821 3822 3823 3824 3825 3826 3827 3828 3829 3830 3831 3832 3833 3834 3835 3836 3837 3838 3839 3840 3841 3842 3843 3844 3845 3846 3847 3848 3849 3850 3851 3852 3853 3854 3855 3856 3857 3858 3859 3860 3861 3862 3863 3864 3865 3866 3867 3868 3869 3870 3871 3872 3873 3874 3875 3876 3877 3878 3879 3880 3881 3882 3883 3884 3885 3886 3887 3888 3889 3890 3891 3892 3893 3894 3895 3896 3897 3898 3899 3900 3901 3902 3903 3904 3905 3906 3907 3908 3909 3910 3911 3912 3913 3914 3915 3916 3917 3918 3919 3920 3921 3922 3923 3924 3925 3926 3927 3928 3929 3930 3931 3932 3933 3934 3935 3936 3937 3938 3939 3940 3941 3942 3943 3944 3945 3946 3947 3948 3949 3950 3951 3952 3953 3954 3955 3956 3957 3958 3959 3960 3961 3962 3963 3964 3965 3966 3967 3968 3969 3970 3971 3972 3973 3974 3975 3976 3977 3978 3979 3980 3981 3982 3983 3984 3985 3986 3987 3988 3989 3990 3991 3992 3993 3994 3995 3996 3997 3998 3999 4000 4001 4002 4003 4004 4005 4006 4007 4008 4009 4010 4011 4012 4013 4014 4015 4016 4017 4018 4019 4020 4021 4022 4023 4024 4025 4026 4027 4028 4029 4030 4031 4032 4033 4034 4035 4036 4037 4038 4039 4040 4041 4042 4043 4044 4045 4046 4047 4048 4049 4050 4051 4052 4053 4054 4055 4056 4057 4058 4059 4060 4061 4062 4063 4064 4065 4066 4067 4068 4069 4070 4071 4072 4073 4074 4075 4076 4077 4078 4079 4080 4081 4082 4083 4084 4085 4086 4087 4088 4089 4090 4091 4092 4093 4094 4095 4096 4097 4098 4099 4100 4101 4102 4103 4104 4105 4106 4107 4108 4109 4110 4111 4112 4113 4114 4115 4116 4117 4118 4119 4120 4121 4122 4123 4124 4125 4126 4127 4128 4129 4130 4131 4132 4133 4134 4135 4136 4137 4138 4139 4140 4141 4142 4143 4144 4145 4146 4147 4148 4149 4150 4151 4152 4153 4154 4155 4156 4157 4158 4159 4160 4161 4162 4163 4164 4165 4166 4167 4168 4169 4170 4171 4172 4173 4174 4175 4176 4177 4178 4179 4180 4181 4182 4183 4184 4185 4186 4187 4188 4189 4190 4191 4192 4193 4194 4195 4196 4197 4198 4199 4200 4201 4202 4203 4204 4205 4206 4207 4208 4209 4210 4211 4212 4213 4214 4215 4216 4217 4218 4219 4220 4221 4222 4223 4224 4225 4226 4227 4228 4229 4230 4231 4232 4233 4234 4235 4236 4237 4238 4239 4240 4241 4242 4243 4244 4245 4246 4247 4248 4249 4250 4251 4252 4253 4254 4255 4256 4257 4258 4259 4260 4261 4262 4263 4264 4265 4266 4267 4268 4269 4270 4271 4272 4273 4274 4275 4276 4277 4278 4279 4280 4281 4282 4283 4284 4285 4286 4287 4288 4289 4290 4291 4292 4293 4294 4295 4296 4297 4298 4299 4300 4301 4302 4303 4304 4305 4306 4307 4308 4309 4310 4311 4312 4313 4314 4315 4316 4317 4318 4319 4320 4321 4322 4323 4324 4325 4326 4327 4328 4329 4330 4331 4332 4333 4334 4335 4336 4337 4338 4339 4340 4341 4342 4343 4344 4345 4346 4347 4348 4349 4350 4351 4352 4353 4354 4355 4356 4357 4358 4359 4360 4361 4362 4363 4364 4365 4366 4367 4368 4369 4370 4371 4372 4373 4374 4375 4376 4377 4378 4379 4380 4381 4382 4383 4384 4385 4386 4387 4388 4389 4390 4391 4392 4393 4394 4395 4396 4397 4398 4399 4400 4401 4402 4403 4404 4405 4406 4407 4408 4409 4410 4411 4412 4413 4414 4415 4416 4417 4418 4419 4420 4421 4422 4423 4424 4425 4426 4427 4428 4429 4430 4431 4432 4433 4434 4435 4436 4437 4438 4439 4440 4441 4442 4443 4444 4445 4446 4447 4448 4449 4450 4451 4452 4453 4454 4455 4456 4457 4458 4459 4460 4461 4462 4463 4464 4465 4466 4467 4468 4469 4470 4471 4472 4473 4474 4475 4476 4477 4478 4479 4480 4481 4482 4483 4484 4485 4486 4487 4488 4489 4490 4491 4492 4493 4494 4495 4496 4497 4498 4499 4500 4501 4502 4503 4504 4505 4506 4507 4508 4509 4510 4511 4512 4513 4514 4515 4516 4517 4518 4519 4520 4521 4522 4523 4524 4525 4526 4527 4528 4529 4530 4531 4532 4533 4534 4535 4536 4537 4538 4539 4540 4541 4542 4543 4544 4545 4546 4547 4548 4549 4550 4551 4552 4553 4554 4555 4556 4557 4558 4559 4560 4561 4562 4563 4564 4565 4566 4567 4568 4569 4570 4571 4572 4573 4574 4575 4576 4577 4578 4579 4580 4581 4582 4583 4584 4585 4586 4587 4588 4589 4590 4591 4592 4593 4594 4595 4596 4597 4598 4599 4600 4601 4602 4603 4604 4605 4606 4607 4608 4609 4610 4611 4612 4613 4614 4615 4616 4617 4618 4619 4620 4621 4622 4623 4624 4625 4626 4627 4628 4629 4630 4631 4632 4633 4634 4635 4636 4637 4638 4639 4640 4641 4642 4643 4644 4645 4646 4647 4648 4649 4650 4651 4652 4653 4654 4655 4656 4657 4658 4659 4660 4661 4662 4663 4664 4665 4666 4667 4668 4669 4670 4671 4672 4673 4674 4675 4676 4677 4678 4679 4680 4681 4682 4683 4684 4685 4686 4687 4688 4689 4690 4691 4692 4693 4694 4695 4696 4697 4698 4699 4700 4701 4702 4703 4704 4705 4706 4707 4708 4709 4710 4711 4712 4713 4714 4715 4716 4717 4718 4719 4720 4721 4722 4723 4724 4725 4726 4727 4728 4729 4730 4731 4732 4733 4734 4735 4736 4737 4738 4739 4740 4741 4742 4743 4744 4745 4746 4747 4748 4749 4750 4751 4752 4753 4754 4755 4756 4757 4758 4759 4760 4761 4762 4763 4764 4765 4766 4767 4768 4769 4770 4771 4772 4773 4774 4775 4776 4777 4778 4779 4780 4781 4782 4783 4784 4785 4786 4787 4788 4789 4790 4791 4792 4793 4794 4795 4796 4797 4798 4799 4800 4801 4802 4803 4804 4805 4806 4807 4808 4809 4810 4811 4812 4813 4814 4815 4816 4817 4818 4819 4820 4821 4822 4823 4824 4825 4826 4827 4828 4829 4830 4831 4832 4833 4834 4835 4836 4837 4838 4839 4840 4841 4842 4843 4844 4845 4846 4847 4848 4849 4850 4851 4852 4853 4854 4855 4856 4857 4858 4859 4860 4861 4862 4863 4864 4865 4866 4867 4868 4869 4870 4871 4872 4873 4874 4875 4876 4877 4878 4879 4880 4881 4882 4883 4884 4885 4886 4887 4888 4889 4890 4891 4892 4893 4894 4895 4896 4897 4898 4899 4900 4901 4902 4903 4904 4905 4906 4907 4908 4909 4910 4911 4912 4913 4914 4915 4916 4917 4918 4919 4920 4921 4922 4923 4924 4925 4926 4927 4928 4929 4930 4931 4932 4933 4934 4935 4936 4937 4938 4939 4940 4941 4942 4943 4944 4945 4946 4947 4948 4949 4950 4951 4952 4953 4954 4955 4956 4957 4958 4959 4960 4961 4962 4963 4964 4965 4966 4967 4968 4969 4970 4971 4972 4973 4974 4975 4976 4977 4978 4979 4980 4981 4982 4983 4984 4985 4986 4987 4988 4989 4990 4991 4992 4993 4994 4995 4996 4997 4998 4999 5000 5001 5002 5003 5004 5005 5006 5007 5008 5009 5010 5011 5012 5013 5014 5015 5016 5017 5018 5019 5020 5021 5022 5023 5024 5025 5026 5027 5028 5029 5030 5031 5032 5033 5034 5035 5036 5037 5038 5039 5040 5041 5042 5043 5044 5045 5046 5047 5048 5049 5050 5051 5052 5053 5054 5055 5056 5057 5058 5059 5060 5061 5062 5063 5064 5065 5066 5067 5068 5069 5070 5071 5072 5073 5074 5075 5076 5077 5078 5079 5080 5081 5082 5083 5084 5085 5086 5087 5088 5089 5090 5091 5092 5093 5094 5095 5096 5097 5098 5099 5100 5101 5102 5103 5104 5105 5106 5107 5108 5109 5110 5111 5112 5113 5114 5115 5116 5117 5118 5119 5120 5121 5122 5123 5124 5125 5126 5127 5128 5129 5130 5131 5132 5133 5134 5135 5136 5137 5138 5139 5140 5141 5142 5143 5144 5145 5146 5147 5148 5149 5150 5151 5152 5153 5154 5155 5156 5157 5158 5159 5160 5161 5162 5163 5164 5165 5166 5167 5168 5169 5170 5171 5172 5173 5174 5175 5176 5177 5178 5179 5180 5181 5182 5183 5184 5185 5186 5187 5188 5189 5190 5191 5192 5193 5194 5195 5196 5197 5198 5199 5200 5201 5202 5203 5204 5205 5206 5207 5208 5209 5210 5211 5212 5213 5214 5215 5216 5217 5218 5219 5220 5221 5222 5223 5224 5225 5226 5227 5228 5229 5230 5231 5232 5233 5234 5235 5236 5237 5238 5239 5240 5241 5242 5243 5244 5245 5246 5247 5248 5249 5250 5251 5252 5253 5254 5255 5256 5257 5258 5259 5260 5261 5262 5263 5264 5265 5266 5267 5268 5269 5270 5271 5272 5273 5274 5275 5276 5277 5278 5279 5280 5281 5282 5283 5284 5285 5286 5287 5288 5289 5290 5291 5292 5293 5294 5295 5296 5297 5298 5299 5300 5301 5302 5303 5304 5305 5306 5307 5308 5309 5310 5311 5312 5313 5314 5315 5316 5317 5318 5319 5320 5321 5322 5323 5324 5325 5326 5327 5328 5329 5330 5331 5332 5333 5334 5335 5336 5337 5338 5339 5340 5341 5342 5343 5344 5345 5346 5347 5348 5349 5350 5351 5352 5353 5354 5355 5356 5357 5358 5359 5360 5361 5362 5363 5364 5365 5366 5367 5368 5369 5370 5371 5372 5373 5374 5375 5376 5377 5378 5379 5380 5381 5382 5383 5384 5385 5386 5387 5388 5389 5390 5391 5392 5393 5394 5395 5396 5397 5398 5399 5400 5401 5402 5403 5404 5405 5406 5407 5408 5409 5410 5411 5412 5413 5414 5415 5416 5417 5418 5419 5420 5421 5422 5423 5424 5425 5426 5427 5428 5429 5430 5431 5432 5433 5434 5435 5436 5437 5438 5439 5440 5441 5442 5443 5444 5445 5446 5447 5448 5449 5450 5451 5452 5453 5454 5455 5456 5457 5458 5459 5460 5461 5462 5463 5464 5465 5466 5467 5468 5469 5470 5471 5472 5473 5474 5475 5476 5477 5478 5479 5480 5481 5482 5483 5484 5485 5486 5487 5488 5489 5490 5491 5492 5493 5494 5495 5496 5497 5498 5499 5500 5501 5502 5503 5504 5505 5506 5507 5508 5509 5510 5511 5512 5513 5514 5515 5516 5517 5518 5519 5520 5521 5522 5523 5524 5525 5526 5527 5528 5529 5530 5531 5532 5533 5534 5535 5536 5537 5538 5539 5540 5541 5542 5543 5544 5545 5546 5547 5548 5549 5550 5551 5552 5553 5554 5555 5556 5557 5558 5559 5560 5561 5562 5563 5564 5565 5566 5567 5568 5569 5570 5571 5572 5573 5574 5575 5576 5577 5578 5579 5580 5581 5582 5583 5584 5585 5586 5587 5588 5589 5590 5591 5592 5593 5594 5595 5596 5597 5598 5599 5600 5601 5602 5603 5604 5605 5606 5607 5608 5609 5610 5611 5612 5613 5614 5615 5616 5617 5618 5619 5620 5621 5622 5623 5624 5625 5626 5627 5628 5629 5630 5631 5632 5633 5634 5635 5636 5637 5638 5639 5640 5641 5642 5643 5644 5645 5646 5647 5648 5649 5650 5651 5652 5653 5654 5655 5656 5657 5658 5659 5660 5661 5662 5663 5664 5665 5666 5667 5668 5669 5670 5671 5672 5673 5674 5675 5676 5677 5678 5679 5680 5681 5682 5683 5684 5685 5686 5687 5688 5689 5690 5691 5692 5693 5694 5695 5696 5697 5698 5699 5700 5701 5702 5703 5704 5705 5706 5707 5708 5709 5710 5711 5712 5713 5714 5715 5716 5717 5718 5719 5720 5721 5722 5723 5724 5725 5726 5727 5728 5729 5730 5731 5732 5733 5734 5735 5736 5737 5738 5739 5740 5741 5742 5743 5744 5745 5746 5747 5748 5749 5750 5751 5752 5753 5754 5755 5756 5757 5758 5759 5760 5761 5762 5763 5764 5765 5766 5767 5768 5769 5770 5771 5772 5773 5774 5775 5776 5777 5778 5779 5780 5781 5782 5783 5784 5785 5786 5787 5788 5789 5790 5791 5792 5793 5794 5795 5796 5797 5798 5799 5800 5801 5802 5803 5804 5805 5806 5807 5808 5809 5810 5811 5812 5813 5814 5815 5816 5817 5818 5819 5820 5821 5822 5823 5824 5825 5826 5827 5828 5829 5830 5831 5832 5833 5834 5835 5836 5837 5838 5839 5840 5841 5842 5843 5844 5845 5846 5847 5848 5849 5850 5851 5852 5853 5854 5855 5856 5857 5858 5859 5860 5861 5862 5863 5864 5865 5866 5867 5868 5869 5870 5871 5872 5873 5874 5875 5876 5877 5878 5879 5880 5881 5882 5883 5884 5885 5886 5887 5888 5889 5890 5891 5892 5893 5894 5895 5896 5897 5898 5899 5900 5901 5902 5903 5904 5905 5906 5907 5908 5909 5910 5911 5912 5913 5914 5915 5916 5917 5918 5919 5920 5921 5922 5923 5924 5925 5926 5927 5928 5929 5930 5931 5932 5933 5934 5935 5936 5937 5938 5939 5940 5941 5942 5943 5944 5945 5946 5947 5948 5949 5950 5951 5952 5953 5954 5955 5956 5957 5958 5959 5960 5961 5962 5963 5964 5965 5966 5967 5968 5969 5970 5971 5972 5973 5974 5975 5976 5977 5978 5979 5980 5981 5982 5983 5984 5985 5986 5987 5988 5989 5990 5991 5992 5993 5994 5995 5996 5997 5998 5999 6000 6001 6002 6003 6004 6005 6006 6007 6008 6009 6010 6011 6012 6013 6014 6015 6016 6017 6018 6019 6020 6021 6022 6023 6024 6025 6026 6027 6028 6029 6030 6031 6032 6033 6034 6035 6036 6037 6038 6039 6040 6041 6042 6043 6044 6045 6046 6047 6048 6049 6050 6051 6052 6053 6054 6055 6056 6057 6058 6059 6060 6061 6062 6063 6064 6065 6066 6067 6068 6069 6070 6071 6072 6073 6074 6075 6076 6077 6078 6079 6080 6081 6082 6083 6084 6085 6086 6087 6088 6089 6090 6091 6092 6093 6094 6095 6096 6097 6098 6099 6100 6101 6102 6103 6104 6105 6106 6107 6108 6109 6110 6111 6112 6113 6114 6115 6116 6117 6118 6119 6120 6121 6122 6123 6124 6125 6126 6127 6128 6129 6130 6131 6132 6133 6134 6135 6136 6137 6138 6139 6140 6141 6142 6143 6144 6145 6146 6147 6148 6149 6150 6151 6152 6153 6154 6155 6156 6157 6158 6159 6160 6161 6162 6163 6164 6165 6166 6167 6168 6169 6170 6171 6172 6173 6174 6175 6176 6177 6178 6179 6180 6181 6182 6183 6184 6185 6186 6187 6188 6189 6190 6191 6192 6193 6194 6195 6196 6197 6198 6199 6200 6201 6202 6203 6204 6205 6206 6207 6208 6209 6210 6211 6212 6213 6214 6215 6216 6217 6218 6219 6220 6221 6222 6223 6224 6225 6226 6227 6228 6229 6230 6231 6232 6233 6234 6235 6236 6237 6238 6239 6240 6241 6242 6243 6244 6245 6246 6247 6248 6249 6250 6251 6252 6253 6254 6255 6256 6257 6258 6259 6260 6261 6262 6263 6264 6265 6266 6267 6268 6269 6270 6271 6272 6273 6274 6275 6276 6277 6278 6279 6280 6281 6282 6283 6284 6285 6286 6287 6288 6289 6290 6291 6292 6293 6294 6295 6296 6297 6298 6299 6300 6301 6302 6303 6304 6305 6306 6307 6308 6309 6310 6311 6312 6313 6314 6315 6316 6317 6318 6319 6320 6321 6322 6323 6324 6325 6326 6327 6328 6329 6330 6331 6332 6333 6334 6335 6336 6337 6338 6339 6340 6341 6342 6343 6344 6345 6346 6347 6348 6349 6350 6351 6352 6353 6354 6355 6356 6357 6358 6359 6360 6361 6362 6363 6364 6365 6366 6367 6368 6369 6370 6371 6372 6373 6374 6375 6376 6377 6378 6379 6380 6381 6382 6383 6384 6385 6386 6387 6388 6389 6390 6391 6392 6393 6394 6395 6396 6397 6398 6399 6400 6401 6402 6403 6404 6405 6406 6407 6408 6409 6410 6411 6412 6413 6414 6415 6416 6417 6418 6419 6420 6421 6422 6423 6424 6425 6426 6427 6428 6429 6430 6431 6432 6433 6434 6435 6436 6437 6438 6439 6440 6441 6442 6443 6444 6445 6446 6447 6448 6449 6450 6451 6452 6453 6454 6455 6456 6457 6458 6459 6460 6461 6462 6463 6464 6465 6466 6467 6468 6469 6470 6471 6472 6473 6474 6475 6476 6477 6478 6479 6480 6481 6482 6483 6484 6485 6486 6487 6488 6489 6490 6491 6492 6493 6494 6495 6496 6497 6498 6499 6500 6501 6502 6503 6504 6505 6506 6507 6508 6509 6510 6511 6512 6513 6514 6515 6516 6517 6518 6519 6520 6521 6522 6523 6524 6525 6526 6527 6528 6529 6530 6531 6532 6533 6534 6535 6536 6537 6538 6539 6540 6541 6542 6543 6544 6545 6546 6547 6548 6549 6550 6551 6552 6553 6554 6555 6556 6557 6558 6559 6560 6561 6562 6563 6564 6565 6566 6567 6568 6569 6570 6571 6572 6573 6574 6575 6576 6577 6578 6579 6580 6581 6582 6583 6584 6585 6586 6587 6588 6589 6590 6591 6592 6593 6594 6595 6596 6597 6598 6599 6600 6601 6602 6603 6604 6605 6606 6607 6608 6609 6610 6611 6612 6613 6614 6615 6616 6617 6618 6619 6620 6621 6622 6623 6624 6625 6626 6627 6628 6629 6630 6631 6632 6633 6634 6635 6636 6637 6638 6639 6640 6641 6642 6643 6644 6645 6646 6647 6648 6649 6650 6651 6652 6653 6654 6655 6656 6657 6658 6659 6660 6661 6662 6663 6664 6665 6666 6667 6668 6669 6670 6671 6672 6673 6674 6675 6676 6677 6678 6679 6680 6681 6682 6683 6684 6685 6686 6687 6688 6689 6690 6691 6692 6693 6694 6695 6696 6697 6698 6699 6700 6701 6702 6703 6704 6705 6706 6707 6708 6709 6710 6711 6712 6713 6714 6715 6716 6717 6718 6719 6720 6721 6722 6723 6724 6725 6726 6727 6728 6729 6730 6731 6732 6733 6734 6735 6736 6737 6738 6739 6740 6741 6742 6743 6744 6745 6746 6747 6748 6749 6750 6751 6752 6753 6754 6755 6756 6757 6758 6759 6760 6761 6762 6763 6764 6765 6766 6767 6768 6769 6770 6771 6772 6773 6774 6775 6776 6777 6778 6779 6780 6781 6782 6783 6784 6785 6786 6787 6788 6789 6790 6791 6792 6793 6794 6795 6796 6797 6798 6799 6800 6801 6802 6803 6804 6805 6806 6807 6808 6809 6810 6811 6812 6813 6814 6815 6816 6817 6818 6819 6820 6821 6822 6823 6824 6825 6826 6827 6828 6829 6830 6831 6832 6833 6834 6835 6836 6837 6838 6839 6840 6841 6842 6843 6844 6845 6846 6847 6848 6849 6850 6851 6852 6853 6854 6855 6856 6857 6858 6859 6860 6861 6862 6863 6864 6865 6866 6867 6868 6869 6870 6871 6872 6873 6874 6875 6876 6877 6878 6879 6880 6881 6882 6883 6884 6885 6886 6887 6888 6889 6890 6891 6892 6893 6894 6895 6896 6897 6898 6899 6900 6901 6902 6903 6904 6905 6906 6907 6908 6909 6910 6911 6912 6913 6914 6915 6916 6917 6918 6919 6920 6921 6922 6923 6924 6925 6926 6927 6928 6929 6930 6931 6932 6933 6934 6935 6936 6937 6938 6939 6940 6941 6942 6943 6944 6945 6946 6947 6948 6949 6950 6951 6952 6953 6954 6955 6956 6957 6958 6959 6960 6961 6962 6963 6964 6965 6966 6967 6968 6969 6970 6971 6972 6973 6974 6975 6976 6977 6978 6979 6980 6981 6982 6983 6984 6985 6986 6987 6988 6989 6990 6991 6992 6993 6994 6995 6996 6997 6998 6999 7000 7001 7002 7003 7004 7005 7006 7007 7008 7009 7010 7011 7012 7013 7014 7015 7016 7017 7018 7019 7020 7021 7022 7023 7024 7025 7026 7027 7028 7029 7030 7031 7032 7033 7034 7035 7036 7037 7038 7039 7040 7041 7042 7043 7044 7045 7046 7047 7048 7049 7050 7051 7052 7053 7054 7055 7056 7057 7058 7059 7060 7061 7062 7063 7064 7065 7066 7067 7068 7069 7070 7071 7072 7073 7074 7075 7076 7077 7078 7079 7080 7081 7082 7083 7084 7085 7086 7087 7088 7089 7090 7091 7092 7093 7094 7095 7096 7097 7098 7099 7100 7101 7102 7103 7104 7105 7106 7107 7108 7109 7110 7111 7112 7113 7114 7115 7116 7117 7118 7119 7120 7121 7122 7123 7124 7125 7126 7127 7128 7129 7130 7131 7132 7133 7134 7135 7136 7137 7138 7139 7140 7141 7142 7143 7144 7145 7146 7147 7148 7149 7150 7151 7152 7153 7154 7155 7156 7157 7158 7159 7160 7161 7162 7163 7164 7165 7166 7167 7168 7169 7170 7171 7172 7173 7174 7175 7176 7177 7178 7179 7180 7181 7182 7183 7184 7185 7186 7187 7188 7189 7190 7191 7192 7193 7194 7195 7196 7197 7198 7199 7200 7201 7202 7203 7204 7205 7206 7207 7208 7209 7210 7211 7212 7213 7214 7215 7216 7217 7218 7219 7220 7221 7222 7223 7224 7225 7226 7227 7228 7229 7230 7231 7232 7233 7234 7235 7236 7237 7238 7239 7240 7241 7242 7243 7244 7245 7246 7247 7248 7249 7250 7251 7252 7253 7254 7255 7256 7257 7258 7259 7260 7261 7262 7263 7264 7265 7266 7267 7268 7269 7270 7271 7272 7273 7274 7275 7276 7277 7278 7279 7280 7281 7282 7283 7284 7285 7286 7287 7288 7289 7290 7291 7292 7293 7294 7295 7296 7297 7298 7299 7300 7301 7302 7303 7304 7305 7306 7307 7308 7309 7310 7311 7312 7313 7314 7315 7316 7317 7318 7319 7320 7321 7322 7323 7324 7325 7326 7327 7328 7329 7330 7331 7332 7333 7334 7335 7336 7337 7338 7339 7340 7341 7342 7343 7344 7345 7346 7347 7348 7349 7350 7351 7352 7353 7354 7355 7356 7357 7358 7359 7360 7361 7362 7363 7364 7365 7366 7367 7368 7369 7370 7371 7372 7373 7374 7375 7376 7377 7378 7379 7380 7381 7382 7383 7384 7385 7386 7387 7388 7389 7390 7391 7392 7393 7394 7395 7396 7397 7398 7399 7400 7401 7402 7403 7404 7405 7406 7407 7408 7409 7410 7411 7412 7413 7414 7415 7416 7417 7418 7419 7420 7421 7422 7423 7424 7425 7426 7427 7428 7429 7430 7431 7432 7433 7434 7435 7436 7437 7438 7439 7440 7441 7442 7443 7444 7445 7446 7447 7448 7449 7450 7451 7452 7453 7454 7455 7456 7457 7458 7459 7460 7461 7462 7463 7464 7465 7466 7467 7468 7469 7470 7471 7472 7473 7474 7475 7476 7477 7478 7479 7480 7481 7482 7483 7484 7485 7486 7487 7488 7489 7490 7491 7492 7493 7494 7495 7496 7497 7498 7499 7500 7501 7502 7503 7504 7505 7506 7507 7508 7509 7510 7511 7512 7513 7514 7515 7516 7517 7518 7519 7520 7521 7522 7523 7524 7525 7526 7527 7528 7529 7530 7531 7532 7533 7534 7535 7536 7537 7538 7539 7540 7541 7542 7543 7544 7545 7546 7547 7548 7549 7550 7551 7552 7553 7554 7555 7556 7557 7558 7559 7560 7561 7562 7563 7564 7565 7566 7567 7568 7569 7570 7571 7572 7573 7574 7575 7576 7577 7578 7579 7580 7581 7582 7583 7584 7585 7586 7587 7588 7589 7590 7591 7592 7593 7594 7595 7596 7597 7598 7599 7600 7601 7602 7603 7604 7605 7606 7607 7608 7609 7610 7611 7612 7613 7614 7615 7616 7617 7618 7619 7620 7621 7622 7623 7624 7625 7626 7627 7628 7629 7630 7631 7632 7633 7634 7635 7636 7637 7638 7639 7640 7641 7642 7643 7644 7645 7646 7647 7648 7649 7650 7651 7652 7653 7654 7655 7656 7657 7658 7659 7660 7661 7662 7663 7664 7665 7666 7667 7668 7669 7670 7671 7672 7673 7674 7675 7676 7677 7678 7679 7680 7681 7682 7683 7684 7685 7686 7687 7688 7689 7690 7691 7692 7693 7694 7695 7696 7697 7698 7699 7700 7701 7702 7703 7704 7705 7706 7707 7708 7709 7710 7711 7712 7713 7714 7715 7716 7717 7718 7719 7720 7721 7722 7723 7724 7725 7726 7727 7728 7729 7730 7731 7732 7733 7734 7735 7736 7737 7738 7739 7740 7741 7742 7743 7744 7745 7746 7747 7748 7749 7750 7751 7752 7753 7754 7755 7756 7757 7758 7759 7760 7761 7762 7763 7764 7765 7766 7767 7768 7769 7770 7771 7772 7773 7774 7775 7776 7777 7778 7779 7780 7781 7782 7783 7784 7785 7786 7787 7788 7789 7790 7791 7792 7793 7794 7795 7796 7797 7798 7799 7800 7801 7802 7803 7804 7805 7806 7807 7808 7809 7810 7811 7812 7813 7814 7815 7816 7817 7818 7819 7820 7821 7822 7823 7824 7825 7826 7827 7828 7829 7830 7831 7832 7833 7834 7835 7836 7837 7838 7839 7840 7841 7842 7843 7844 7845 7846 7847 7848 7849 7850 7851 7852 7853 7854 7855 7856 7857 7858 7859 7860 7861 7862 7863 7864 7865 7866 7867 7868 7869 7870 7871 7872 7873 7874 7875 7876 7877 7878 7879 7880 7881 7882 7883 7884 7885 7886 7887 7888 7889 7890 7891 7892 7893 7894 7895 7896 7897 7898 7899 7900 7901 7902 7903 7904 7905 7906 7907 7908 7909 7910 7911 7912 7913 7914 7915 7916 7917 7918 7919 7920 7921 7922 7923 7924 7925 7926 7927 7928 7929 7930 7931 7932 7933 7934 7935 7936 7937 7938 7939 7940 7941 7942 7943 7944 7945 7946 7947 7948 7949 7950 7951 7952 7953 7954 7955 7956 7957 7958 7959 7960 7961 7962 7963 7964 7965 7966 7967 7968 7969 7970 7971 7972 7973 7974 7975 7976 7977 7978 7979 7980 7981 7982 7983 7984 7985 7986 7987 7988 7989 7990 7991 7992 7993 7994 7995 7996 7997 7998 7999 8000 8001 8002 8003 8004 8005 8006 8007 8008 8009 8010 8011 8012 8013 8014 8015 8016 8017 8018 8019 8020 8021 8022 8023 8024 8025 8026 8027 8028 8029 8030 8031 8032 8033 8034 8035 8036 8037 8038 8039 8040 8041 8042 8043 8044 8045 8046 8047 8048 8049 8050 8051 8052 8053 8054 8055 8056 8057 8058 8059 8060 8061 8062 8063 8064 8065 8066 8067 8068 8069 8070 8071 8072 8073 8074 8075 8076 8077 8078 8079 8080 8081 8082 8083 8084 8085 8086 8087 8088 8089 8090 8091 8092 8093 8094 8095 8096 8097 8098 8099 8100 8101 8102 8103 8104 8105 8106 8107 8108 8109 8110 8111 8112 8113 8114 8115 8116 8117 8118 8119 8120 8121 8122 8123 8124 8125 8126 8127 8128 8129 8130 8131 8132 8133 8134 8135 8136 8137 8138 8139 8140 8141 8142 8143 8144 8145 8146 8147 8148 8149 8150 8151 8152 8153 8154 8155 8156 8157 8158 8159 8160 8161 8162 8163 8164 8165 8166 8167 8168 8169 8170 8171 8172 8173 8174 8175 8176 8177 8178 8179 8180 8181 8182 8183 8184 8185 8186 8187 8188 8189 8190 8191 8192 8193 8194 8195 8196 8197 8198 8199 8200 8201 8202 8203 8204 8205 8206 8207 8208 8209 8210 8211 8212 8213 8214 8215 8216 8217 8218 8219 8220 8221 8222 8223 8224 8225 8226 8227 8228 8229 8230 8231 8232 8233 8234 8235 8236 8237 8238 8239 8240 8241 8242 8243 8244 8245 8246 8247 8248 8249 8250 8251 8252 8253 8254 8255 8256 8257 8258 8259 8260 8261 8262 8263 8264 8265 8266 8267 8268 8269 8270 8271 8272 8273 8274 8275 8276 8277 8278 8279 8280 8281 8282 8283 8284 8285 8286 8287 8288 8289 8290 8291 8292 8293 8294 8295 8296 8297 8298 8299 8300 8301 8302 8303 8304 8305 8306 8307 8308 8309 8310 8311 8312 8313 8314 8315 8316 8317 8318 8319 8320 8321 8322 8323 8324 8325 8326 8327 8328 8329 8330 8331 8332 8333 8334 8335 8336 8337 8338 8339 8340 8341 8342 8343 8344 8345 8346 8347 8348 8349 8350 8351 8352 8353 8354 8355 8356 8357 8358 8359 8360 8361 8362 8363 8364 8365 8366 8367 8368 8369 8370 8371 8372 8373 8374 8375 8376 8377 8378 8379 8380 8381 8382 8383 8384 8385 8386 8387 8388 8389 8390 8391 8392 8393 8394 8395 8396 8397 8398 8399 8400 8401 8402 8403 8404 8405 8406 8407 8408 8409 8410 8411 8412 8413 8414 8415 8416 8417 8418 8419 8420 8421 8422 8423 8424 8425 8426 8427 8428 8429 8430 8431 8432 8433 8434 8435 8436 8437 8438 8439 8440 8441 8442 8443 8444 8445 8446 8447 8448 8449 8450 8451 8452 8453 8454 8455 8456 8457 8458 8459 8460 8461 8462 8463 8464 8465 8466 8467 8468 8469 8470 8471 8472 8473 8474 8475 8476 8477 8478 8479 8480 8481 8482 8483 8484 8485 8486 8487 8488 8489 8490 8491 8492 8493 8494 8495 8496 8497 8498 8499 8500 8501 8502 8503 8504 8505 8506 8507 8508 8509 8510 8511 8512 8513 8514 8515 8516 8517 8518 8519 8520 8521 8522 8523 8524 8525 8526 8527 8528 8529 8530 8531 8532 8533 8534 8535 8536 8537 8538 8539 8540 8541 8542 8543 8544 8545 8546 8547 8548 8549 8550 8551 8552 8553 8554 8555 8556 8557 8558 8559 8560 8561 8562 8563 8564 8565 8566 8567 8568 8569 8570 8571 8572 8573 8574 8575 8576 8577 8578 8579 8580 8581 8582 8583 8584 8585 8586 8587 8588 8589 8590 8591 8592 8593 8594 8595 8596 8597 8598 8599 8600 8601 8602 8603 8604 8605 8606 8607 8608 8609 8610 8611 8612 8613 8614 8615 8616 8617 8618 8619 8620 8621 8622 8623 8624 8625 8626 8627 8628 8629 8630 8631 8632 8633 8634 8635 8636 8637 8638 8639 8640 8641 8642 8643 8644 8645 8646 8647 8648 8649 8650 8651 8652 8653 8654 8655 8656 8657 8658 8659 8660 8661 8662 8663 8664 8665 8666 8667 8668 8669 8670 8671 8672 8673 8674 8675 8676 8677 8678 8679 8680 8681 8682 8683 8684 8685 8686 8687 8688 8689 8690 8691 8692 8693 8694 8695 8696 8697 8698 8699 8700 8701 8702 8703 8704 8705 8706 8707 8708 8709 8710 8711 8712 8713 8714 8715 8716 8717 8718 8719 8720 8721 8722 8723 8724 8725 8726 8727 8728 8729 8730 8731 8732 8733 8734 8735 8736 8737 8738 8739 8740 8741 8742 8743 8744 8745 8746 8747 8748 8749 8750 8751 8752 8753 8754 8755 8756 8757 8758 8759 8760 8761 8762 8763 8764 8765 8766 8767 8768 8769 8770 8771 8772 8773 8774 8775 8776 8777 8778 8779 8780 8781 8782 8783 8784 8785 8786 8787 8788 8789 8790 8791 8792 8793 8794 8795 8796 8797 8798 8799 8800 8801 8802 8803 8804 8805 8806 8807 8808 8809 8810 8811 8812 8813 8814 8815 8816 8817 8818 8819 8820 8821 8822 8823 8824 8825 8826 8827 8828 8829 8830 8831 8832 8833 8834 8835 8836 8837 8838 8839 8840 8841 8842 8843 8844 8845 8846 8847 8848 8849 8850 8851 8852 8853 8854 8855 8856 8857 8858 8859 8860 8861 8862 8863 8864 8865 8866 8867 8868 8869 8870 8871 8872 8873 8874 8875 8876 8877 8878 8879 8880 8881 8882 8883 8884 8885 8886 8887 8888 8889 8890 8891 8892 8893 8894 8895 8896 8897 8898 8899 8900 8901 8902 8903 8904 8905 8906 8907 8908 8909 8910 8911 8912 8913 8914 8915 8916 8917 8918 8919 8920 8921 8922 8923 8924 8925 8926 8927 8928 8929 8930 8931 8932 8933 8934 8935 8936 8937 8938 8939 8940 8941 8942 8943 8944 8945 8946 8947 8948 8949 8950 8951 8952 8953 8954 8955 8956 8957 8958 8959 8960 8961 8962 8963 8964 8965 8966 8967 8968 8969 8970 8971 8972 8973 8974 8975 8976 8977 8978 8979 8980 8981 8982 8983 8984 8985 8986 8987 8988 8989 8990 8991 8992 8993 8994 8995 8996 8997 8998 8999 9000 9001 9002 9003 9004 9005 9006 9007 9008 9009 9010 9011 9012 9013 9014 9015 9016 9017 9018 9019 9020 9021 9022 9023 9024 9025 9026 9027 9028 9029 9030 9031 9032 9033 9034 9035 9036 9037 9038 9039 9040 9041 9042 9043 9044 9045 9046 9047 9048 9049 9050 9051 9052 9053 9054 9055 9056 9057 9058 9059 9060 9061 9062 9063 9064 9065 9066 9067 9068 9069 9070 9071 9072 9073 9074 9075 9076 9077 9078 9079 9080 9081 9082 9083 9084 9085 9086 9087 9088 9089 9090 9091 9092 9093 9094 9095 9096 9097 9098 9099 9100 9101 9102 9103 9104 9105 9106 9107 9108 9109 9110 9111 9112 9113 9114 9115 9116 9117 9118 9119 9120 9121 9122 9123 9124 9125 9126 9127 9128 9129 9130 9131 9132 9133 9134 9135 9136 9137 9138 9139 9140 9141 9142 9143 9144 9145 9146 9147 9148 9149 9150 9151 9152 9153 9154 9155 9156 9157 9158 9159 9160 9161 9162 9163 9164 9165 9166 9167 9168 9169 9170 9171 9172 9173 9174 9175 9176 9177 9178 9179 9180 9181 9182 9183 9184 9185 9186 9187 9188 9189 9190 9191 9192 9193 9194 9195 9196 9197 9198 9199 9200 9201 9202 9203 9204 9205 9206 9207 9208 9209 9210 9211 9212 9213 9214 9215 9216 9217 9218 9219 9220 9221 9222 9223 9224 9225 9226 9227 9228 9229 9230 9231 9232 9233 9234 9235 9236 9237 9238 9239 9240 9241 9242 9243 9244 9245 9246 9247 9248 9249 9250 9251 9252 9253 9254 9255 9256 9257 9258 9259 9260 9261 9262 9263 9264 9265 9266 9267 9268 9269 9270 9271 9272 9273 9274 9275 9276 9277 9278 9279 9280 9281 9282 9283 9284 9285 9286 9287 9288 9289 9290 9291 9292 9293 9294 9295 9296 9297 9298 9299 9300 9301 9302 9303 9304 9305 9306 9307 9308 9309 9310 9311 9312 9313 9314 9315 9316 9317 9318 9319 9320 9321 9322 9323 9324 9325 9326 9327 9328 9329 9330 9331 9332 9333 9334 9335 9336 9337 9338 9339 9340 9341 9342 9343 9344 9345 9346 9347 9348 9349 9350 9351 9352 9353 9354 9355 9356 9357 9358 9359 9360 9361 9362 9363 9364 9365 9366 9367 9368 9369 9370 9371 9372 9373 9374 9375 9376 9377 9378 9379 9380 9381 9382 9383 9384 9385 9386 9387 9388 9389 9390 9391 9392 9393 9394 9395 9396 9397 9398 9399 9400 9401 9402 9403 9404 9405 9406 9407 9408 9409 9410 9411 9412 9413 9414 9415 9416 9417 9418 9419 9420 9421 9422 9423 9424 9425 9426 9427 9428 9429 9430 9431 9432 9433 9434 9435 9436 9437 9438 9439 9440 9441 9442 9443 9444 9445 9446 9447 9448 9449 9450 9451 9452 9453 9454 9455 9456 9457 9458 9459 9460 9461 9462 9463 9464 9465 9466 9467 9468 9469 9470 9471 9472 9473 9474 9475 9476 9477 9478 9479 9480 9481 9482 9483 9484 9485 9486 9487 9488 9489 9490 9491 9492 9493 9494 9495 9496 9497 9498 9499 9500 9501 9502 9503 9504 9505 9506 9507 9508 9509 9510 9511 9512 9513 9514 9515 9516 9517 9518 9519 9520 9521 9522 9523 9524 9525 9526 9527 9528 9529 9530 9531 9532 9533 9534 9535 9536 9537 9538 9539 9540 9541 9542 9543 9544 9545 9546 9547 9548 9549 9550 9551 9552 9553 9554 9555 9556 9557 9558 9559 9560 9561 9562 9563 9564 9565 9566 9567 9568 9569 9570 9571 9572 9573 9574 9575 9576 9577 9578 9579 9580 9581 9582 9583 9584 9585 9586 9587 9588 9589 9590 9591 9592 9593 9594 9595 9596 9597 9598 9599 9600 9601 9602 9603 9604 9605 9606 9607 9608 9609 9610 9611 9612 9613 9614 9615 9616 9617 9618 9619 9620 9621 9622 9623 9624 9625 9626 9627 9628 9629 9630 9631 9632 9633 9634 9635 9636 9637 9638 9639 9640 9641 9642 9643 9644 9645 9646 9647 9648 9649 9650 9651 9652 9653 9654 9655 9656 9657 9658 9659 9660 9661 9662 9663 9664 9665 9666 9667 9668 9669 9670 9671 9672 9673 9674 9675 9676 9677 9678 9679 9680 9681 9682 9683 9684 9685 9686 9687 9688 9689 9690 9691 9692 9693 9694 9695 9696 9697 9698 9699 9700 9701 9702 9703 9704 9705 9706 9707 9708 9709 9710 9711 9712 9713 9714 9715 9716 9717 9718 9719 9720 9721 9722 9723 9724 9725 9726 9727 9728 9729 9730 9731 9732 9733 9734 9735 9736 9737 9738 9739 9740 9741 9742 9743 9744 9745 9746 9747 9748 9749 9750 9751 9752 9753 9754 9755 9756 9757 9758 9759 9760 9761 9762 9763 9764 9765 9766 9767 9768 9769 9770 9771 9772 9773 9774 9775 9776 9777 9778 9779 9780 9781 9782 9783 9784 9785 9786 9787 9788 9789 9790 9791 9792 9793 9794 9795 9796 9797 9798 9799 9800 9801 9802 9803 9804 9805 9806 9807 9808 9809 9810 9811 9812 9813 9814 9815 9816 9817 9818 9819 9820 9821 9822 9823 9824 9825 9826 9827 9828 9829 9830 9831 9832 9833 9834 9835 9836 9837 9838 9839 9840 9841 9842 9843 9844 9845 9846 9847 9848 9849 9850 9851 9852 9853 9854 9855 9856 9857 9858 9859 9860 9861 9862 9863 9864 9865 9866 9867 9868 9869 9870 9871 9872 9873 9874 9875 9876 9877 9878 9879 9880 9881 9882 9883 9884 9885 9886 9887 9888 9889 9890 9891 9892 9893 9894 9895 9896 9897 9898 9899 9900 9901 9902 9903 9904 9905 9906 9907 9908 9909 9910 9911 9912 9913 9914 9915 9916 9917 9918 9919 9920 9921 9922 9923 9924 9925 9926 9927 9928 9929 9930 9931 9932 9933 9934 9935 9936 9937 9938 9939 9940 9941 9942 9943 9944 9945 9946 9947 9948 9949 9950 9951 9952 9953 9954 9955 9956 9957 9958 9959 9960 9961 9962 9963 9964 9965 9966 9967 9968 9969 9970 9971 9972 9973 9974 9975 9976 9977 9978 9979 9980 9981 9982 9983 9984 9985 9986 9987 9988 9989 9990 9991 9992 9993 9994 9995 9996 9997 9998 9999 10000 10001 10002 10003 10004 10005 10006 10007 10008 10009 10010 10011 10012 10013 10014 10015 10016 10017 10018 10019 10020 10021 10022 10023 10024 10025 10026 10027 10028 10029 10030 10031 10032 10033 10034 10035 10036 10037 10038 10039 10040 10041 10042 10043 10044 10045 10046 10047 10048 10049 10050 10051 10052 10053 10054 10055 10056 10057 10058 10059 10060 10061 10062 10063 10064 10065 10066 10067 10068 10069 10070 10071 10072 10073 10074 10075 10076 10077 10078 10079 10080 10081 10082 10083 10084 10085 10086 10087 10088 10089 10090 10091 10092 10093 10094 10095 10096 10097 10098 10099 10100 10101 10102 10103 10104 10105 10106 10107 10108 10109 10110 10111 10112 10113 10114 10115 10116 10117 10118 10119 10120 10121 10122 10123 10124 10125 10126 10127 10128 10129 10130 10131 10132 10133 10134 10135 10136 10137 10138 10139 10140 10141 10142 10143 10144 10145 10146 10147 10148 10149 10150 10151 10152 10153 10154 10155 10156 10157 10158 10159 10160 10161 10162 10163 10164 10165 10166 10167 10168 10169 10170 10171 10172 10173 10174 10175 10176 10177 10178 10179 10180 10181 10182 10183 10184 10185 10186 10187 10188 10189 10190 10191 10192 10193 10194 10195 10196 10197 10198 10199 10200 10201 10202 10203 10204 10205 10206 10207 10208 10209 10210 10211 10212 10213 10214 10215 10216 10217 10218 10219 10220 10221 10222 10223 10224 10225 10226 10227 10228 10229 10230 10231 10232 10233 10234 10235 10236 10237 10238 10239 10240 10241 10242 10243 10244 10245 10246 10247 10248 10249 10250 10251 10252 10253 10254 10255 10256 10257 10258 10259 10260 10261 10262 10263 10264 10265 10266 10267 10268 10269 10270 10271 10272 10273 10274 10275 10276 10277 10278 10279 10280 10281 10282 10283 10284 10285 10286 10287 10288 10289 10290 10291 10292 10293 10294 10295 10296 10297 10298 10299 10300 10301 10302 10303 10304 10305 10306 10307 10308 10309 10310 10311 10312 10313 10314 10315 10316 10317 10318 10319 10320 10321 10322 10323 10324 10325 10326 10327 10328 10329 10330 10331 10332 10333 10334 10335 10336 10337 10338 10339 10340 10341 10342 10343 10344 10345 10346 10347 10348 10349 10350 10351 10352 10353 10354 10355 10356 10357 10358 10359 10360 10361 10362 10363 10364 10365 10366 10367 10368 10369 10370 10371 10372 10373 10374 10375 10376 10377 10378 10379 10380 10381 10382 10383 10384 10385 10386 10387 10388 10389 10390 10391 10392 10393 10394 10395 10396 10397 10398 10399 10400 10401 10402 10403 10404 10405 10406 10407 10408 10409 10410 10411 10412 10413 10414 10415 10416 10417 10418 10419 10420 10421 10422 10423 10424 10425 10426 10427 10428 10429 10430 10431 10432 10433 10434 10435 10436 10437 10438 10439 10440 10441 10442 10443 10444 10445 10446 10447 10448 10449 10450 10451 10452 10453 10454 10455 10456 10457 10458 10459 10460 10461 10462 10463 10464 10465 10466 10467 10468 10469 10470 10471 10472 10473 10474 10475 10476 10477 10478 10479 10480 10481 10482 10483 10484 10485 10486 10487 10488 10489 10490 10491 10492 10493 10494 10495 10496 10497 10498 10499 10500 10501 10502 10503 10504 10505 10506 10507 10508 10509 10510 10511 10512 10513 10514 10515 10516 10517 10518 10519 10520 10521 10522 10523 10524 10525 10526 10527 10528 10529 10530 10531 10532 10533 10534 10535 10536 10537 10538 10539 10540 10541 10542 10543 10544 10545 10546 10547 10548 10549 10550 10551 10552 10553 10554 10555 10556 10557 10558 10559 10560 10561 10562 10563 10564 10565 10566 10567 10568 10569 10570 10571 10572 10573 10574 10575 10576 10577 10578 10579 10580 10581 10582 10583 10584 10585 10586 10587 10588 10589 10590 10591 10592 10593 10594 10595 10596 10597 10598 10599 10600 10601 10602 10603 10604 10605 10606 10607 10608 10609 10610 10611 10612 10613 10614 10615 10616 10617 10618 10619 10620 10621 10622 10623 10624 10625 10626 10627 10628 10629 10630 10631 10632 10633 10634 10635 10636 10637 10638 10639 10640 10641 10642 10643 10644 10645 10646 10647 10648 10649 10650 10651 10652 10653 10654 10655 10656 10657 10658 10659 10660 10661 10662 10663 10664 10665 10666 10667 10668 10669 10670 10671 10672 10673 10674 10675 10676 10677 10678 10679 10680 10681 10682 10683 10684 10685 10686 10687 10688 10689 10690 10691 10692 10693 10694 10695 10696 10697 10698 10699 10700 10701 10702 10703 10704 10705 10706 10707 10708 10709 10710 10711 10712 10713 10714 10715 10716 10717 10718 10719 10720 10721 10722 10723 10724 10725 10726 10727 10728 10729 10730 10731 10732 10733 10734 10735 10736 10737 10738 10739 10740 10741 10742 10743 10744 10745 10746 10747 10748 10749 10750 10751 10752 10753 10754 10755 10756 10757 10758 10759 10760 10761 10762 10763 10764 10765 10766 10767 10768 10769 10770 10771 10772 10773 10774 10775 10776 10777 10778 10779 10780 10781 10782 10783 10784 10785 10786 10787 10788 10789 10790 10791 10792 10793 10794 10795 10796 10797 10798 10799 10800 10801 10802 10803 10804 10805 10806 10807 10808 10809 10810 10811 10812 10813 10814 10815 10816 10817 10818 10819 10820 10821 10822 10823 10824 10825 10826 10827 10828 10829 10830 10831 10832 10833 10834 10835 10836 10837 10838 10839 10840 10841 10842 10843 10844 10845 10846 10847 10848 10849 10850 10851 10852 10853 10854 10855 10856 10857 10858 10859 10860 10861 10862 10863 10864 10865 10866 10867 10868 10869 10870 10871 10872 10873 10874 10875 10876 10877 10878 10879 10880 10881 10882 10883 10884 10885 10886 10887 10888 10889 10890 10891 10892 10893 10894 10895 10896 10897 10898 10899 10900 10901 10902 10903 10904 10905 10906 10907 10908 10909 10910 10911 10912 10913 10914 10915 10916 10917 10918 10919 10920 10921 10922 10923 10924 10925 10926 10927 10928 10929 10930 10931 10932 10933 10934 10935 10936 10937 10938 10939 10940 10941 10942 10943 10944 10945 10946 10947 10948 10949 10950 10951 10952 10953 10954 10955 10956 10957 10958 10959 10960 10961 10962 10963 10964 10965 10966 10967 10968 10969 10970 10971 10972 10973 10974 10975 10976 10977 10978 10979 10980 10981 10982 10983 10984 10985 10986 10987 10988 10989 10990 10991 10992 10993 10994 10995 10996 10997 10998 10999 11000 11001 11002 11003 11004 11005 11006 11007 11008 11009 11010 11011 11012 11013 11014 11015 11016 11017 11018 11019 11020 11021 11022 11023 11024 11025 11026 11027 11028 11029 11030 11031 11032 11033 11034 11035 11036 11037 11038 11039 11040 11041 11042 11043 11044 11045 11046 11047 11048 11049 11050 11051 11052 11053 11054 11055 11056 11057 11058 11059 11060 11061 11062 11063 11064 11065 11066 11067 11068 11069 11070 11071 11072 11073 11074 11075 11076 11077 11078 11079 11080 11081 11082 11083 11084 11085 11086 11087 11088 11089 11090 11091 11092 11093 11094 11095 11096 11097 11098 11099 11100 11101 11102 11103 11104 11105 11106 11107 11108 11109 11110 11111 11112 11113 11114 11115 11116 11117 11118 11119 11120 11121 11122 11123 11124 11125 11126 11127 11128 11129 11130 11131 11132 11133 11134 11135 11136 11137 11138 11139 11140 11141 11142 11143 11144 11145 11146 11147 11148 11149 11150 11151 11152 11153 11154 11155 11156 11157 11158 11159 11160 11161 11162 11163 11164 11165 11166 11167 11168 11169 11170 11171 11172 11173 11174 11175 11176 11177 11178 11179 11180 11181 11182 11183 11184 11185 11186 11187 11188 11189 11190 11191 11192 11193 11194 11195 11196 11197 11198 11199 11200 11201 11202 11203 11204 11205 11206 11207 11208 11209 11210 11211 11212 11213 11214 11215 11216 11217 11218 11219 11220 11221 11222 11223 11224 11225 11226 11227 11228 11229 11230 11231 11232 11233 11234 11235 11236 11237 11238 11239 11240 11241 11242 11243 11244 11245 11246 11247 11248 11249 11250 11251 11252 11253 11254 11255 11256 11257 11258 11259 11260 11261 11262 11263 11264 11265 11266 11267 11268 11269 11270 11271 11272 11273 11274 11275 11276 11277 11278 11279 11280 11281 11282 11283 11284 11285 11286 11287 11288 11289 11290 11291 11292 11293 11294 11295 11296 11297 11298 11299 11300 11301 11302 11303 11304 11305 11306 11307 11308 11309 11310 11311 11312 11313 11314 11315 11316 11317 11318 11319 11320 11321 11322 11323 11324 11325 11326 11327 11328 11329 11330 11331 11332 11333 11334 11335 11336 11337 11338 11339 11340 11341 11342 11343 11344 11345 11346 11347 11348 11349 11350 11351 11352 11353 11354 11355 11356 11357 11358 11359 11360 11361 11362 11363 11364 11365 11366 11367 11368 11369 11370 11371 11372 11373 11374 11375 11376 11377 11378 11379 11380 11381 11382 11383 11384 11385 11386 11387 11388 11389 11390 11391 11392 11393 11394 11395 11396 11397 11398 11399 11400 11401 11402 11403 11404 11405 11406 11407 11408 11409 11410 11411 11412 11413 11414 11415 11416 11417 11418 11419 11420 11421 11422 11423 11424 11425 11426 11427 11428 11429 11430 11431 11432 11433 11434 11435 11436 11437 11438 11439 11440 11441 11442 11443 11444 11445 11446 11447 11448 11449 11450 11451 11452 11453 11454 11455 11456 11457 11458 11459 11460 11461 11462 11463 11464 11465 11466 11467 11468 11469 11470 11471 11472 11473 11474 11475 11476 11477 11478 11479 11480 11481 11482 11483 11484 11485 11486 11487 11488 11489 11490 11491 11492 11493 11494 11495 11496 11497 11498 11499 11500 11501 11502 11503 11504 11505 11506 11507 11508 11509 11510 11511 11512 11513 11514 11515 11516 11517 11518 11519 11520 11521 11522 11523 11524 11525 11526 11527 11528 11529 11530 11531 11532 11533 11534 11535 11536 11537 11538 11539 11540 11541 11542 11543 11544 11545 11546 11547 11548 11549 11550 11551 11552 11553 11554 11555 11556 11557 11558 11559 11560 11561 11562 11563 11564 11565 11566 11567 11568 11569 11570 11571 11572 11573 11574 11575 11576 11577 11578 11579 11580 11581 11582 11583 11584 11585 11586 11587 11588 11589 11590 11591 11592 11593 11594 11595 11596 11597 11598 11599 11600 11601 11602 11603 11604 11605 11606 11607 11608 11609 11610 11611 11612 11613 11614 11615 11616 11617 11618 11619 11620 11621 11622 11623 11624 11625 11626 11627 11628 11629 11630 11631 11632 11633 11634 11635 11636 11637 11638 11639 11640 11641 11642 11643 11644 11645 11646 11647 11648 11649 11650 11651 11652 11653 11654 11655 11656 11657 11658 11659 11660 11661 11662 11663 11664 11665 11666 11667 11668 11669 11670 11671 11672 11673 11674 11675 11676 11677 11678 11679 11680 11681 11682 11683 11684 11685 11686 11687 11688 11689 11690 11691 11692 11693 11694 11695 11696 11697 11698 11699 11700 11701 11702 11703 11704 11705 11706 11707 11708 11709 11710 11711 11712 11713 11714 11715 11716 11717 11718 11719 11720 11721 11722 11723 11724 11725 11726 11727 11728 11729 11730 11731 11732 11733 11734 11735 11736 11737 11738 11739 11740 11741 11742 11743 11744 11745 11746 11747 11748 11749 11750 11751 11752 11753 11754 11755 11756 11757 11758 11759 11760 11761 11762 11763 11764 11765 11766 11767 11768 11769 11770 11771 11772 11773 11774 11775 11776 11777 11778 11779 11780 11781 11782 11783 11784 11785 11786 11787 11788 11789 11790 11791 11792 11793 11794 11795 11796 11797 11798 11799 11800 11801 11802 11803 11804 11805 11806 11807 11808 11809 11810 11811 11812 11813 11814 11815 11816 11817 11818 11819 11820 11821 11822 11823 11824 11825 11826 11827 11828 11829 11830 11831 11832 11833 11834 11835 11836 11837 11838 11839 11840 11841 11842 11843 11844 11845 11846 11847 11848 11849 11850 11851 11852 11853 11854 11855 11856 11857 11858 11859 11860 11861 11862 11863 11864 11865 11866 11867 11868 11869 11870 11871 11872 11873 11874 11875 11876 11877 11878 11879 11880 11881 11882 11883 11884 11885 11886 11887 11888 11889 11890 11891 11892 11893 11894 11895 11896 11897 11898 11899 11900 11901 11902 11903 11904 11905 11906 11907 11908 11909 11910 11911 11912 11913 11914 11915 11916 11917 11918 11919 11920 11921 11922 11923 11924 11925 11926 11927 11928 11929 11930 11931 11932 11933 11934 11935 11936 11937 11938 11939 11940 11941 11942 11943 11944 11945 11946 11947 11948 11949 11950 11951 11952 11953 11954 11955 11956 11957 11958 11959 11960 11961 11962 11963 11964 11965 11966 11967 11968 11969 11970 11971 11972 11973 11974 11975 11976 11977 11978 11979 11980 11981 11982 11983 11984 11985 11986 11987 11988 11989 11990 11991 11992 11993 11994 11995 11996 11997 11998 11999 12000 12001 12002 12003 12004 12005 12006 12007 12008 12009 12010 12011 12012 12013 12014 12015 12016 12017 12018 12019 12020 12021 12022 12023 12024 12025 12026 12027 12028 12029 12030 12031 12032 12033 12034 12035 12036 12037 12038 12039 12040 12041 12042 12043 12044 12045 12046 12047 12048 12049 12050 12051 12052 12053 12054 12055 12056 12057 12058 12059 12060 12061 12062 12063 12064 12065 12066 12067 12068 12069 12070 12071 12072 12073 12074 12075 12076 12077 12078 12079 12080 12081 12082 12083 12084 12085 12086 12087 12088 12089 12090 12091 12092 12093 12094 12095 12096 12097 12098 12099 12100 12101 12102 12103 12104 12105 12106 12107 12108 12109 12110 12111 12112 12113 12114 12115 12116 12117 12118 12119 12120 12121 12122 12123 12124 12125 12126 12127 12128 12129 12130 12131 12132 12133 12134 12135 12136 12137 12138 12139 12140 12141 12142 12143 12144 12145 12146 12147 12148 12149 12150 12151 12152 12153 12154 12155 12156 12157 12158 12159 12160 12161 12162 12163 12164 12165 12166 12167 12168 12169 12170 12171 12172 12173 12174 12175 12176 12177 12178 12179 12180 12181 12182 12183 12184 12185 12186 12187 12188 12189 12190 12191 12192 12193 12194 12195 12196 12197 12198 12199 12200 12201 12202 12203 12204 12205 12206 12207 12208 12209 12210 12211 12212 12213 12214 12215 12216 12217 12218 12219 12220 12221 12222 12223 12224 12225 12226 12227 12228 12229 12230 12231 12232 12233 12234 12235 12236 12237 12238 12239 12240 12241 12242 12243 12244 12245 12246 12247 12248 12249 12250 12251 12252 12253 12254 12255 12256 12257 12258 12259 12260 12261 12262 12263 12264 12265 12266 12267 12268 12269 12270 12271 12272 12273 12274 12275 12276 12277 12278 12279 12280 12281 12282 12283 12284 12285 12286 12287 12288 12289 12290 12291 12292 12293 12294 12295 12296 12297 12298 12299 12300 12301 12302 12303 12304 12305 12306 12307 12308 12309 12310 12311 12312 12313 12314 12315 12316 12317 12318 12319 12320 12321 12322 12323 12324 12325 12326 12327 12328 12329 12330 12331 12332 12333 12334 12335 12336 12337 12338 12339 12340 12341 12342 12343 12344 12345 12346 12347 12348 12349 12350 12351 12352 12353 12354 12355 12356 12357 12358 12359 12360 12361 12362 12363 12364 12365 12366 12367 12368 12369 12370 12371 12372 12373 12374 12375 12376 12377 12378 12379 12380 12381 12382 12383 12384 12385 12386 12387 12388 12389 12390 12391 12392 12393 12394 12395 12396 12397 12398 12399 12400 12401 12402 12403 12404 12405 12406 12407 12408 12409 12410 12411 12412 12413 12414 12415 12416 12417 12418 12419 12420 12421 12422 12423 12424 12425 12426 12427 12428 12429 12430 12431 12432 12433 12434 12435 12436 12437 12438 12439 12440 12441 12442 12443 12444 12445 12446 12447 12448 12449 12450 12451 12452 12453 12454 12455 12456 12457 12458 12459 12460 12461 12462 12463 12464 12465 12466 12467 12468 12469 12470 12471 12472 12473 12474 12475 12476 12477 12478 12479 12480 12481 12482 12483 12484 12485 12486 12487 12488 12489 12490 12491 12492 12493 12494 12495 12496 12497 12498 12499 12500 12501 12502 12503 12504 12505 12506 12507 12508 12509 12510 12511 12512 12513 12514 12515 12516 12517 12518 12519 12520 12521 12522 12523 12524 12525 12526 12527 12528 12529 12530 12531 12532 12533 12534 12535 12536 12537 12538 12539 12540 12541 12542 12543 12544 12545 12546 12547 12548 12549 12550 12551 12552 12553 12554 12555 12556 12557 12558 12559 12560 12561 12562 12563 12564 12565 12566 12567 12568 12569 12570 12571 12572 12573 12574 12575 12576 12577 12578 12579 12580 12581 12582 12583 12584 12585 12586 12587 12588 12589 12590 12591 12592 12593 12594 12595 12596 12597 12598 12599 12600 12601 12602 12603 12604 12605 12606 12607 12608 12609 12610 12611 12612 12613 12614 12615 12616 12617 12618 12619 12620 12621 12622 12623 12624 12625 12626 12627 12628 12629 12630 12631 12632 12633 12634 12635 12636 12637 12638 12639 12640 12641 12642 12643 12644 12645 12646 12647 12648 12649 12650 12651 12652 12653 12654 12655 12656 12657 12658 12659 12660 12661 12662 12663 12664 12665 12666 12667 12668 12669 12670 12671 12672 12673 12674 12675 12676 12677 12678 12679 12680 12681 12682 12683 12684 12685 12686 12687 12688 12689 12690 12691 12692 12693 12694 12695 12696 12697 12698 12699 12700 12701 12702 12703 12704 12705 12706 12707 12708 12709 12710 12711 12712 12713 12714 12715 12716 12717 12718 12719 12720 12721 12722 12723 12724 12725 12726 12727 12728 12729 12730 12731 12732 12733 12734 12735 12736 12737 12738 12739 12740 12741 12742 12743 12744 12745 12746 12747 12748 12749 12750 12751 12752 12753 12754 12755 12756 12757 12758 12759 12760 12761 12762 12763 12764 12765 12766 12767 12768 12769 12770 12771 12772 12773 12774 12775 12776 12777 12778 12779 12780 12781 12782 12783 12784 12785 12786 12787 12788 12789 12790 12791 12792 12793 12794 12795 12796 12797 12798 12799 12800 12801 12802 12803 12804 12805 12806 12807 12808 12809 12810 12811 12812 12813 12814 12815 12816 12817 12818 12819 12820 12821 12822 12823 12824 12825 12826 12827 12828 12829 12830 12831 12832 12833 12834 12835 12836 12837 12838 12839 12840 12841 12842 12843 12844 12845 12846 12847 12848 12849 12850 12851 12852 12853 12854 12855 12856 12857 12858 12859 12860 12861 12862 12863 12864 12865 12866 12867 12868 12869 12870 12871 12872 12873 12874 12875 12876 12877 12878 12879 12880 12881 12882 12883 12884 12885 12886 12887 12888 12889 12890 12891 12892 12893 12894 12895 12896 12897 12898 12899 12900 12901 12902 12903 12904 12905 12906 12907 12908 12909 12910 12911 12912 12913 12914 12915 12916 12917 12918 12919 12920 12921 12922 12923 12924 12925 12926 12927 12928 12929 12930 12931 12932 12933 12934 12935 12936 12937 12938 12939 12940 12941 12942 12943 12944 12945 12946 12947 12948 12949 12950 12951 12952 12953 12954 12955 12956 12957 12958 12959 12960 12961 12962 12963 12964 12965 12966 12967 12968 12969 12970 12971 12972 12973 12974 12975 12976 12977 12978 12979 12980 12981 12982 12983 12984 12985 12986 12987 12988 12989 12990 12991 12992 12993 12994 12995 12996 12997 12998 12999 13000 13001 13002 13003 13004 13005 13006 13007 13008 13009 13010 13011 13012 13013 13014 13015 13016 13017 13018 13019 13020 13021 13022 13023 13024 13025 13026 13027 13028 13029 13030 13031 13032 13033 13034 13035 13036 13037 13038 13039 13040 13041 13042 13043 13044 13045 13046 13047 13048 13049 13050 13051 13052 13053 13054 13055 13056 13057 13058 13059 13060 13061 13062 13063 13064 13065 13066 13067 13068 13069 13070 13071 13072 13073 13074 13075 13076 13077 13078 13079 13080 13081 13082 13083 13084 13085 13086 13087 13088 13089 13090 13091 13092 13093 13094 13095 13096 13097 13098 13099 13100 13101 13102 13103 13104 13105 13106 13107 13108 13109 13110 13111 13112 13113 13114 13115 13116 13117 13118 13119 13120 13121 13122 13123 13124 13125 13126 13127 13128 13129 13130 13131 13132 13133 13134 13135 13136 13137 13138 13139 13140 13141 13142 13143 13144 13145 13146 13147 13148 13149 13150 13151 13152 13153 13154 13155 13156 13157 13158 13159 13160 13161 13162 13163 13164 13165 13166 13167 13168 13169 13170 13171 13172 13173 13174 13175 13176 13177 13178 13179 13180 13181 13182 13183 13184 13185 13186 13187 13188 13189 13190 13191 13192 13193 13194 13195 13196 13197 13198 13199 13200 13201 13202 13203 13204 13205 13206 13207 13208 13209 13210 13211 13212 13213 13214 13215 13216 13217 13218 13219 13220 13221 13222 13223 13224 13225 13226 13227 13228 13229 13230 13231 13232 13233 13234 13235 13236 13237 13238 13239 13240 13241 13242 13243 13244 13245 13246 13247 13248 13249 13250 13251 13252 13253 13254 13255 13256 13257 13258 13259 13260 13261 13262 13263 13264 13265 13266 13267 13268 13269 13270 13271 13272 13273 13274 13275 13276 13277 13278 13279 13280 13281 13282 13283 13284 13285 13286 13287 13288 13289 13290 13291 13292 13293 13294 13295 13296 13297 13298 13299 13300 13301 13302 13303 13304 13305 13306 13307 13308 13309 13310 13311 13312 13313 13314 13315 13316 13317 13318 13319 13320 13321 13322 13323 13324 13325 13326 13327 13328 13329 13330 13331 13332 13333 13334 13335 13336 13337 13338 13339 13340 13341 13342 13343 13344 13345 13346 13347 13348 13349 13350 13351 13352 13353 13354 13355 13356 13357 13358 13359 13360 13361 13362 13363 13364 13365 13366 13367 13368 13369 13370 13371 13372 13373 13374 13375 13376 13377 13378 13379 13380 13381 13382 13383 13384 13385 13386 13387 13388 13389 13390 13391 13392 13393 13394 13395 13396 13397 13398 13399 13400 13401 13402 13403 13404 13405 13406 13407 13408 13409 13410 13411 13412 13413 13414 13415 13416 13417 13418 13419 13420 13421 13422 13423 13424 13425 13426 13427 13428 13429 13430 13431 13432 13433 13434 13435 13436 13437 13438 13439 13440 13441 13442 13443 13444 13445 13446 13447 13448 13449 13450 13451 13452 13453 13454 13455 13456 13457 13458 13459 13460 13461 13462 13463 13464 13465 13466 13467 13468 13469 13470 13471 13472 13473 13474 13475 13476 13477 13478 13479 13480 13481 13482 13483 13484 13485 13486 13487 13488 13489 13490 13491 13492 13493 13494 13495 13496 13497 13498 13499 13500 13501 13502 13503 13504 13505 13506 13507 13508 13509 13510 13511 13512 13513 13514 13515 13516 13517 13518 13519 13520 13521 13522 13523 13524 13525 13526 13527 13528 13529 13530 13531 13532 13533 13534 13535 13536 13537 13538 13539 13540 13541 13542 13543 13544 13545 13546 13547 13548 13549 13550 13551 13552 13553 13554 13555 13556 13557 13558 13559 13560 13561 13562 13563 13564 13565 13566 13567 13568 13569 13570 13571 13572 13573 13574 13575 13576 13577 13578 13579 13580 13581 13582 13583 13584 13585 13586 13587 13588 13589 13590 13591 13592 13593 13594 13595 13596 13597 13598 13599 13600 13601 13602 13603 13604 13605 13606 13607 13608 13609 13610 13611 13612 13613 13614 13615 13616 13617 13618 13619 13620 13621 13622 13623 13624 13625 13626 13627 13628 13629 13630 13631 13632 13633 13634 13635 13636 13637 13638 13639 13640 13641 13642 13643 13644 13645 13646 13647 13648 13649 13650 13651 13652 13653 13654 13655 13656 13657 13658 13659 13660 13661 13662 13663 13664 13665 13666 13667 13668 13669 13670 13671 13672 13673 13674 13675 13676 13677 13678 13679 13680 13681 13682 13683 13684 13685 13686 13687 13688 13689 13690 13691 13692 13693 13694 13695 13696 13697 13698 13699 13700 13701 13702 13703 13704 13705 13706 13707 13708 13709 13710 13711 13712 13713 13714 13715 13716 13717 13718 13719 13720 13721 13722 13723 13724 13725 13726 13727 13728 13729 13730 13731 13732 13733 13734 13735 13736 13737 13738 13739 13740 13741 13742 13743 13744 13745 13746 13747 13748 13749 13750 13751 13752 13753 13754 13755 13756 13757 13758 13759 13760 13761 13762 13763 13764 13765 13766 13767 13768 13769 13770 13771 13772 13773 13774 13775 13776 13777 13778 13779 13780 13781 13782 13783 13784 13785 13786 13787 13788 13789 13790 13791 13792 13793 13794 13795 13796 13797 13798 13799 13800 13801 13802 13803 13804 13805 13806 13807 13808 13809 13810 13811 13812 13813 13814 13815 13816 13817 13818 13819 13820 13821 13822 13823 13824 13825 13826 13827 13828 13829 13830 13831 13832 13833 13834 13835 13836 13837 13838 13839 13840 13841 13842 13843 13844 13845 13846 13847 13848 13849 13850 13851 13852 13853 13854 13855 13856 13857 13858 13859 13860 13861 13862 13863 13864 13865 13866 13867 13868 13869 13870 13871 13872 13873 13874 13875 13876 13877 13878 13879 13880 13881 13882 13883 13884 13885 13886 13887 13888 13889 13890 13891 13892 13893 13894 13895 13896 13897 13898 13899 13900 13901 13902 13903 13904 13905 13906 13907 13908 13909 13910 13911 13912 13913 13914 13915 13916 13917 13918 13919 13920 13921 13922 13923 13924 13925 13926 13927 13928 13929 13930 13931 13932 13933 13934 13935 13936 13937 13938 13939 13940 13941 13942 13943 13944 13945 13946 13947 13948 13949 13950 13951 13952 13953 13954 13955 13956 13957 13958 13959 13960 13961 13962 13963 13964 13965 13966 13967 13968 13969 13970 13971 13972 13973 13974 13975 13976 13977 13978 13979 13980 13981 13982 13983 13984 13985 13986 13987 13988 13989 13990 13991 13992 13993 13994 13995 13996 13997 13998 13999 14000 14001 14002 14003 14004 14005 14006 14007 14008 14009 14010 14011 14012 14013 14014 14015 14016 14017 14018 14019 14020 14021 14022 14023 14024 14025 14026 14027 14028 14029 14030 14031 14032 14033 14034 14035 14036 14037 14038 14039 14040 14041 14042 14043 14044 14045 14046 14047 14048 14049 14050 14051 14052 14053 14054 14055 14056 14057 14058 14059 14060 14061 14062 14063 14064 14065 14066 14067 14068 14069 14070 14071 14072 14073 14074 14075 14076 14077 14078 14079 14080 14081 14082 14083 14084 14085 14086 14087 14088 14089 14090 14091 14092 14093 14094 14095 14096 14097 14098 14099 14100 14101 14102 14103 14104 14105 14106 14107 14108 14109 14110 14111 14112 14113 14114 14115 14116 14117 14118 14119 14120 14121 14122 14123 14124 14125 14126 14127 14128 14129 14130 14131 14132 14133 14134 14135 14136 14137 14138 14139 14140 14141 14142 14143 14144 14145 14146 14147 14148 14149 14150 14151 14152 14153 14154 14155 14156 14157 14158 14159 14160 14161 14162 14163 14164 14165 14166 14167 14168 14169 14170 14171 14172 14173 14174 14175 14176 14177 14178 14179 14180 14181 14182 14183 14184 14185 14186 14187 14188 14189 14190 14191 14192 14193 14194 14195 14196 14197 14198 14199 14200 14201 14202 14203 14204 14205 14206 14207 14208 14209 14210 14211 14212 14213 14214 14215 14216 14217 14218 14219 14220 14221 14222 14223 14224 14225 14226 14227 14228 14229 14230 14231 14232 14233 14234 14235 14236 14237 14238 14239 14240 14241 14242 14243 14244 14245 14246 14247 14248 14249 14250 14251 14252 14253 14254 14255 14256 14257 14258 14259 14260 14261 14262 14263 14264 14265 14266 14267 14268 14269 14270 14271 14272 14273 14274 14275 14276 14277 14278 14279 14280 14281 14282 14283 14284 14285 14286 14287 14288 14289 14290 14291 14292 14293 14294 14295 14296 14297 14298 14299 14300 14301 14302 14303 14304 14305 14306 14307 14308 14309 14310 14311 14312 14313 14314 14315 14316 14317 14318 14319 14320 14321 14322 14323 14324 14325 14326 14327 14328 14329 14330 14331 14332 14333 14334 14335 14336 14337 14338 14339 14340 14341 14342 14343 14344 14345 14346 14347 14348 14349 14350 14351 14352 14353 14354 14355 14356 14357 14358 14359 14360 14361 14362 14363 14364 14365 14366 14367 14368 14369 14370 14371 14372 14373 14374 14375 14376 14377 14378 14379 14380 14381 14382 14383 14384 14385 14386 14387 14388 14389 14390 14391 14392 14393 14394 14395 14396 14397 14398 14399 14400 14401 14402 14403 14404 14405 14406 14407 14408 14409 14410 14411 14412 14413 14414 14415 14416 14417 14418 14419 14420 14421 14422 14423 14424 14425 14426 14427 14428 14429 14430 14431 14432 14433 14434 14435 14436 14437 14438 14439 14440 14441 14442 14443 14444 14445 14446 14447 14448 14449 14450 14451 14452 14453 14454 14455 14456 14457 14458 14459 14460 14461 14462 14463 14464 14465 14466 14467 14468 14469 14470 14471 14472 14473 14474 14475 14476 14477 14478 14479 14480 14481 14482 14483 14484 14485 14486 14487 14488 14489 14490 14491 14492 14493 14494 14495 14496 14497 14498 14499 14500 14501 14502 14503 14504 14505 14506 14507 14508 14509 14510 14511 14512 14513 14514 14515 14516 14517 14518 14519 14520 14521 14522 14523 14524 14525 14526 14527 14528 14529 14530 14531 14532 14533 14534 14535 14536 14537 14538 14539 14540 14541 14542 14543 14544 14545 14546 14547 14548 14549 14550 14551 14552 14553 14554 14555 14556 14557 14558 14559 14560 14561 14562 14563 14564 14565 14566 14567 14568 14569 14570 14571 14572 14573 14574 14575 14576 14577 14578 14579 14580 14581 14582 14583 14584 14585 14586 14587 14588 14589 14590 14591 14592 14593 14594 14595 14596 14597 14598 14599 14600 14601 14602 14603 14604 14605 14606 14607 14608 14609 14610 14611 14612 14613 14614 14615 14616 14617 14618 14619 14620 14621 14622 14623 14624 14625 14626 14627 14628 14629 14630 14631 14632 14633 14634 14635 14636 14637 14638 14639 14640 14641 14642 14643 14644 14645 14646 14647 14648 14649 14650 14651 14652 14653 14654 14655 14656 14657 14658 14659 14660 14661 14662 14663 14664 14665 14666 14667 14668 14669 14670 14671 14672 14673 14674 14675 14676 14677 14678 14679 14680 14681 14682 14683 14684 14685 14686 14687 14688 14689 14690 14691 14692 14693 14694 14695 14696 14697 14698 14699 14700 14701 14702 14703 14704 14705 14706 14707 14708 14709 14710 14711 14712 14713 14714 14715 14716 14717 14718 14719 14720 14721 14722 14723 14724 14725 14726 14727 14728 14729 14730 14731 14732 14733 14734 14735 14736 14737 14738 14739 14740 14741 14742 14743 14744 14745 14746 14747 14748 14749 14750 14751 14752 14753 14754 14755 14756 14757 14758 14759 14760 14761 14762 14763 14764 14765 14766 14767 14768 14769 14770 14771 14772 14773 14774 14775 14776 14777 14778 14779 14780 14781 14782 14783 14784 14785 14786 14787 14788 14789 14790 14791 14792 14793 14794 14795 14796 14797 14798 14799 14800 14801 14802 14803 14804 14805 14806 14807 14808 14809 14810 14811 14812 14813 14814 14815 14816 14817 14818 14819 14820 14821 14822 14823 14824 14825 14826 14827 14828 14829 14830 14831 14832 14833 14834 14835 14836 14837 14838 14839 14840 14841 14842 14843 14844 14845 14846 14847 14848 14849 14850 14851 14852 14853 14854 14855 14856 14857 14858 14859 14860 14861 14862 14863 14864 14865 14866 14867 14868 14869 14870 14871 14872 14873 14874 14875 14876 14877 14878 14879 14880 14881 14882 14883 14884 14885 14886 14887 14888 14889 14890 14891 14892 14893 14894 14895 14896 14897 14898 14899 14900 14901 14902 14903 14904 14905 14906 14907 14908 14909 14910 14911 14912 14913 14914 14915 14916 14917 14918 14919 14920 14921 14922 14923 14924 14925 14926 14927 14928 14929 14930 14931 14932 14933 14934 14935 14936 14937 14938 14939 14940 14941 14942 14943 14944 14945 14946 14947 14948 14949 14950 14951 14952 14953 14954 14955 14956 14957 14958 14959 14960 14961 14962 14963 14964 14965 14966 14967 14968 14969 14970 14971 14972 14973 14974 14975 14976 14977 14978 14979 14980 14981 14982 14983 14984 14985 14986 14987 14988 14989 14990 14991 14992 14993 14994 14995 14996 14997 14998 14999 15000 15001 15002 15003 15004 15005 15006 15007 15008 15009 15010 15011 15012 15013 15014 15015 15016 15017 15018 15019 15020 15021 15022 15023 15024 15025 15026 15027 15028 15029 15030 15031 15032 15033 15034 15035 15036 15037 15038 15039 15040 15041 15042 15043 15044 15045 15046 15047 15048 15049 15050 15051 15052 15053 15054 15055 15056 15057 15058 15059 15060 15061 15062 15063 15064 15065 15066 15067 15068 15069 15070 15071 15072 15073 15074 15075 15076 15077 15078 15079 15080 15081 15082 15083 15084 15085 15086 15087 15088 15089 15090 15091 15092 15093 15094 15095 15096 15097 15098 15099 15100 15101 15102 15103 15104 15105 15106 15107 15108 15109 15110 15111 15112 15113 15114 15115 15116 15117 15118 15119 15120 15121 15122 15123 15124 15125 15126 15127 15128 15129 15130 15131 15132 15133 15134 15135 15136 15137 15138 15139 15140 15141 15142 15143 15144 15145 15146 15147 15148 15149 15150 15151 15152 15153 15154 15155 15156 15157 15158 15159 15160 15161 15162 15163 15164 15165 15166 15167 15168 15169 15170 15171 15172 15173 15174 15175 15176 15177 15178 15179 15180 15181 15182 15183 15184 15185 15186 15187 15188 15189 15190 15191 15192 15193 15194 15195 15196 15197 15198 15199 15200 15201 15202 15203 15204 15205 15206 15207 15208 15209 15210 15211 15212 15213 15214 15215 15216 15217 15218 15219 15220 15221 15222 15223 15224 15225 15226 15227 15228 15229 15230 15231 15232 15233 15234 15235 15236 15237 15238 15239 15240 15241 15242 15243 15244 15245 15246 15247 15248 15249 15250 15251 15252 15253 15254 15255 15256 15257 15258 15259 15260 15261 15262 15263 15264 15265 15266 15267 15268 15269 15270 15271 15272 15273 15274 15275 15276 15277 15278 15279 15280 15281 15282 15283 15284 15285 15286 15287 15288 15289 15290 15291 15292 15293 15294 15295 15296 15297 15298 15299 15300 15301 15302 15303 15304 15305 15306 15307 15308 15309 15310 15311 15312 15313 15314 15315 15316 15317 15318 15319 15320 15321 15322 15323 15324 15325 15326 15327 15328 15329 15330 15331 15332 15333 15334 15335 15336 15337 15338 15339 15340 15341 15342 15343 15344 15345 15346 15347 15348 15349 15350 15351 15352 15353 15354 15355 15356 15357 15358 15359 15360 15361 15362 15363 15364 15365 15366 15367 15368 15369 15370 15371 15372 15373 15374 15375 15376 15377 15378 15379 15380 15381 15382 15383 15384 15385 15386 15387 15388 15389 15390 15391 15392 15393 15394 15395 15396 15397 15398 15399 15400 15401 15402 15403 15404 15405 15406 15407 15408 15409 15410 15411 15412 15413 15414 15415 15416 15417 15418 15419 15420 15421 15422 15423 15424 15425 15426 15427 15428 15429 15430 15431 15432 15433 15434 15435 15436 15437 15438 15439 15440 15441 15442 15443 15444 15445 15446 15447 15448 15449 15450 15451 15452 15453 15454 15455 15456 15457 15458 15459 15460 15461 15462 15463 15464 15465 15466 15467 15468 15469 15470 15471 15472 15473 15474 15475 15476 15477 15478 15479 15480 15481 15482 15483 15484 15485 15486 15487 15488 15489 15490 15491 15492 15493 15494 15495 15496 15497 15498 15499 15500 15501 15502 15503 15504 15505 15506 15507 15508 15509 15510 15511 15512 15513 15514 15515 15516 15517 15518 15519 15520 15521 15522 15523 15524 15525 15526 15527 15528 15529 15530 15531 15532 15533 15534 15535 15536 15537 15538 15539 15540 15541 15542 15543 15544 15545 15546 15547 15548 15549 15550 15551 15552 15553 15554 15555 15556 15557 15558 15559 15560 15561 15562 15563 15564 15565 15566 15567 15568 15569 15570 15571 15572 15573 15574 15575 15576 15577 15578 15579 15580 15581 15582 15583 15584 15585 15586 15587 15588 15589 15590 15591 15592 15593 15594 15595 15596 15597 15598 15599 15600 15601 15602 15603 15604 15605 15606 15607 15608 15609 15610 15611 15612 15613 15614 15615 15616 15617 15618 15619 15620 15621 15622 15623 15624 15625 15626 15627 15628 15629 15630 15631 15632 15633 15634 15635 15636 15637 15638 15639 15640 15641 15642 15643 15644 15645 15646 15647 15648 15649 15650 15651 15652 15653 15654 15655 15656 15657 15658 15659 15660 15661 15662 15663 15664 15665 15666 15667 15668 15669 15670 15671 15672 15673 15674 15675 15676 15677 15678 15679 15680 15681 15682 15683 15684 15685 15686 15687 15688 15689 15690 15691 15692 15693 15694 15695 15696 15697 15698 15699 15700 15701 15702 15703 15704 15705 15706 15707 15708 15709 15710 15711 15712 15713 15714 15715 15716 15717 15718 15719 15720 15721 15722 15723 15724 15725 15726 15727 15728 15729 15730 15731 15732 15733 15734 15735 15736 15737 15738 15739 15740 15741 15742 15743 15744 15745 15746 15747 15748 15749 15750 15751 15752 15753 15754 15755 15756 15757 15758 15759 15760 15761 15762 15763 15764 15765 15766 15767 15768 15769 15770 15771 15772 15773 15774 15775 15776 15777 15778 15779 15780 15781 15782 15783 15784 15785 15786 15787 15788 15789 15790 15791 15792 15793 15794 15795 15796 15797 15798 15799 15800 15801 15802 15803 15804 15805 15806 15807 15808 15809 15810 15811 15812 15813 15814 15815 15816 15817 15818 15819 15820 15821 15822 15823 15824 15825 15826 15827 15828 15829 15830 15831 15832 15833 15834 15835 15836 15837 15838 15839 15840 15841 15842 15843 15844 15845 15846 15847 15848 15849 15850 15851 15852 15853 15854 15855 15856 15857 15858 15859 15860 15861 15862 15863 15864 15865 15866 15867 15868 15869 15870 15871 15872 15873 15874 15875 15876 15877 15878 15879 15880 15881 15882 15883 15884 15885 15886 15887 15888 15889 15890 15891 15892 15893 15894 15895 15896 15897 15898 15899 15900 15901 15902 15903 15904 15905 15906 15907 15908 15909 15910 15911 15912 15913 15914 15915 15916 15917 15918 15919 15920 15921 15922 15923 15924 15925 15926 15927 15928 15929 15930 15931 15932 15933 15934 15935 15936 15937 15938 15939 15940 15941 15942 15943 15944 15945 15946 15947 15948 15949 15950 15951 15952 15953 15954 15955 15956 15957 15958 15959 15960 15961 15962 15963 15964 15965 15966 15967 15968 15969 15970 15971 15972 15973 15974 15975 15976 15977 15978 15979 15980 15981 15982 15983 15984 15985 15986 15987 15988 15989 15990 15991 15992 15993 15994 15995 15996 15997 15998 15999 16000 16001 16002 16003 16004 16005 16006 16007 16008 16009 16010 16011 16012 16013 16014 16015 16016 16017 16018 16019 16020 16021 16022 16023 16024 16025 16026 16027 16028 16029 16030 16031 16032 16033 16034 16035 16036 16037 16038 16039 16040 16041 16042 16043 16044 16045 16046 16047 16048 16049 16050 16051 16052 16053 16054 16055 16056 16057 16058 16059 16060 16061 16062 16063 16064 16065 16066 16067 16068 16069 16070 16071 16072 16073 16074 16075 16076 16077 16078 16079 16080 16081 16082 16083 16084 16085 16086 16087 16088 16089 16090 16091 16092 16093 16094 16095 16096 16097 16098 16099 16100 16101 16102 16103 16104 16105 16106 16107 16108 16109 16110 16111 16112 16113 16114 16115 16116 16117 16118 16119 16120 16121 16122 16123 16124 16125 16126 16127 16128 16129 16130 16131 16132 16133 16134 16135 16136 16137 16138 16139 16140 16141 16142 16143 16144 16145 16146 16147 16148 16149 16150 16151 16152 16153 16154 16155 16156 16157 16158 16159 16160 16161 16162 16163 16164 16165 16166 16167 16168 16169 16170 16171 16172 16173 16174 16175 16176 16177 16178 16179 16180 16181 16182 16183 16184 16185 16186 16187 16188 16189 16190 16191 16192 16193 16194 16195 16196 16197 16198 16199 16200 16201 16202 16203 16204 16205 16206 16207 16208 16209 16210 16211 16212 16213 16214 16215 16216 16217 16218 16219 16220 16221 16222 16223 16224 16225 16226 16227 16228 16229 16230 16231 16232 16233 16234 16235 16236 16237 16238 16239 16240 16241 16242 16243 16244 16245 16246 16247 16248 16249 16250 16251 16252 16253 16254 16255 16256 16257 16258 16259 16260 16261 16262 16263 16264 16265 16266 16267 16268 16269 16270 16271 16272 16273 16274 16275 16276 16277 16278 16279 16280 16281 16282 16283 16284 16285 16286 16287 16288 16289 16290 16291 16292 16293 16294 16295 16296 16297 16298 16299 16300 16301 16302 16303 16304 16305 16306 16307 16308 16309 16310 16311 16312 16313 16314 16315 16316 16317 16318 16319 16320 16321 16322 16323 16324 16325 16326 16327 16328 16329 16330 16331 16332 16333 16334 16335 16336 16337 16338 16339 16340 16341 16342 16343 16344 16345 16346 16347 16348 16349 16350 16351 16352 16353 16354 16355 16356 16357 16358 16359 16360 16361 16362 16363 16364 16365 16366 16367 16368 16369 16370 16371 16372 16373 16374 16375 16376 16377 16378 16379 16380 16381 16382 16383 16384 16385 16386 16387 16388 16389 16390 16391 16392 16393 16394 16395 16396 16397 16398 16399 16400 16401 16402 16403 16404 16405 16406 16407 16408 16409 16410 16411 16412 16413 16414 16415 16416 16417 16418 16419 16420 16421 16422 16423 16424 16425 16426 16427 16428 16429 16430 16431 16432 16433 16434 16435 16436 16437 16438 16439 16440 16441 16442 16443 16444 16445 16446 16447 16448 16449 16450 16451 16452 16453 16454 16455 16456 16457 16458 16459 16460 16461 16462 16463 16464 16465 16466 16467 16468 16469 16470 16471 16472 16473 16474 16475 16476 16477 16478 16479 16480 16481 16482 16483 16484 16485 16486 16487 16488 16489 16490 16491 16492 16493 16494 16495 16496 16497 16498 16499 16500 16501 16502 16503 16504 16505 16506 16507 16508 16509 16510 16511 16512 16513 16514 16515 16516 16517 16518 16519 16520 16521 16522 16523 16524 16525 16526 16527 16528 16529 16530 16531 16532 16533 16534 16535 16536 16537 16538 16539 16540 16541 16542 16543 16544 16545 16546 16547 16548 16549 16550 16551 16552 16553 16554 16555 16556 16557 16558 16559 16560 16561 16562 16563 16564 16565 16566 16567 16568 16569 16570 16571 16572 16573 16574 16575 16576 16577 16578 16579 16580 16581 16582 16583 16584 16585 16586 16587 16588 16589 16590 16591 16592 16593 16594 16595 16596 16597 16598 16599 16600 16601 16602 16603 16604 16605 16606 16607 16608 16609 16610 16611 16612 16613 16614 16615 16616 16617 16618 16619 16620 16621 16622 16623 16624 16625 16626 16627 16628 16629 16630 16631 16632 16633 16634 16635 16636 16637 16638 16639 16640 16641 16642 16643 16644 16645 16646 16647 16648 16649 16650 16651 16652 16653 16654 16655 16656 16657 16658 16659 16660 16661 16662 16663 16664 16665 16666 16667 16668 16669 16670 16671 16672 16673 16674 16675 16676 16677 16678 16679 16680 16681 16682 16683 16684 16685 16686 16687 16688 16689 16690 16691 16692 16693 16694 16695 16696 16697 16698 16699 16700 16701 16702 16703 16704 16705 16706 16707 16708 16709 16710 16711 16712 16713 16714 16715 16716 16717 16718 16719 16720 16721 16722 16723 16724 16725 16726 16727 16728 16729 16730 16731 16732 16733 16734 16735 16736 16737 16738 16739 16740 16741 16742 16743 16744 16745 16746 16747 16748 16749 16750 16751 16752 16753 16754 16755 16756 16757 16758 16759 16760 16761 16762 16763 16764 16765 16766 16767 16768 16769 16770 16771 16772 16773 16774 16775 16776 16777 16778 16779 16780 16781 16782 16783 16784 16785 16786 16787 16788 16789 16790 16791 16792 16793 16794 16795 16796 16797 16798 16799 16800 16801 16802 16803 16804 16805 16806 16807 16808 16809 16810 16811 16812 16813 16814 16815 16816 16817 16818 16819 16820 16821 16822 16823 16824 16825 16826 16827 16828 16829 16830 16831 16832 16833 16834 16835 16836 16837 16838 16839 16840 16841 16842 16843 16844 16845 16846 16847 16848 16849 16850 16851 16852 16853 16854 16855 16856 16857 16858 16859 16860 16861 16862 16863 16864 16865 16866 16867 16868 16869 16870 16871 16872 16873 16874 16875 16876 16877 16878 16879 16880 16881 16882 16883 16884 16885 16886 16887 16888 16889 16890 16891 16892 16893 16894 16895 16896 16897 16898 16899 16900 16901 16902 16903 16904 16905 16906 16907 16908 16909 16910 16911 16912 16913 16914 16915 16916 16917 16918 16919 16920 16921 16922 16923 16924 16925 16926 16927 16928 16929 16930 16931 16932 16933 16934 16935 16936 16937 16938 16939 16940 16941 16942 16943 16944 16945 16946 16947 16948 16949 16950 16951 16952 16953 16954 16955 16956 16957 16958 16959 16960 16961 16962 16963 16964 16965 16966 16967 16968 16969 16970 16971 16972 16973 16974 16975 16976 16977 16978 16979 16980 16981 16982 16983 16984 16985 16986 16987 16988 16989 16990 16991 16992 16993 16994 16995 16996 16997 16998 16999 17000 17001 17002 17003 17004 17005 17006 17007 17008 17009 17010 17011 17012 17013 17014 17015 17016 17017 17018 17019 17020 17021 17022 17023 17024 17025 17026 17027 17028 17029 17030 17031 17032 17033 17034 17035 17036 17037 17038 17039 17040 17041 17042 17043 17044 17045 17046 17047 17048 17049 17050 17051 17052 17053 17054 17055 17056 17057 17058 17059 17060 17061 17062 17063 17064 17065 17066 17067 17068 17069 17070 17071 17072 17073 17074 17075 17076 17077 17078 17079 17080 17081 17082 17083 17084 17085 17086 17087 17088 17089 17090 17091 17092 17093 17094 17095 17096 17097 17098 17099 17100 17101 17102 17103 17104 17105 17106 17107 17108 17109 17110 17111 17112 17113 17114 17115 17116 17117 17118 17119 17120 17121 17122 17123 17124 17125 17126 17127 17128 17129 17130 17131 17132 17133 17134 17135 17136 17137 17138 17139 17140 17141 17142 17143 17144 17145 17146 17147 17148 17149 17150 17151 17152 17153 17154 17155 17156 17157 17158 17159 17160 17161 17162 17163 17164 17165 17166 17167 17168 17169 17170 17171 17172 17173 17174 17175 17176 17177 17178 17179 17180 17181 17182 17183 17184 17185 17186 17187 17188 17189 17190 17191 17192 17193 17194 17195 17196 17197 17198 17199 17200 17201 17202 17203 17204 17205 17206 17207 17208 17209 17210 17211 17212 17213 17214 17215 17216 17217 17218 17219 17220 17221 17222 17223 17224 17225 17226 17227 17228 17229 17230 17231 17232 17233 17234 17235 17236 17237 17238 17239 17240 17241 17242 17243 17244 17245 17246 17247 17248 17249 17250 17251 17252 17253 17254 17255 17256 17257 17258 17259 17260 17261 17262 17263 17264 17265 17266 17267 17268 17269 17270 17271 17272 17273 17274 17275 17276 17277 17278 17279 17280 17281 17282 17283 17284 17285 17286 17287 17288 17289 17290 17291 17292 17293 17294 17295 17296 17297 17298 17299 17300 17301 17302 17303 17304 17305 17306 17307 17308 17309 17310 17311 17312 17313 17314 17315 17316 17317 17318 17319 17320 17321 17322 17323 17324 17325 17326 17327 17328 17329 17330 17331 17332 17333 17334 17335 17336 17337 17338 17339 17340 17341 17342 17343 17344 17345 17346 17347 17348 17349 17350 17351 17352 17353 17354 17355 17356 17357 17358 17359 17360 17361 17362 17363 17364 17365 17366 17367 17368 17369 17370 17371 17372 17373 17374 17375 17376 17377 17378 17379 17380 17381 17382 17383 17384 17385 17386 17387 17388 17389 17390 17391 17392 17393 17394 17395 17396 17397 17398 17399 17400 17401 17402 17403 17404 17405 17406 17407 17408 17409 17410 17411 17412 17413 17414 17415 17416 17417 17418 17419 17420 17421 17422 17423 17424 17425 17426 17427 17428 17429 17430 17431 17432 17433 17434 17435 17436 17437 17438 17439 17440 17441 17442 17443 17444 17445 17446 17447 17448 17449 17450 17451 17452 17453 17454 17455 17456 17457 17458 17459 17460 17461 17462 17463 17464 17465 17466 17467 17468 17469 17470 17471 17472 17473 17474 17475 17476 17477 17478 17479 17480 17481 17482 17483 17484 17485 17486 17487 17488 17489 17490 17491 17492 17493 17494 17495 17496 17497 17498 17499 17500 17501 17502 17503 17504 17505 17506 17507 17508 17509 17510 17511 17512 17513 17514 17515 17516 17517 17518 17519 17520 17521 17522 17523 17524 17525 17526 17527 17528 17529 17530 17531 17532 17533 17534 17535 17536 17537 17538 17539 17540 17541 17542 17543 17544 17545 17546 17547 17548 17549 17550 17551 17552 17553 17554 17555 17556 17557 17558 17559 17560 17561 17562 17563 17564 17565 17566 17567 17568 17569 17570 17571 17572 17573 17574 17575 17576 17577 17578 17579 17580 17581 17582 17583 17584 17585 17586 17587 17588 17589 17590 17591 17592 17593 17594 17595 17596 17597 17598 17599 17600 17601 17602 17603 17604 17605 17606 17607 17608 17609 17610 17611 17612 17613 17614 17615 17616 17617 17618 17619 17620 17621 17622 17623 17624 17625 17626 17627 17628 17629 17630 17631 17632 17633 17634 17635 17636 17637 17638 17639 17640 17641 17642 17643 17644 17645 17646 17647 17648 17649 17650 17651 17652 17653 17654 17655 17656 17657 17658 17659 17660 17661 17662 17663 17664 17665 17666 17667 17668 17669 17670 17671 17672 17673 17674 17675 17676 17677 17678 17679 17680 17681 17682 17683 17684 17685 17686 17687 17688 17689 17690 17691 17692 17693 17694 17695 17696 17697 17698 17699 17700 17701 17702 17703 17704 17705 17706 17707 17708 17709 17710 17711 17712 17713 17714 17715 17716 17717 17718 17719 17720 17721 17722 17723 17724 17725 17726 17727 17728 17729 17730 17731 17732 17733 17734 17735 17736 17737 17738 17739 17740 17741 17742 17743 17744 17745 17746 17747 17748 17749 17750 17751 17752 17753 17754 17755 17756 17757 17758 17759 17760 17761 17762 17763 17764 17765 17766 17767 17768 17769 17770 17771 17772 17773 17774 17775 17776 17777 17778 17779 17780 17781 17782 17783 17784 17785 17786 17787 17788 17789 17790 17791 17792 17793 17794 17795 17796 17797 17798 17799 17800 17801 17802 17803 17804 17805 17806 17807 17808 17809 17810 17811 17812 17813 17814 17815 17816 17817 17818 17819 17820 17821 17822 17823 17824 17825 17826 17827 17828 17829 17830 17831 17832 17833 17834 17835 17836 17837 17838 17839 17840 17841 17842 17843 17844 17845 17846 17847 17848 17849 17850 17851 17852 17853 17854 17855 17856 17857 17858 17859 17860 17861 17862 17863 17864 17865 17866 17867 17868 17869 17870 17871 17872 17873 17874 17875 17876 17877 17878 17879 17880 17881 17882 17883 17884 17885 17886 17887 17888 17889 17890 17891 17892 17893 17894 17895 17896 17897 17898 17899 17900 17901 17902 17903 17904 17905 17906 17907 17908 17909 17910 17911 17912 17913 17914 17915 17916 17917 17918 17919 17920 17921 17922 17923 17924 17925 17926 17927 17928 17929 17930 17931 17932 17933 17934 17935 17936 17937 17938 17939 17940 17941 17942 17943 17944 17945 17946 17947 17948 17949 17950 17951 17952 17953 17954 17955 17956 17957 17958 17959 17960 17961 17962 17963 17964 17965 17966 17967 17968 17969 17970 17971 17972 17973 17974 17975 17976 17977 17978 17979 17980 17981 17982 17983 17984 17985 17986 17987 17988 17989 17990 17991 17992 17993 17994 17995 17996 17997 17998 17999 18000 18001 18002 18003 18004 18005 18006 18007 18008 18009 18010 18011 18012 18013 18014 18015 18016 18017 18018 18019 18020 18021 18022 18023 18024 18025 18026 18027 18028 18029 18030 18031 18032 18033 18034 18035 18036 18037 18038 18039 18040 18041 18042 18043 18044 18045 18046 18047 18048 18049 18050 18051 18052 18053 18054 18055 18056 18057 18058 18059 18060 18061 18062 18063 18064 18065 18066 18067 18068 18069 18070 18071 18072 18073 18074 18075 18076 18077 18078 18079 18080 18081 18082 18083 18084 18085 18086 18087 18088 18089 18090 18091 18092 18093 18094 18095 18096 18097 18098 18099 18100 18101 18102 18103 18104 18105 18106 18107 18108 18109 18110 18111 18112 18113 18114 18115 18116 18117 18118 18119 18120 18121 18122 18123 18124 18125 18126 18127 18128 18129 18130 18131 18132 18133 18134 18135 18136 18137 18138 18139 18140 18141 18142 18143 18144 18145 18146 18147 18148 18149 18150 18151 18152 18153 18154 18155 18156 18157 18158 18159 18160 18161 18162 18163 18164 18165 18166 18167 18168 18169 18170 18171 18172 18173 18174 18175 18176 18177 18178 18179 18180 18181 18182 18183 18184 18185 18186 18187 18188 18189 18190 18191 18192 18193 18194 18195 18196 18197 18198 18199 18200 18201 18202 18203 18204 18205 18206 18207 18208 18209 18210 18211 18212 18213 18214 18215 18216 18217 18218 18219 18220 18221 18222 18223 18224 18225 18226 18227 18228 18229 18230 18231 18232 18233 18234 18235 18236 18237 18238 18239 18240 18241 18242 18243 18244 18245 18246 18247 18248 18249 18250 18251 18252 18253 18254 18255 18256 18257 18258 18259 18260 18261 18262 18263 18264 18265 18266 18267 18268 18269 18270 18271 18272 18273 18274 18275 18276 18277 18278 18279 18280 18281 18282 18283 18284 18285 18286 18287 18288 18289 18290 18291 18292 18293 18294 18295 18296 18297 18298 18299 18300 18301 18302 18303 18304 18305 18306 18307 18308 18309 18310 18311 18312 18313 18314 18315 18316 18317 18318 18319 18320 18321 18322 18323 18324 18325 18326 18327 18328 18329 18330 18331 18332 18333 18334 18335 18336 18337 18338 18339 18340 18341 18342 18343 18344 18345 18346 18347 18348 18349 18350 18351 18352 18353 18354 18355 18356 18357 18358 18359 18360 18361 18362 18363 18364 18365 18366 18367 18368 18369 18370 18371 18372 18373 18374 18375 18376 18377 18378 18379 18380 18381 18382 18383 18384 18385 18386 18387 18388 18389 18390 18391 18392 18393 18394 18395 18396 18397 18398 18399 18400 18401 18402 18403 18404 18405 18406 18407 18408 18409 18410 18411 18412 18413 18414 18415 18416 18417 18418 18419 18420 18421 18422 18423 18424 18425 18426 18427 18428 18429 18430 18431 18432 18433 18434 18435 18436 18437 18438 18439 18440 18441 18442 18443 18444 18445 18446 18447 18448 18449 18450 18451 18452 18453 18454 18455 18456 18457 18458 18459 18460 18461 18462 18463 18464 18465 18466 18467 18468 18469 18470 18471 18472 18473 18474 18475 18476 18477 18478 18479 18480 18481 18482 18483 18484 18485 18486 18487 18488 18489 18490 18491 18492 18493 18494 18495 18496 18497 18498 18499 18500 18501 18502 18503 18504 18505 18506 18507 18508 18509 18510 18511 18512 18513 18514 18515 18516 18517 18518 18519 18520 18521 18522 18523 18524 18525 18526 18527 18528 18529 18530 18531 18532 18533 18534 18535 18536 18537 18538 18539 18540 18541 18542 18543 18544 18545 18546 18547 18548 18549 18550 18551 18552 18553 18554 18555 18556 18557 18558 18559 18560 18561 18562 18563 18564 18565 18566 18567 18568 18569 18570 18571 18572 18573 18574 18575 18576 18577 18578 18579 18580 18581 18582 18583 18584 18585 18586 18587 18588 18589 18590 18591 18592 18593 18594 18595 18596 18597 18598 18599 18600 18601 18602 18603 18604 18605 18606 18607 18608 18609 18610 18611 18612 18613 18614 18615 18616 18617 18618 18619 18620 18621 18622 18623 18624 18625 18626 18627 18628 18629 18630 18631 18632 18633 18634 18635 18636 18637 18638 18639 18640 18641 18642 18643 18644 18645 18646 18647 18648 18649 18650 18651 18652 18653 18654 18655 18656 18657 18658 18659 18660 18661 18662 18663 18664 18665 18666 18667 18668 18669 18670 18671 18672 18673 18674 18675 18676 18677 18678 18679 18680 18681 18682 18683 18684 18685 18686 18687 18688 18689 18690 18691 18692 18693 18694 18695 18696 18697 18698 18699 18700 18701 18702 18703 18704 18705 18706 18707 18708 18709 18710 18711 18712 18713 18714 18715 18716 18717 18718 18719 18720 18721 18722 18723 18724 18725 18726 18727 18728 18729 18730 18731 18732 18733 18734 18735 18736 18737 18738 18739 18740 18741 18742 18743 18744 18745 18746 18747 18748 18749 18750 18751 18752 18753 18754 18755 18756 18757 18758 18759 18760 18761 18762 18763 18764 18765 18766 18767 18768 18769 18770 18771 18772 18773 18774 18775 18776 18777 18778 18779 18780 18781 18782 18783 18784 18785 18786 18787 18788 18789 18790 18791 18792 18793 18794 18795 18796 18797 18798 18799 18800 18801 18802 18803 18804 18805 18806 18807 18808 18809 18810 18811 18812 18813 18814 18815 18816 18817 18818 18819 18820 18821 18822 18823 18824 18825 18826 18827 18828 18829 18830 18831 18832 18833 18834 18835 18836 18837 18838 18839 18840 18841 18842 18843 18844 18845 18846 18847 18848 18849 18850 18851 18852 18853 18854 18855 18856 18857 18858 18859 18860 18861 18862 18863 18864 18865 18866 18867 18868 18869 18870 18871 18872 18873 18874 18875 18876 18877 18878 18879 18880 18881 18882 18883 18884 18885 18886 18887 18888 18889 18890 18891 18892 18893 18894 18895 18896 18897 18898 18899 18900 18901 18902 18903 18904 18905 18906 18907 18908 18909 18910 18911 18912 18913 18914 18915 18916 18917 18918 18919 18920 18921 18922 18923 18924 18925 18926 18927 18928 18929 18930 18931 18932 18933 18934 18935 18936 18937 18938 18939 18940 18941 18942 18943 18944 18945 18946 18947 18948 18949 18950 18951 18952 18953 18954 18955 18956 18957 18958 18959 18960 18961 18962 18963 18964 18965 18966 18967 18968 18969 18970 18971 18972 18973 18974 18975 18976 18977 18978 18979 18980 18981 18982 18983 18984 18985 18986 18987 18988 18989 18990 18991 18992 18993 18994 18995 18996 18997 18998 18999 19000 19001 19002 19003 19004 19005 19006 19007 19008 19009 19010 19011 19012 19013 19014 19015 19016 19017 19018 19019 19020 19021 19022 19023 19024 19025 19026 19027 19028 19029 19030 19031 19032 19033 19034 19035 19036 19037 19038 19039 19040 19041 19042 19043 19044 19045 19046 19047 19048 19049 19050 19051 19052 19053 19054 19055 19056 19057 19058 19059 19060 19061 19062 19063 19064 19065 19066 19067 19068 19069 19070 19071 19072 19073 19074 19075 19076 19077 19078 19079 19080 19081 19082 19083 19084 19085 19086 19087 19088 19089 19090 19091 19092 19093 19094 19095 19096 19097 19098 19099 19100 19101 19102 19103 19104 19105 19106 19107 19108 19109 19110 19111 19112 19113 19114 19115 19116 19117 19118 19119 19120 19121 19122 19123 19124 19125 19126 19127 19128 19129 19130 19131 19132 19133 19134 19135 19136 19137 19138 19139 19140 19141 19142 19143 19144 19145 19146 19147 19148 19149 19150 19151 19152 19153 19154 19155 19156 19157 19158 19159 19160 19161 19162 19163 19164 19165 19166 19167 19168 19169 19170 19171 19172 19173 19174 19175 19176 19177 19178 19179 19180 19181 19182 19183 19184 19185 19186 19187 19188 19189 19190 19191 19192 19193 19194 19195 19196 19197 19198 19199 19200 19201 19202 19203 19204 19205 19206 19207 19208 19209 19210 19211 19212 19213 19214 19215 19216 19217 19218 19219 19220 19221 19222 19223 19224 19225 19226 19227 19228 19229 19230 19231 19232 19233 19234 19235 19236 19237 19238 19239 19240 19241 19242 19243 19244 19245 19246 19247 19248 19249 19250 19251 19252 19253 19254 19255 19256 19257 19258 19259 19260 19261 19262 19263 19264 19265 19266 19267 19268 19269 19270 19271 19272 19273 19274 19275 19276 19277 19278 19279 19280 19281 19282 19283 19284 19285 19286 19287 19288 19289 19290 19291 19292 19293 19294 19295 19296 19297 19298 19299 19300 19301 19302 19303 19304 19305 19306 19307 19308 19309 19310 19311 19312 19313 19314 19315 19316 19317 19318 19319 19320 19321 19322 19323 19324 19325 19326 19327 19328 19329 19330 19331 19332 19333 19334 19335 19336 19337 19338 19339 19340 19341 19342 19343 19344 19345 19346 19347 19348 19349 19350 19351 19352 19353 19354 19355 19356 19357 19358 19359 19360 19361 19362 19363 19364 19365 19366 19367 19368 19369 19370 19371 19372 19373 19374 19375 19376 19377 19378 19379 19380 19381 19382 19383 19384 19385 19386 19387 19388 19389 19390 19391 19392 19393 19394 19395 19396 19397 19398 19399 19400 19401 19402 19403 19404 19405 19406 19407 19408 19409 19410 19411 19412 19413 19414 19415 19416 19417 19418 19419 19420 19421 19422 19423 19424 19425 19426 19427 19428 19429 19430 19431 19432 19433 19434 19435 19436 19437 19438 19439 19440 19441 19442 19443 19444 19445 19446 19447 19448 19449 19450 19451 19452 19453 19454 19455 19456 19457 19458 19459 19460 19461 19462 19463 19464 19465 19466 19467 19468 19469 19470 19471 19472 19473 19474 19475 19476 19477 19478 19479 19480 19481 19482 19483 19484 19485 19486 19487 19488 19489 19490 19491 19492 19493 19494 19495 19496 19497 19498 19499 19500 19501 19502 19503 19504 19505 19506 19507 19508 19509 19510 19511 19512 19513 19514 19515 19516 19517 19518 19519 19520 19521 19522 19523 19524 19525 19526 19527 19528 19529 19530 19531 19532 19533 19534 19535 19536 19537 19538 19539 19540 19541 19542 19543 19544 19545 19546 19547 19548 19549 19550 19551 19552 19553 19554 19555 19556 19557 19558 19559 19560 19561 19562 19563 19564 19565 19566 19567 19568 19569 19570 19571 19572 19573 19574 19575 19576 19577 19578 19579 19580 19581 19582 19583 19584 19585 19586 19587 19588 19589 19590 19591 19592 19593 19594 19595 19596 19597 19598 19599 19600 19601 19602 19603 19604 19605 19606 19607 19608 19609 19610 19611 19612 19613 19614 19615 19616 19617 19618 19619 19620 19621 19622 19623 19624 19625 19626 19627 19628 19629 19630 19631 19632 19633 19634 19635 19636 19637 19638 19639 19640 19641 19642 19643 19644 19645 19646 19647 19648 19649 19650 19651 19652 19653 19654 19655 19656 19657 19658 19659 19660 19661 19662 19663 19664 19665 19666 19667 19668 19669 19670 19671 19672 19673 19674 19675 19676 19677 19678 19679 19680 19681 19682 19683 19684 19685 19686 19687 19688 19689 19690 19691 19692 19693 19694 19695 19696 19697 19698 19699 19700 19701 19702 19703 19704 19705 19706 19707 19708 19709 19710 19711 19712 19713 19714 19715 19716 19717 19718 19719 19720 19721 19722 19723 19724 19725 19726 19727 19728 19729 19730 19731 19732 19733 19734 19735 19736 19737 19738 19739 19740 19741 19742 19743 19744 19745 19746 19747 19748 19749 19750 19751 19752 19753 19754 19755 19756 19757 19758 19759 19760 19761 19762 19763 19764 19765 19766 19767 19768 19769 19770 19771 19772 19773 19774 19775 19776 19777 19778 19779 19780 19781 19782 19783 19784 19785 19786 19787 19788 19789 19790 19791 19792 19793 19794 19795 19796 19797 19798 19799 19800 19801 19802 19803 19804 19805 19806 19807 19808 19809 19810 19811 19812 19813 19814 19815 19816 19817 19818 19819 19820 19821 19822 19823 19824 19825 19826 19827 19828 19829 19830 19831 19832 19833 19834 19835 19836 19837 19838 19839 19840 19841 19842 19843 19844 19845 19846 19847 19848 19849 19850 19851 19852 19853 19854 19855 19856 19857 19858 19859 19860 19861 19862 19863 19864 19865 19866 19867 19868 19869 19870 19871 19872 19873 19874 19875 19876 19877 19878 19879 19880 19881 19882 19883 19884 19885 19886 19887 19888 19889 19890 19891 19892 19893 19894 19895 19896 19897 19898 19899 19900 19901 19902 19903 19904 19905 19906 19907 19908 19909 19910 19911 19912 19913 19914 19915 19916 19917 19918 19919 19920 19921 19922 19923 19924 19925 19926 19927 19928 19929 19930 19931 19932 19933 19934 19935 19936 19937 19938 19939 19940 19941 19942 19943 19944 19945 19946 19947 19948 19949 19950 19951 19952 19953 19954 19955 19956 19957 19958 19959 19960 19961 19962 19963 19964 19965 19966 19967 19968 19969 19970 19971 19972 19973 19974 19975 19976 19977 19978 19979 19980 19981 19982 19983 19984 19985 19986 19987 19988 19989 19990 19991 19992 19993 19994 19995 19996 19997 19998 19999)
+'((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((deep))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
@@ -62,3 +62,9 @@
 
 (member 3 '(1 2 3 4 5))
 (member 7 '(1 2 3 4 5))
+
+; Vector sums stay exact past 32 bits (each prints t)
+(equal (vsum (make-vector 3 2000000000)) (* 3 2000000000))
+(equal (vdot (vector 100000 100000) (vector 100000 100000)) (* 2 (* 100000 100000)))
+(equal (vdot (make-vector 11 -2147483648) (make-vector 11 -2147483648))
+       (* 11 (* -2147483648 -2147483648)))
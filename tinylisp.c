@@ -2,30 +2,84 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "tinylisp.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /* Tiny LISP Interpreter - Turing Complete */
 
 /* Object types */
 typedef enum {
-    T_INT,      /* Integer */
+    T_INT,      /* Integer (always a tagged fixnum, see below) */
     T_SYMBOL,   /* Symbol */
     T_CONS,     /* Cons cell (pair) */
     T_FUNC,     /* Built-in function */
-    T_LAMBDA    /* User-defined function */
+    T_LAMBDA,   /* User-defined function */
+    T_FRAME,    /* Array of variable slots for one lambda or let scope */
+    T_LOCAL,    /* Resolved reference to a frame slot (code only) */
+    T_GLOBAL,   /* Resolved reference to a global binding (code only) */
+    T_CODE,     /* Compiled bytecode for a lambda body */
+    T_MEMO,     /* Function wrapped with a result cache */
+    T_VECTOR,   /* Contiguous array of elements */
+    T_FUTURE,   /* Call running, or waiting to run, on the thread pool */
+    T_BIG,      /* Integer too large for a fixnum */
+    T_MACRO,    /* Function from a form's arguments to its expansion */
+    T_HASH,     /* Hash table keyed by equal */
+    T_FREE      /* Unallocated slab cell (never visible to Lisp code) */
 } ObjType;
 
-/* Forward declaration */
-typedef struct Obj Obj;
+/* Special forms, tagged on their symbols so eval can classify a form
+ * with a single switch */
+typedef enum {
+    SF_NONE,    /* Ordinary symbol */
+    SF_QUOTE,
+    SF_IF,
+    SF_LAMBDA,
+    SF_DEFUN,
+    SF_PROGN,
+    SF_LET,
+    SF_COND,
+    SF_DEFUN_MEMO,
+    SF_FUTURE,
+    SF_DEFMACRO,
+    SF_QUASIQUOTE   /* Rewritten by the resolver, never evaluated */
+} SpecialForm;
 
-/* Built-in function pointer type */
-typedef Obj* (*BuiltinFunc)(Obj* args, Obj* env);
+/* Forward declarations (Obj, Interp and BuiltinFunc are in tinylisp.h) */
+typedef struct Code Code;
+typedef struct MemoCache MemoCache;
+typedef struct ParseLevel ParseLevel;
+typedef struct Deque Deque;
+typedef struct HashEntry HashEntry;
 
 /* Object structure */
 struct Obj {
     ObjType type;
+    unsigned char marked;           /* GC mark bit, kept while the object is old */
+    unsigned char remembered;       /* In a remembered set, see WRITE_BARRIER */
+    unsigned char shared;           /* In a frozen parent instance, never written */
     union {
-        int num;                    /* For T_INT */
-        char* sym;                  /* For T_SYMBOL */
+        struct {                    /* For T_SYMBOL */
+            char* sym;              /* Name */
+            SpecialForm special;    /* Special form this symbol names */
+            unsigned int hash;      /* Hash of the name */
+        };
         struct {                    /* For T_CONS */
             Obj* car;
             Obj* cdr;
@@ -34,598 +88,6549 @@ struct Obj {
         struct {                    /* For T_LAMBDA */
             Obj* params;            /* Parameter list */
             Obj* body;              /* Function body */
-            Obj* env;               /* Closure environment */
+            Obj* env;               /* Closure environment (a frame or nil) */
         } lambda;
+        struct {                    /* For T_FRAME */
+            Obj* parent;            /* Enclosing frame, nil at top level */
+            Obj** slots;            /* Values, stored after the cell */
+            int size;
+        } frame;
+        struct {                    /* For T_LOCAL */
+            int depth;              /* Frames to walk up */
+            int index;              /* Slot within that frame */
+            Obj* name;              /* Symbol, for printing */
+        } local;
+        struct {                    /* For T_GLOBAL */
+            Obj* cell;              /* (symbol . value) binding */
+            Obj* cached;            /* Call site cache, see global_callee */
+            size_t cached_epoch;    /* global_epoch it was filled at, 0 if empty */
+        };
+        Code* code;                 /* For T_CODE */
+        struct {                    /* For T_VECTOR */
+            int numeric;            /* Elements are raw integers in nums */
+            int len;
+            union {
+                Obj** items;        /* Stored after the cell when small */
+                int* nums;
+            };
+        } vector;
+        struct {                    /* For T_MEMO */
+            Obj* func;              /* Function being memoized */
+            MemoCache* cache;
+        } memo;
+        struct {                    /* For T_FUTURE */
+            Obj* call;              /* (func . args), nil once finished */
+            Obj* value;
+            int state;              /* FUTURE_QUEUED, _RUNNING or _DONE */
+        } future;
+        struct {                    /* For T_MACRO */
+            Obj* expander;          /* Lambda run on the unevaluated arguments */
+            int rest;               /* Its last parameter takes the remaining ones */
+        } macro;
+        struct {                    /* For T_BIG */
+            int negative;
+            int len;                /* Limbs in use; the top one is nonzero */
+            int size;               /* Limbs allocated */
+            uint32_t* limbs;        /* Least significant first, stored after
+                                     * the cell when small */
+        } big;
+        struct {                    /* For T_HASH */
+            HashEntry* entries;     /* Open addressing, capacity a power of 2 */
+            int count;
+            int capacity;
+        } htab;
+        Obj* next_free;             /* For T_FREE */
     };
 };
 
-/* Global nil and t symbols */
-Obj* nil_obj;
-Obj* t_obj;
+/* Compiled function body, see the bytecode engine below */
+struct Code {
+    unsigned short* ops;
+    int len;
+    Obj** consts;
+    int nconsts;
+    int nparams;
+    int rest;                   /* The last parameter takes the remaining arguments */
+    int max_stack;              /* Deepest value stack use within one call */
+    Obj* params;
+    Obj* name;                  /* defun name, nil for lambdas */
+};
 
-/* Memory management - simple mark-and-sweep GC */
-#define MAX_OBJS 10000
-Obj* all_objs[MAX_OBJS];
-int obj_count = 0;
+/* Result cache of a memoized function: a chained hash table of argument
+ * lists, with the entries also on a list in least-recently-used order */
+typedef struct MemoEntry {
+    Obj* args;                  /* Argument list (the key) */
+    Obj* value;
+    unsigned int hash;
+    struct MemoEntry* chain;    /* Next entry in the same bucket */
+    struct MemoEntry* newer;
+    struct MemoEntry* older;
+} MemoEntry;
 
-/* Allocate a new object */
-Obj* alloc_obj(ObjType type) {
-    if (obj_count >= MAX_OBJS) {
+#define MEMO_DEFAULT_LIMIT 65536
+
+/* Slot of a hash table; the key is NULL in an empty slot */
+struct HashEntry {
+    Obj* key;
+    Obj* value;
+    unsigned int hash;
+};
+
+struct MemoCache {
+    MemoEntry** buckets;
+    size_t nbuckets;
+    size_t count;
+    size_t limit;               /* Most entries kept before evicting */
+    MemoEntry* newest;
+    MemoEntry* oldest;
+};
+
+/* Integers are tagged fixnums: the value is stored in the pointer itself
+ * with the low bit set, so arithmetic never allocates.  Heap cells are
+ * at least 16-byte aligned, so a real Obj* never has that bit set.  Use
+ * TYPE() instead of ->type on any value that may be an integer.  IS_INT
+ * and INT_VAL are in tinylisp.h. */
+#define TYPE(obj) (IS_INT(obj) ? T_INT : (obj)->type)
+
+/* Global nil and t symbols.  They are statically allocated, so testing
+ * for nil compares against a link-time constant, and the collector never
+ * traces or frees them.  Every interpreter instance shares them. */
+Obj nil_symbol;
+Obj t_symbol;
+
+/* Compile lambda bodies to bytecode (--vm) */
+int use_vm = 0;
+
+/* Memory management - slab allocator with generational mark-and-sweep GC
+ *
+ * Cells are carved out of large slabs, one list of slabs per size class:
+ * plain objects use the smallest class and frames use the class that fits
+ * their slots inline after the Obj header.  A fresh slab is handed out
+ * by bumping a pointer, so objects allocated together sit next to each
+ * other; cells freed by the sweep go back on their slab's free list in
+ * address order and are reused first.
+ *
+ * The collector is generational without moving anything: mark bits are
+ * sticky.  An object that survives a collection keeps its mark and is
+ * old from then on.  A minor collection runs when obj_count (cells
+ * allocated since the last collection) reaches gc_threshold, the
+ * nursery size.  It marks from the roots but stops at anything already
+ * marked, and sweeps only the young slabs, the ones allocated from since
+ * the last collection, so its cost follows the young objects rather than
+ * the whole heap.  Survivors are promoted by the marking itself.  Once
+ * the promoted cells (old_count) reach old_threshold, the next
+ * collection is a full one: it clears every mark, traces the whole heap
+ * and sweeps every slab, then resets old_threshold to a multiple of the
+ * live cells.  Slabs left completely empty beyond that are returned to
+ * the system.  Large vectors keep their elements in malloc'd storage,
+ * which counts separately: young storage against vector_threshold and
+ * all of it against old_vector_threshold, so that a loop creating big
+ * vectors out of few cells still gets collected.
+ *
+ * A minor collection does not trace old objects, so an old object that
+ * is made to point at a young one must be recorded: any store into an
+ * object that may have survived a collection since it was allocated
+ * (anything but initializing a cell just allocated) is followed by
+ * WRITE_BARRIER on that object.  The barrier adds marked objects to the
+ * thread's remembered set, whose fields a minor collection marks from.
+ *
+ * Roots are nil/t, the global environment and the root stack.  C code
+ * that holds an object across a call that may allocate must register the
+ * local variable with PROTECT and drop it again with UNPROTECT (or by
+ * restoring root_count).
+ *
+ * All of this state belongs to one interpreter instance (an Interp, see
+ * below); instances have separate heaps and never share objects.  Every
+ * thread running Lisp code in an instance (see the thread pool below)
+ * has its own root, value and VM stacks, its own size classes to
+ * allocate from, its own remembered set and its own counters, reached
+ * through __thread variables.  The instance's heap is shared by its
+ * threads.  A collection stops the world: the collecting thread waits
+ * until every other thread is parked, either at its next allocation or
+ * in a wait, so their stacks hold still while it marks and sweeps.  The
+ * count of allocated cells is taken in batches, so threads only touch it
+ * once every ALLOC_BATCH allocations.
+ */
+#define GC_MIN_THRESHOLD 32768      /* Nursery size in cells */
+#define GC_MIN_OLD_CELLS 100000
+#define GC_GROWTH_FACTOR 2
+#define GC_MIN_VECTOR_BYTES (16 * 1024 * 1024)
+#define ALLOC_BATCH 256
+
+#define SLAB_BYTES (64 * 1024)
+
+#define CELL_ALIGN 16
+#define NUM_SIZE_CLASSES 15         /* sizeof(Obj) up to 15 * CELL_ALIGN + 16 bytes */
+
+typedef struct Slab {
+    struct Slab* next;
+    size_t used;                    /* Cells handed out so far (bump pointer) */
+    size_t capacity;                /* Cells in this slab */
+    size_t live;                    /* Cells in use after its last sweep */
+    Obj* free_list;                 /* Freed cells below used */
+    int young;                      /* Allocated from since the last collection */
+    char* cells;
+} Slab;
+
+/* Slab header size, rounded up so the cells after it stay aligned */
+#define SLAB_HEADER ((sizeof(Slab) + CELL_ALIGN - 1) / CELL_ALIGN * CELL_ALIGN)
+
+typedef struct {
+    size_t cell_size;
+    Slab* slabs;                    /* Newest first */
+    Slab* current;                  /* Slab being allocated from */
+    Slab* cursor;                   /* Next slab to try when it is full */
+    size_t total_cells;             /* Capacity of all slabs in the class */
+} SizeClass;
+
+__thread SizeClass* size_classes;  /* This thread's, in its Mutator */
+
+/* Largest number of frame slots stored inline; bigger frames malloc them */
+#define MAX_INLINE_SLOTS \
+    ((int)((sizeof(Obj) + (NUM_SIZE_CLASSES - 1) * CELL_ALIGN - sizeof(Obj)) / sizeof(Obj*)))
+
+/* Likewise for the limbs of a bignum */
+#define MAX_INLINE_LIMBS ((int)((NUM_SIZE_CLASSES - 1) * CELL_ALIGN / sizeof(uint32_t)))
+
+/* Runtime counters, reported by (stats) and --stats.  They are plain
+ * increments on paths that already do far more work, so they stay on.
+ * Each thread counts for itself; total_counters adds them up. */
+typedef struct {
+    size_t alloc_total;             /* Objects ever allocated */
+    size_t alloc_by_type[T_FREE];
+    size_t bytes_in_use;            /* Cell bytes allocated and not swept */
+    size_t eval_calls;
+    size_t builtin_calls;
+    size_t lambda_calls;
+    size_t global_lookups;          /* global_cell calls */
+    size_t global_probes;           /* Table slots they examined */
+    size_t call_cache_misses;       /* Calls that had to refill their cache */
+} Counters;
+
+__thread Counters* counters;        /* This thread's, in its Mutator */
+int show_stats = 0;                 /* Print the counters on exit */
+
+__thread Obj*** root_stack = NULL;
+__thread size_t root_count = 0;
+__thread size_t root_capacity = 0;
+
+/* Value stack, shared by both engines: built-in arguments are pushed
+ * here by the tree walker, and the VM keeps its operands here.  It and
+ * the code/env of every active VM call are GC roots. */
+typedef struct {
+    Obj* code;                  /* T_CODE being executed */
+    Obj* env;                   /* Current frame (the call's or a let's) */
+    int pc;
+    size_t base;                /* Value stack height when the call started */
+} VMFrame;
+
+__thread Obj** value_stack = NULL;
+__thread size_t value_sp = 0;
+__thread size_t value_capacity = 0;
+
+__thread VMFrame* vm_frames = NULL;
+__thread size_t vm_fp = 0;
+__thread size_t vm_frames_capacity = 0;
+
+/* A thread that runs Lisp code in one interpreter instance: the thread
+ * calling into the instance, or one of its pool workers.  The __thread
+ * stack variables are copies of the current Mutator's; they are saved
+ * back whenever the thread parks or leaves the instance, so a collection
+ * running meanwhile can mark them. */
+typedef struct Mutator {
+    Interp* interp;
+    SizeClass size_classes[NUM_SIZE_CLASSES];
+    Counters counters;
+    Obj*** root_stack;
+    size_t root_count;
+    size_t root_capacity;
+    Obj** value_stack;
+    size_t value_sp;
+    size_t value_capacity;
+    VMFrame* vm_frames;
+    size_t vm_fp;
+    size_t vm_frames_capacity;
+    Obj** prof_stack;
+    size_t prof_depth;
+    size_t prof_capacity;
+    Obj** remembered;               /* Old objects written since the last collection */
+    size_t remembered_count;
+    size_t remembered_capacity;
+    int thread_index;               /* Its deque in the thread pool */
+    size_t alloc_budget;            /* Allocations left in its current batch */
+    struct Mutator* next;
+} Mutator;
+
+/* Growable byte buffer */
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+} Buffer;
+
+void buffer_append(Buffer* b, const char* data, size_t len) {
+    if (b->len + len + 1 > b->cap) {
+        while (b->len + len + 1 > b->cap) {
+            b->cap = b->cap ? b->cap * 2 : 4096;
+        }
+        b->data = (char*)realloc(b->data, b->cap);
+        if (!b->data) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+    b->data[b->len] = '\0';
+}
+
+/* An interpreter instance: everything that used to be process-wide.
+ * Instances share nothing but nil and t, so threads running different
+ * instances never contend.  interp is the calling thread's instance. */
+struct Interp {
+    size_t obj_count;               /* Cells allocated or reserved since the last collection */
+    size_t gc_threshold;
+    size_t old_count;               /* Cells promoted since the last full collection */
+    size_t old_threshold;
+    int full_pending;               /* Make the next collection a full one */
+    size_t vector_bytes;            /* malloc'd vector, bignum and hash table storage
+                                     * not yet swept */
+    size_t vector_threshold;
+    size_t old_vector_threshold;
+    size_t heap_bytes;              /* Bytes currently held in slabs */
+    size_t heap_peak_bytes;
+    pthread_mutex_t heap_lock;      /* For the two above */
+    Obj** mark_stack;
+    size_t mark_count;
+    size_t mark_capacity;
+    
+    /* Stopping the world: running_mutators counts the registered threads
+     * that are not parked; a collector sets gc_requested and waits for it
+     * to drop to zero.  main is the caller's Mutator, parked between
+     * calls into the instance. */
+    Mutator main;
+    Mutator* mutators;              /* Every registered thread */
+    pthread_mutex_t world_lock;
+    pthread_cond_t world_cond;
+    int running_mutators;
+    int gc_requested;
+    
+    /* Collection statistics */
+    size_t gc_cycles;
+    size_t gc_full_cycles;
+    size_t gc_freed_total;
+    double gc_pause_total_ms;
+    double gc_pause_max_ms;
+    double gc_minor_pause_max_ms;
+    
+    /* Symbol intern table: open addressing over name hashes.  Every
+     * symbol is reachable from here, so symbols are never collected. */
+    Obj** symbol_table;
+    size_t symbol_count;
+    size_t symbol_capacity;
+    Obj* sym_quote;                 /* Used by the reader for 'x */
+    Obj* sym_quasiquote;            /* `x, ,x and ,@x */
+    Obj* sym_unquote;
+    Obj* sym_unquote_splicing;
+    Obj* sym_lambda;
+    Obj* sym_rest;                  /* &rest in a lambda list */
+    int gensym_count;
+    
+    /* A frozen instance whose symbols, globals and heap this one reads
+     * through, see interp_create_overlay.  Its objects never point into
+     * this instance, so collections here stop at them. */
+    Interp* parent;
+    Obj* memo_overlays;             /* (parent memo . this instance's memo) pairs */
+    
+    /* Global environment: open-addressing hash table of (symbol . value)
+     * bindings keyed by the interned symbol.  Bindings are never removed,
+     * so resolved code can point straight at them. */
+    Obj** global_table;
+    size_t global_count;
+    size_t global_capacity;
+    size_t global_epoch;            /* Bumped by every global_define */
+    pthread_mutex_t table_lock;     /* For both tables, see lock_tables */
+    
+    /* Registered built-ins, so heap images can name them by index */
+    BuiltinFunc* builtin_table;
+    int builtin_count;
+    int builtin_capacity;
+    
+    ParseLevel* parse_levels;       /* Parser stack, see parse_expr */
+    size_t parse_capacity;
+    Obj* last_result;               /* Of interp_eval_string, kept until the next */
+    Buffer* output;                 /* Collects what print writes, if set */
+    pthread_mutex_t output_lock;
+    pthread_mutex_t memo_lock;      /* For every memo cache; never held
+                                       across an allocation */
+    
+    /* Thread pool, see spawn_future */
+    int pool_started;
+    int pool_size;                  /* Worker threads */
+    int pool_stopping;              /* Set by interp_destroy */
+    Deque* deques;                  /* One per thread, the main thread's first */
+    pthread_t* workers;
+    int worker_count;               /* Workers started, for interp_destroy */
+    size_t queued_futures;          /* In a deque and not yet claimed */
+    size_t running_futures;
+    int idle_workers;
+    int touch_waiters;
+    pthread_mutex_t pool_lock;
+    pthread_cond_t work_cond;       /* A future was queued */
+    pthread_cond_t done_cond;       /* A future finished */
+};
+
+__thread Mutator* mutator = NULL;
+__thread Interp* interp = NULL;
+__thread int thread_index = 0;      /* This thread's deque in the thread pool */
+
+int gc_trace = 0;                   /* Report each collection on stderr */
+
+/* Sampling profiler (--profile).  The tree walker keeps a shadow stack
+ * of the lambdas it is running; compiled calls are already listed in
+ * vm_frames.  SIGPROF only sets prof_pending, and the sample is taken at
+ * the next call, where the stacks are consistent.  When the profiler is
+ * off, the only cost is testing prof_pending and profiling. */
+int profiling = 0;
+volatile sig_atomic_t prof_pending = 0;
+__thread Obj** prof_stack = NULL;   /* defun names, NULL for anonymous lambdas */
+__thread size_t prof_depth = 0;
+__thread size_t prof_capacity = 0;
+
+void prof_sample();
+
+#define PROTECT(var) push_root(&(var))
+#define UNPROTECT(n) (root_count -= (n))
+
+/* Write barrier, see above: only an old object that is not remembered
+ * yet takes the call */
+#define WRITE_BARRIER(obj) \
+    do { \
+        if ((obj)->marked && !__atomic_load_n(&(obj)->remembered, __ATOMIC_RELAXED)) { \
+            remember(obj); \
+        } \
+    } while (0)
+
+void push_root(Obj** slot) {
+    if (root_count == root_capacity) {
+        root_capacity = root_capacity ? root_capacity * 2 : 256;
+        root_stack = (Obj***)realloc(root_stack, root_capacity * sizeof(Obj**));
+        if (!root_stack) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    root_stack[root_count++] = slot;
+}
+
+/* Add an old object to this thread's remembered set */
+void remember(Obj* obj) {
+    /* Another thread may be remembering it at the same time */
+    if (__atomic_exchange_n(&obj->remembered, 1, __ATOMIC_RELAXED)) return;
+    Mutator* m = mutator;
+    if (m->remembered_count == m->remembered_capacity) {
+        m->remembered_capacity = m->remembered_capacity ? m->remembered_capacity * 2 : 256;
+        m->remembered = (Obj**)realloc(m->remembered, m->remembered_capacity * sizeof(Obj*));
+        if (!m->remembered) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    m->remembered[m->remembered_count++] = obj;
+}
+
+/* Make room for at least slots more values on the value stack */
+void reserve_values(size_t slots) {
+    if (value_sp + slots <= value_capacity) return;
+    while (value_sp + slots > value_capacity) {
+        value_capacity = value_capacity ? value_capacity * 2 : 1024;
+    }
+    value_stack = (Obj**)realloc(value_stack, value_capacity * sizeof(Obj*));
+    if (!value_stack) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+}
+
+double now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* Push an object's children on the mark stack */
+void push_children(Obj* obj) {
+    Obj** stack = interp->mark_stack;
+    size_t capacity = interp->mark_capacity;
+    size_t count = interp->mark_count;
+    
+    /* Make room for every child this object can push */
+    size_t children = 3;
+    if (obj->type == T_FRAME) children = (size_t)obj->frame.size + 1;
+    if (obj->type == T_CODE) children = (size_t)obj->code->nconsts + 2;
+    if (obj->type == T_MEMO) children = obj->memo.cache->count * 2 + 1;
+    if (obj->type == T_VECTOR) children = (size_t)obj->vector.len;
+    if (obj->type == T_HASH) children = (size_t)obj->htab.count * 2;
+    while (count + children > capacity) {
+        capacity *= 2;
+        stack = (Obj**)realloc(stack, capacity * sizeof(Obj*));
+        if (!stack) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    
+    switch (obj->type) {
+        case T_CONS:
+            stack[count++] = obj->cons.cdr;
+            stack[count++] = obj->cons.car;
+            break;
+        case T_LAMBDA:
+            stack[count++] = obj->lambda.params;
+            stack[count++] = obj->lambda.body;
+            stack[count++] = obj->lambda.env;
+            break;
+        case T_FRAME:
+            stack[count++] = obj->frame.parent;
+            for (int i = 0; i < obj->frame.size; i++) {
+                stack[count++] = obj->frame.slots[i];
+            }
+            break;
+        case T_LOCAL:
+            stack[count++] = obj->local.name;
+            break;
+        case T_GLOBAL:
+            stack[count++] = obj->cell;
+            break;
+        case T_VECTOR:
+            if (obj->vector.numeric) break;
+            for (int i = 0; i < obj->vector.len; i++) {
+                stack[count++] = obj->vector.items[i];
+            }
+            break;
+        case T_FUTURE:
+            stack[count++] = obj->future.call;
+            stack[count++] = obj->future.value;
+            break;
+        case T_MACRO:
+            stack[count++] = obj->macro.expander;
+            break;
+        case T_HASH:
+            for (int i = 0; i < obj->htab.capacity; i++) {
+                if (!obj->htab.entries[i].key) continue;
+                stack[count++] = obj->htab.entries[i].key;
+                stack[count++] = obj->htab.entries[i].value;
+            }
+            break;
+        case T_MEMO:
+            stack[count++] = obj->memo.func;
+            for (MemoEntry* e = obj->memo.cache->newest; e; e = e->older) {
+                stack[count++] = e->args;
+                stack[count++] = e->value;
+            }
+            break;
+        case T_CODE:
+            stack[count++] = obj->code->params;
+            stack[count++] = obj->code->name;
+            for (int i = 0; i < obj->code->nconsts; i++) {
+                stack[count++] = obj->code->consts[i];
+            }
+            break;
+        default:
+            break;
+    }
+    interp->mark_stack = stack;
+    interp->mark_capacity = capacity;
+    interp->mark_count = count;
+}
+
+/* Mark what is on the mark stack and everything reachable from it
+ * (iteratively, so long lists cannot overflow the C stack).  Marked
+ * objects are not entered, so in a minor collection the trace stops at
+ * old objects.  Returns the number of objects newly marked. */
+size_t mark_pending() {
+    size_t marked = 0;
+    while (interp->mark_count > 0) {
+        Obj* obj = interp->mark_stack[--interp->mark_count];
+        if (!obj || IS_INT(obj) || obj->marked) continue;
+        obj->marked = 1;
+        marked++;
+        push_children(obj);
+    }
+    return marked;
+}
+
+/* Mark an object and everything reachable from it */
+size_t gc_mark(Obj* root) {
+    interp->mark_stack[interp->mark_count++] = root;
+    return mark_pending();
+}
+
+/* Mark from an object's fields even though it is marked itself: the
+ * remembered objects of a minor collection */
+size_t gc_mark_fields(Obj* obj) {
+    push_children(obj);
+    return mark_pending();
+}
+
+/* Bytes of malloc'd element storage behind a large vector */
+size_t vector_storage(Obj* vec) {
+    return (size_t)vec->vector.len * (vec->vector.numeric ? sizeof(int) : sizeof(Obj*));
+}
+
+/* Release any storage an object owns outside its cell */
+void finalize_obj(Obj* obj) {
+    if (obj->type == T_SYMBOL) free(obj->sym);
+    if (obj->type == T_FRAME && obj->frame.size > MAX_INLINE_SLOTS) {
+        free(obj->frame.slots);
+    }
+    if (obj->type == T_CODE) {
+        free(obj->code->ops);
+        free(obj->code->consts);
+        free(obj->code);
+    }
+    if (obj->type == T_VECTOR && obj->vector.len > MAX_INLINE_SLOTS) {
+        interp->vector_bytes -= vector_storage(obj);
+        free(obj->vector.items);
+    }
+    if (obj->type == T_BIG && obj->big.size > MAX_INLINE_LIMBS) {
+        interp->vector_bytes -= (size_t)obj->big.size * sizeof(uint32_t);
+        free(obj->big.limbs);
+    }
+    if (obj->type == T_HASH) {
+        interp->vector_bytes -= (size_t)obj->htab.capacity * sizeof(HashEntry);
+        free(obj->htab.entries);
+    }
+    if (obj->type == T_MEMO) {
+        MemoEntry* e = obj->memo.cache->newest;
+        while (e) {
+            MemoEntry* older = e->older;
+            free(e);
+            e = older;
+        }
+        free(obj->memo.cache->buckets);
+        free(obj->memo.cache);
+    }
+}
+
+/* Sweep one size class: every slab in a full collection, only the young
+ * ones in a minor collection.  A swept slab gets its free list rebuilt
+ * from the unmarked cells; marked cells keep their mark, as they are
+ * old now.  Slabs left completely empty are returned to the system once
+ * the class keeps enough capacity for GC_GROWTH_FACTOR times its live
+ * cells.  Returns the bytes still in use. */
+size_t sweep_class(SizeClass* sc, int full) {
+    Slab** link = &sc->slabs;
+    Slab* empty = NULL;
+    size_t live = 0;
+    
+    sc->total_cells = 0;
+    while (*link) {
+        Slab* slab = *link;
+        if (full || slab->young) {
+            Obj* slab_free = NULL;
+            Obj** slab_tail = &slab_free;
+            slab->live = 0;
+            for (size_t i = 0; i < slab->used; i++) {
+                Obj* obj = (Obj*)(slab->cells + i * sc->cell_size);
+                if (obj->type == T_FREE) {
+                    /* Already free: relink below */
+                } else if (obj->marked) {
+                    slab->live++;
+                    continue;
+                } else {
+                    finalize_obj(obj);
+                    obj->type = T_FREE;
+                }
+                *slab_tail = obj;
+                slab_tail = &obj->next_free;
+            }
+            *slab_tail = NULL;
+            slab->free_list = slab_free;
+            slab->young = 0;
+            
+            if (slab->live == 0) {
+                /* Set empty slabs aside until the live count is known */
+                *link = slab->next;
+                slab->next = empty;
+                empty = slab;
+                continue;
+            }
+        }
+        live += slab->live;
+        sc->total_cells += slab->capacity;
+        link = &slab->next;
+    }
+    
+    while (empty) {
+        Slab* slab = empty;
+        empty = slab->next;
+        if (sc->total_cells >= live * GC_GROWTH_FACTOR) {
+            interp->heap_bytes -= SLAB_HEADER + slab->capacity * sc->cell_size;
+            free(slab);
+            continue;
+        }
+        
+        /* Keep the slab, to be bump-allocated from again */
+        slab->used = 0;
+        slab->free_list = NULL;
+        slab->next = *link;
+        *link = slab;
+        link = &slab->next;
+        sc->total_cells += slab->capacity;
+    }
+    
+    sc->current = NULL;
+    sc->cursor = sc->slabs;
+    return live * sc->cell_size;
+}
+
+/* Copy this thread's stacks into its Mutator record */
+void publish_stacks() {
+    mutator->root_stack = root_stack;
+    mutator->root_count = root_count;
+    mutator->root_capacity = root_capacity;
+    mutator->value_stack = value_stack;
+    mutator->value_sp = value_sp;
+    mutator->value_capacity = value_capacity;
+    mutator->vm_frames = vm_frames;
+    mutator->vm_fp = vm_fp;
+    mutator->vm_frames_capacity = vm_frames_capacity;
+    mutator->prof_stack = prof_stack;
+    mutator->prof_depth = prof_depth;
+    mutator->prof_capacity = prof_capacity;
+}
+
+/* Make m the calling thread's Mutator, and its instance the current
+ * one, loading its stacks.  NULL leaves all instances. */
+void use_mutator(Mutator* m) {
+    mutator = m;
+    interp = m ? m->interp : NULL;
+    if (!m) return;
+    size_classes = m->size_classes;
+    counters = &m->counters;
+    thread_index = m->thread_index;
+    root_stack = m->root_stack;
+    root_count = m->root_count;
+    root_capacity = m->root_capacity;
+    value_stack = m->value_stack;
+    value_sp = m->value_sp;
+    value_capacity = m->value_capacity;
+    vm_frames = m->vm_frames;
+    vm_fp = m->vm_fp;
+    vm_frames_capacity = m->vm_frames_capacity;
+    prof_stack = m->prof_stack;
+    prof_depth = m->prof_depth;
+    prof_capacity = m->prof_capacity;
+}
+
+/* Park: until leave_safe, this thread does not touch the heap, so a
+ * collection may run.  Any wait that can last while another thread
+ * allocates must happen between the two. */
+void enter_safe() {
+    pthread_mutex_lock(&interp->world_lock);
+    publish_stacks();
+    interp->running_mutators--;
+    pthread_cond_broadcast(&interp->world_cond);
+    pthread_mutex_unlock(&interp->world_lock);
+}
+
+/* Unpark, first waiting for any collection in progress */
+void leave_safe() {
+    pthread_mutex_lock(&interp->world_lock);
+    while (interp->gc_requested) pthread_cond_wait(&interp->world_cond, &interp->world_lock);
+    interp->running_mutators++;
+    pthread_mutex_unlock(&interp->world_lock);
+}
+
+/* The symbol and global tables are shared by the instance's threads.  Their lock
+ * is held across allocation, which may collect, so a thread waiting for
+ * it parks rather than blocking the collector. */
+void lock_tables() {
+    if (pthread_mutex_trylock(&interp->table_lock) == 0) return;
+    enter_safe();
+    pthread_mutex_lock(&interp->table_lock);
+    leave_safe();
+}
+
+void unlock_tables() {
+    pthread_mutex_unlock(&interp->table_lock);
+}
+
+/* Add a zeroed Mutator to an instance, with empty size classes.  It
+ * starts out parked: the thread that takes it calls leave_safe. */
+void register_mutator(Interp* in, Mutator* m) {
+    for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+        m->size_classes[i].cell_size = sizeof(Obj) + i * CELL_ALIGN;
+    }
+    m->interp = in;
+    
+    pthread_mutex_lock(&in->world_lock);
+    m->next = in->mutators;
+    in->mutators = m;
+    pthread_mutex_unlock(&in->world_lock);
+}
+
+/* Switch the calling thread to an instance as its main thread, and
+ * return the Mutator it was using, for leave_interp.  Entering the
+ * current instance again (from one of its built-ins) changes nothing. */
+Mutator* enter_interp(Interp* in) {
+    Mutator* saved = mutator;
+    if (saved && saved->interp == in) return saved;
+    if (saved) enter_safe();
+    use_mutator(&in->main);
+    leave_safe();
+    return saved;
+}
+
+void leave_interp(Mutator* saved) {
+    if (saved == mutator) return;
+    enter_safe();
+    use_mutator(saved);
+    if (saved) leave_safe();
+}
+
+void mark_futures(size_t* live);
+
+/* Clear the mark of every cell, ahead of a full collection */
+void clear_marks() {
+    for (Mutator* m = interp->mutators; m; m = m->next) {
+        for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+            SizeClass* sc = &m->size_classes[i];
+            for (Slab* slab = sc->slabs; slab; slab = slab->next) {
+                for (size_t j = 0; j < slab->used; j++) {
+                    ((Obj*)(slab->cells + j * sc->cell_size))->marked = 0;
+                }
+            }
+        }
+    }
+}
+
+/* Mark and sweep, with every other thread parked */
+void collect() {
+    double start = now_ms();
+    int full = interp->full_pending;
+    
+    if (!interp->mark_stack) {
+        interp->mark_capacity = 1024;
+        interp->mark_stack = (Obj**)malloc(interp->mark_capacity * sizeof(Obj*));
+    }
+    
+    /* Mark from the roots, and in a minor collection from the fields of
+     * the remembered objects.  What gets newly marked is live (in a full
+     * collection) or promoted (in a minor one). */
+    if (full) clear_marks();
+    size_t live = 0;
+    for (size_t i = 0; i < interp->global_capacity; i++) {
+        if (interp->global_table[i]) live += gc_mark(interp->global_table[i]);
+    }
+    for (size_t i = 0; i < interp->symbol_capacity; i++) {
+        if (interp->symbol_table[i]) live += gc_mark(interp->symbol_table[i]);
+    }
+    live += gc_mark(interp->last_result);
+    live += gc_mark(interp->memo_overlays);
+    for (Mutator* m = interp->mutators; m; m = m->next) {
+        for (size_t i = 0; i < m->root_count; i++) {
+            live += gc_mark(*m->root_stack[i]);
+        }
+        for (size_t i = 0; i < m->value_sp; i++) {
+            live += gc_mark(m->value_stack[i]);
+        }
+        for (size_t i = 0; i < m->vm_fp; i++) {
+            live += gc_mark(m->vm_frames[i].code);
+            live += gc_mark(m->vm_frames[i].env);
+        }
+        for (size_t i = 0; i < m->remembered_count; i++) {
+            Obj* obj = m->remembered[i];
+            obj->remembered = 0;
+            if (!full) live += gc_mark_fields(obj);
+        }
+        m->remembered_count = 0;
+    }
+    mark_futures(&live);
+    
+    /* Sweep, and take back the allocations reserved but not made */
+    for (Mutator* m = interp->mutators; m; m = m->next) {
+        m->counters.bytes_in_use = 0;
+        for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+            m->counters.bytes_in_use += sweep_class(&m->size_classes[i], full);
+        }
+        interp->obj_count -= m->alloc_budget;
+        m->alloc_budget = 0;
+    }
+    size_t freed;
+    if (full) {
+        freed = interp->old_count + interp->obj_count - live;
+        interp->old_count = live;
+        interp->old_threshold = live * GC_GROWTH_FACTOR;
+        if (interp->old_threshold < GC_MIN_OLD_CELLS) interp->old_threshold = GC_MIN_OLD_CELLS;
+        interp->old_vector_threshold = interp->vector_bytes * GC_GROWTH_FACTOR;
+        if (interp->old_vector_threshold < GC_MIN_VECTOR_BYTES) {
+            interp->old_vector_threshold = GC_MIN_VECTOR_BYTES;
+        }
+        interp->gc_full_cycles++;
+    } else {
+        freed = interp->obj_count - live;
+        interp->old_count += live;
+    }
+    interp->obj_count = 0;
+    interp->vector_threshold = interp->vector_bytes + GC_MIN_VECTOR_BYTES;
+    interp->full_pending = interp->old_count >= interp->old_threshold ||
+                           interp->vector_bytes >= interp->old_vector_threshold;
+    
+    double pause = now_ms() - start;
+    interp->gc_cycles++;
+    interp->gc_freed_total += freed;
+    interp->gc_pause_total_ms += pause;
+    if (pause > interp->gc_pause_max_ms) interp->gc_pause_max_ms = pause;
+    if (!full && pause > interp->gc_minor_pause_max_ms) interp->gc_minor_pause_max_ms = pause;
+    
+    if (gc_trace) {
+        fprintf(stderr, "[gc %zu %s] %s=%zu freed=%zu pause=%.3fms old=%zu\n",
+                interp->gc_cycles, full ? "full" : "minor", full ? "live" : "promoted",
+                live, freed, pause, interp->old_count);
+    }
+}
+
+/* Run a full collection.  If another thread is already collecting, this
+ * just waits for it to finish. */
+void gc() {
+    pthread_mutex_lock(&interp->world_lock);
+    publish_stacks();
+    interp->running_mutators--;
+    if (interp->gc_requested) {
+        pthread_cond_broadcast(&interp->world_cond);
+        while (interp->gc_requested) pthread_cond_wait(&interp->world_cond, &interp->world_lock);
+    } else {
+        __atomic_store_n(&interp->gc_requested, 1, __ATOMIC_RELEASE);
+        while (interp->running_mutators > 0) pthread_cond_wait(&interp->world_cond, &interp->world_lock);
+        collect();
+        __atomic_store_n(&interp->gc_requested, 0, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&interp->world_cond);
+    }
+    interp->running_mutators++;
+    pthread_mutex_unlock(&interp->world_lock);
+}
+
+/* Take a cell from a size class: from the current slab's free list or
+ * bump pointer, else from the next slab along that has room, else from
+ * a fresh slab.  Whichever slab a cell comes from is young until the
+ * next sweep. */
+Obj* alloc_cell(SizeClass* sc) {
+    Slab* slab = sc->current;
+    if (slab) {
+        Obj* obj = slab->free_list;
+        if (obj) {
+            slab->free_list = obj->next_free;
+            return obj;
+        }
+        if (slab->used < slab->capacity) {
+            return (Obj*)(slab->cells + slab->used++ * sc->cell_size);
+        }
+    }
+    
+    /* Slabs behind the cursor stay full until the next sweep */
+    while ((slab = sc->cursor)) {
+        sc->cursor = slab->next;
+        if (slab->free_list || slab->used < slab->capacity) {
+            slab->young = 1;
+            sc->current = slab;
+            return alloc_cell(sc);
+        }
+    }
+    
+    size_t capacity = (SLAB_BYTES - SLAB_HEADER) / sc->cell_size;
+    slab = (Slab*)malloc(SLAB_HEADER + capacity * sc->cell_size);
+    if (!slab) {
         fprintf(stderr, "Out of memory\n");
         exit(1);
     }
-    Obj* obj = (Obj*)malloc(sizeof(Obj));
+    slab->used = 0;
+    slab->capacity = capacity;
+    slab->live = 0;
+    slab->free_list = NULL;
+    slab->young = 1;
+    slab->cells = (char*)slab + SLAB_HEADER;
+    slab->next = sc->slabs;
+    sc->slabs = slab;
+    sc->current = slab;
+    sc->total_cells += capacity;
+    pthread_mutex_lock(&interp->heap_lock);
+    interp->heap_bytes += SLAB_HEADER + capacity * sc->cell_size;
+    if (interp->heap_bytes > interp->heap_peak_bytes) interp->heap_peak_bytes = interp->heap_bytes;
+    pthread_mutex_unlock(&interp->heap_lock);
+    return (Obj*)(slab->cells + slab->used++ * sc->cell_size);
+}
+
+/* Start a new batch of allocations, collecting first if the heap has
+ * reached its threshold or another thread is waiting to collect.  On a
+ * single thread the batch runs up to the threshold, so collections
+ * happen exactly when obj_count reaches it. */
+void reserve_allocs() {
+    if (__atomic_load_n(&interp->gc_requested, __ATOMIC_ACQUIRE) ||
+        __atomic_load_n(&interp->obj_count, __ATOMIC_RELAXED) >= interp->gc_threshold ||
+        __atomic_load_n(&interp->vector_bytes, __ATOMIC_RELAXED) >= interp->vector_threshold) {
+        gc();
+    }
+    if (mutator->alloc_budget > 0) return;
+    size_t batch = interp->pool_size ? ALLOC_BATCH : interp->gc_threshold - interp->obj_count;
+    __atomic_add_fetch(&interp->obj_count, batch, __ATOMIC_RELAXED);
+    mutator->alloc_budget = batch;
+}
+
+/* Allocate an object whose cell has room for extra bytes after the Obj */
+Obj* alloc_sized(ObjType type, size_t extra) {
+    if (mutator->alloc_budget == 0 ||
+        __atomic_load_n(&interp->vector_bytes, __ATOMIC_RELAXED) >= interp->vector_threshold) {
+        reserve_allocs();
+    }
+    mutator->alloc_budget--;
+    SizeClass* sc = &size_classes[(extra + CELL_ALIGN - 1) / CELL_ALIGN];
+    Obj* obj = alloc_cell(sc);
     obj->type = type;
-    all_objs[obj_count++] = obj;
+    obj->marked = 0;
+    obj->remembered = 0;
+    obj->shared = 0;
+    counters->alloc_total++;
+    counters->alloc_by_type[type]++;
+    counters->bytes_in_use += sc->cell_size;
     return obj;
 }
 
+/* Allocate a new object */
+Obj* alloc_obj(ObjType type) {
+    return alloc_sized(type, 0);
+}
+
 /* Create integer */
 Obj* make_int(int num) {
-    Obj* obj = alloc_obj(T_INT);
-    obj->num = num;
-    return obj;
+    return (Obj*)((intptr_t)num * 2 + 1);
 }
 
-/* Create symbol */
-Obj* make_symbol(const char* name) {
-    Obj* obj = alloc_obj(T_SYMBOL);
-    obj->sym = strdup(name);
+/* Bignums
+ *
+ * Integer arithmetic stays on fixnums until a result no longer fits a C
+ * int: the built-ins check each step with __builtin_*_overflow and only
+ * then switch to these routines.  A T_BIG holds a sign and a magnitude
+ * of 32-bit limbs, least significant first.  Results are normalized, so
+ * a value that fits a fixnum is always a fixnum and a T_BIG never is
+ * one, which keeps eq on small integers a pointer comparison.  Small
+ * magnitudes live in the cell; larger ones are malloc'd and counted
+ * with the vector storage, so building big numbers triggers collections.
+ * Multiplication switches from the schoolbook method to Karatsuba once
+ * both operands have KARATSUBA_THRESHOLD limbs.
+ */
+#define KARATSUBA_THRESHOLD 32
+
+/* Bignum with room for size limbs, all zero */
+Obj* make_big(int size) {
+    Obj* obj;
+    if (size <= MAX_INLINE_LIMBS) {
+        obj = alloc_sized(T_BIG, size * sizeof(uint32_t));
+        obj->big.limbs = (uint32_t*)(obj + 1);
+    } else {
+        obj = alloc_obj(T_BIG);
+        obj->big.limbs = (uint32_t*)malloc(size * sizeof(uint32_t));
+        if (!obj->big.limbs) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        __atomic_add_fetch(&interp->vector_bytes, size * sizeof(uint32_t), __ATOMIC_RELAXED);
+    }
+    obj->big.negative = 0;
+    obj->big.len = size;
+    obj->big.size = size;
+    memset(obj->big.limbs, 0, size * sizeof(uint32_t));
     return obj;
 }
 
-/* Create cons cell */
-Obj* cons(Obj* car, Obj* cdr) {
-    Obj* obj = alloc_obj(T_CONS);
-    obj->cons.car = car;
-    obj->cons.cdr = cdr;
+/* Drop leading zero limbs and turn the result into a fixnum if it fits */
+Obj* big_normalize(Obj* obj) {
+    int len = obj->big.len;
+    while (len > 0 && obj->big.limbs[len - 1] == 0) len--;
+    obj->big.len = len;
+    if (len == 0) return make_int(0);
+    if (len == 1) {
+        uint32_t m = obj->big.limbs[0];
+        if (!obj->big.negative && m <= (uint32_t)INT_MAX) return make_int((int)m);
+        if (obj->big.negative && m <= (uint32_t)INT_MAX + 1) {
+            return make_int((int)(0u - m));
+        }
+    }
     return obj;
 }
 
-/* Create built-in function */
-Obj* make_func(BuiltinFunc func) {
-    Obj* obj = alloc_obj(T_FUNC);
-    obj->func = func;
-    return obj;
+/* Integer for a 64-bit value, fixnum or bignum */
+Obj* make_integer(long long value) {
+    if (value >= INT_MIN && value <= INT_MAX) return make_int((int)value);
+    unsigned long long m = value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+    Obj* obj = make_big(2);
+    obj->big.negative = value < 0;
+    obj->big.limbs[0] = (uint32_t)m;
+    obj->big.limbs[1] = (uint32_t)(m >> 32);
+    return big_normalize(obj);
 }
 
-/* Create lambda */
-Obj* make_lambda(Obj* params, Obj* body, Obj* env) {
-    Obj* obj = alloc_obj(T_LAMBDA);
-    obj->lambda.params = params;
-    obj->lambda.body = body;
-    obj->lambda.env = env;
-    return obj;
+int is_integer(Obj* obj) {
+    return IS_INT(obj) || obj->type == T_BIG;
 }
 
-/* Check if object is nil */
-int is_nil(Obj* obj) {
-    return obj == nil_obj;
+/* Sign and magnitude of a fixnum or bignum, so the routines below can
+ * treat both alike.  A fixnum's magnitude is kept in small. */
+typedef struct {
+    int negative;
+    int len;
+    const uint32_t* limbs;
+    uint32_t small;
+} BigView;
+
+void big_view(Obj* obj, BigView* v) {
+    if (IS_INT(obj)) {
+        int n = (int)INT_VAL(obj);
+        v->negative = n < 0;
+        v->small = n < 0 ? 0u - (uint32_t)n : (uint32_t)n;
+        v->len = n != 0;
+        v->limbs = &v->small;
+    } else {
+        v->negative = obj->big.negative;
+        v->len = obj->big.len;
+        v->limbs = obj->big.limbs;
+    }
 }
 
-/* List operations */
-Obj* car(Obj* obj) {
-    if (obj->type != T_CONS) {
-        fprintf(stderr, "CAR: not a cons cell\n");
-        return nil_obj;
+/* Compare magnitudes; either may have leading zero limbs */
+int mag_cmp(const uint32_t* a, int an, const uint32_t* b, int bn) {
+    while (an > 0 && a[an - 1] == 0) an--;
+    while (bn > 0 && b[bn - 1] == 0) bn--;
+    if (an != bn) return an < bn ? -1 : 1;
+    for (int i = an - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
     }
-    return obj->cons.car;
+    return 0;
 }
 
-Obj* cdr(Obj* obj) {
-    if (obj->type != T_CONS) {
-        fprintf(stderr, "CDR: not a cons cell\n");
-        return nil_obj;
+/* r[0..rn) += a[0..an), with an <= rn; the sum must fit in rn limbs */
+void mag_add_into(uint32_t* r, int rn, const uint32_t* a, int an) {
+    uint64_t carry = 0;
+    int i = 0;
+    for (; i < an; i++) {
+        carry += (uint64_t)r[i] + a[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    for (; carry && i < rn; i++) {
+        carry += r[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
     }
-    return obj->cons.cdr;
 }
 
-/* Print object */
-void print_obj(Obj* obj) {
-    if (!obj) {
-        printf("NULL");
+/* r[0..rn) -= a[0..an), with an <= rn; r must not be smaller than a */
+void mag_sub_into(uint32_t* r, int rn, const uint32_t* a, int an) {
+    int64_t borrow = 0;
+    int i = 0;
+    for (; i < an; i++) {
+        borrow += (int64_t)r[i] - a[i];
+        r[i] = (uint32_t)borrow;
+        borrow >>= 32;
+    }
+    for (; borrow && i < rn; i++) {
+        borrow += r[i];
+        r[i] = (uint32_t)borrow;
+        borrow >>= 32;
+    }
+}
+
+/* r[0..an+bn) = a * b.  r must not overlap either operand. */
+void mag_mul(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn) {
+    if (an < bn) {
+        const uint32_t* t = a;
+        a = b;
+        b = t;
+        int n = an;
+        an = bn;
+        bn = n;
+    }
+    memset(r, 0, (size_t)(an + bn) * sizeof(uint32_t));
+    if (bn == 0) return;
+
+    if (bn < KARATSUBA_THRESHOLD) {
+        for (int i = 0; i < bn; i++) {
+            uint64_t carry = 0;
+            for (int j = 0; j < an; j++) {
+                carry += (uint64_t)a[j] * b[i] + r[i + j];
+                r[i + j] = (uint32_t)carry;
+                carry >>= 32;
+            }
+            r[i + an] = (uint32_t)carry;
+        }
+        return;
+    }
+
+    uint32_t* t;
+    if (an >= 2 * bn) {
+        /* Unbalanced: multiply b by one bn-limb slice of a at a time */
+        t = (uint32_t*)malloc((size_t)2 * bn * sizeof(uint32_t));
+        if (!t) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        for (int i = 0; i < an; i += bn) {
+            int n = an - i < bn ? an - i : bn;
+            mag_mul(t, a + i, n, b, bn);
+            mag_add_into(r + i, an + bn - i, t, n + bn);
+        }
+        free(t);
         return;
     }
+
+    /* Karatsuba: with a = a1 B^m + a0 and b = b1 B^m + b0, the middle
+     * term a0 b1 + a1 b0 is (a0 + a1)(b0 + b1) - a0 b0 - a1 b1, so three
+     * half-size products do the work of four.  bn > an / 2 >= m here, so
+     * b1 is never empty. */
+    int m = an / 2;
+    int sn = an - m + 1;        /* Limbs for a0 + a1 (and for b0 + b1) */
+    t = (uint32_t*)malloc((size_t)4 * sn * sizeof(uint32_t));
+    if (!t) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    uint32_t* sa = t;
+    uint32_t* sb = t + sn;
+    uint32_t* mid = t + 2 * sn;
+    memset(sa, 0, (size_t)2 * sn * sizeof(uint32_t));
+    memcpy(sa, a, (size_t)m * sizeof(uint32_t));
+    mag_add_into(sa, sn, a + m, an - m);
+    memcpy(sb, b, (size_t)m * sizeof(uint32_t));
+    mag_add_into(sb, sn, b + m, bn - m);
+
+    mag_mul(r, a, m, b, m);
+    mag_mul(r + 2 * m, a + m, an - m, b + m, bn - m);
+    mag_mul(mid, sa, sn, sb, sn);
+    mag_sub_into(mid, 2 * sn, r, 2 * m);
+    mag_sub_into(mid, 2 * sn, r + 2 * m, an + bn - 2 * m);
+    int midn = 2 * sn;
+    while (midn > 0 && mid[midn - 1] == 0) midn--;
+    mag_add_into(r + m, an + bn - m, mid, midn);
+    free(t);
+}
+
+/* q = a / b and the remainder in rem (either may be NULL), by Knuth's
+ * algorithm D.  b must be normalized (its top limb nonzero) and a no
+ * shorter than b; q needs an - bn + 1 limbs and rem bn limbs. */
+void mag_divmod(uint32_t* q, uint32_t* rem, const uint32_t* a, int an,
+                const uint32_t* b, int bn) {
+    if (bn == 1) {
+        uint64_t r = 0;
+        for (int i = an - 1; i >= 0; i--) {
+            uint64_t cur = (r << 32) | a[i];
+            if (q) q[i] = (uint32_t)(cur / b[0]);
+            r = cur % b[0];
+        }
+        if (rem) rem[0] = (uint32_t)r;
+        return;
+    }
+
+    /* Shift both so the divisor's top bit is set, which keeps each
+     * quotient digit estimate at most two too large */
+    int s = __builtin_clz(b[bn - 1]);
+    uint32_t* un = (uint32_t*)malloc((size_t)(an + 1 + bn) * sizeof(uint32_t));
+    if (!un) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    uint32_t* vn = un + an + 1;
+    for (int i = bn - 1; i > 0; i--) {
+        vn[i] = (b[i] << s) | (s ? (uint32_t)((uint64_t)b[i - 1] >> (32 - s)) : 0);
+    }
+    vn[0] = b[0] << s;
+    un[an] = s ? (uint32_t)((uint64_t)a[an - 1] >> (32 - s)) : 0;
+    for (int i = an - 1; i > 0; i--) {
+        un[i] = (a[i] << s) | (s ? (uint32_t)((uint64_t)a[i - 1] >> (32 - s)) : 0);
+    }
+    un[0] = a[0] << s;
+
+    for (int j = an - bn; j >= 0; j--) {
+        uint64_t top = ((uint64_t)un[j + bn] << 32) | un[j + bn - 1];
+        uint64_t qhat = top / vn[bn - 1];
+        uint64_t rhat = top % vn[bn - 1];
+        while (qhat >> 32 || qhat * vn[bn - 2] > ((rhat << 32) | un[j + bn - 2])) {
+            qhat--;
+            rhat += vn[bn - 1];
+            if (rhat >> 32) break;
+        }
+
+        /* un[j..j+bn] -= qhat * vn */
+        int64_t borrow = 0;
+        uint64_t carry = 0;
+        for (int i = 0; i < bn; i++) {
+            uint64_t p = qhat * vn[i] + carry;
+            carry = p >> 32;
+            int64_t t = (int64_t)un[i + j] - (int64_t)(uint32_t)p + borrow;
+            un[i + j] = (uint32_t)t;
+            borrow = t >> 32;
+        }
+        int64_t t = (int64_t)un[j + bn] - (int64_t)carry + borrow;
+        un[j + bn] = (uint32_t)t;
+
+        /* The estimate was one too large: add the divisor back */
+        if (t < 0) {
+            qhat--;
+            uint64_t c = 0;
+            for (int i = 0; i < bn; i++) {
+                c += (uint64_t)un[i + j] + vn[i];
+                un[i + j] = (uint32_t)c;
+                c >>= 32;
+            }
+            un[j + bn] += (uint32_t)c;
+        }
+        if (q) q[j] = (uint32_t)qhat;
+    }
+
+    if (rem) {
+        for (int i = 0; i < bn; i++) {
+            rem[i] = (un[i] >> s) | (s ? (uint32_t)((uint64_t)un[i + 1] << (32 - s)) : 0);
+        }
+    }
+    free(un);
+}
+
+/* x + y, or x - y if subtract.  Both must be integers. */
+Obj* big_add(Obj* x, Obj* y, int subtract) {
+    PROTECT(x);
+    PROTECT(y);
+    BigView a, b;
+    big_view(x, &a);
+    big_view(y, &b);
+    int b_negative = b.negative ^ subtract;
+    Obj* r;
+    if (a.negative == b_negative) {
+        int n = (a.len > b.len ? a.len : b.len) + 1;
+        r = make_big(n);
+        memcpy(r->big.limbs, a.limbs, (size_t)a.len * sizeof(uint32_t));
+        mag_add_into(r->big.limbs, n, b.limbs, b.len);
+        r->big.negative = a.negative;
+    } else {
+        /* Opposite signs: subtract the smaller magnitude from the larger */
+        int swap = mag_cmp(a.limbs, a.len, b.limbs, b.len) < 0;
+        int n = swap ? b.len : a.len;
+        r = make_big(n);
+        big_view(x, &a);
+        big_view(y, &b);
+        BigView* big = swap ? &b : &a;
+        BigView* small = swap ? &a : &b;
+        memcpy(r->big.limbs, big->limbs, (size_t)n * sizeof(uint32_t));
+        mag_sub_into(r->big.limbs, n, small->limbs, small->len);
+        r->big.negative = swap ? b_negative : a.negative;
+    }
+    UNPROTECT(2);
+    return big_normalize(r);
+}
+
+Obj* big_mul(Obj* x, Obj* y) {
+    PROTECT(x);
+    PROTECT(y);
+    BigView a, b;
+    big_view(x, &a);
+    big_view(y, &b);
+    Obj* r = make_big(a.len + b.len);
+    mag_mul(r->big.limbs, a.limbs, a.len, b.limbs, b.len);
+    r->big.negative = a.negative != b.negative;
+    UNPROTECT(2);
+    return big_normalize(r);
+}
+
+/* x / y truncated toward zero, or NULL if y is zero */
+Obj* big_div(Obj* x, Obj* y) {
+    BigView a, b;
+    big_view(x, &a);
+    big_view(y, &b);
+    if (b.len == 0) return NULL;
+    if (mag_cmp(a.limbs, a.len, b.limbs, b.len) < 0) return make_int(0);
+    PROTECT(x);
+    PROTECT(y);
+    Obj* q = make_big(a.len - b.len + 1);
+    mag_divmod(q->big.limbs, NULL, a.limbs, a.len, b.limbs, b.len);
+    q->big.negative = a.negative != b.negative;
+    UNPROTECT(2);
+    return big_normalize(q);
+}
+
+/* Compare two integers: negative, zero or positive */
+int big_cmp(Obj* x, Obj* y) {
+    BigView a, b;
+    big_view(x, &a);
+    big_view(y, &b);
+    if (a.negative != b.negative) return a.negative ? -1 : 1;
+    int c = mag_cmp(a.limbs, a.len, b.limbs, b.len);
+    return a.negative ? -c : c;
+}
+
+/* Two bignums with the same value (normalized fixnums never equal one) */
+int big_equal(Obj* a, Obj* b) {
+    return TYPE(a) == T_BIG && TYPE(b) == T_BIG && big_cmp(a, b) == 0;
+}
+
+/* Decimal digits of a bignum as a malloc'd string, nine digits per
+ * division by 10^9 */
+char* big_to_string(Obj* obj) {
+    int len = obj->big.len;
+    uint32_t* mag = (uint32_t*)malloc((size_t)len * sizeof(uint32_t));
+    /* 9.64 digits per limb, plus sign and NUL */
+    char* out = (char*)malloc((size_t)len * 10 + 3);
+    if (!mag || !out) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    memcpy(mag, obj->big.limbs, (size_t)len * sizeof(uint32_t));
+
+    /* Nine-digit chunks come out least significant first */
+    char* p = out + len * 10 + 2;
+    *p = '\0';
+    while (len > 0) {
+        uint64_t r = 0;
+        for (int i = len - 1; i >= 0; i--) {
+            uint64_t cur = (r << 32) | mag[i];
+            mag[i] = (uint32_t)(cur / 1000000000u);
+            r = cur % 1000000000u;
+        }
+        while (len > 0 && mag[len - 1] == 0) len--;
+        for (int i = 0; i < 9 && (len > 0 || r > 0); i++) {
+            *--p = (char)('0' + r % 10);
+            r /= 10;
+        }
+    }
+    if (obj->big.negative) *--p = '-';
+    memmove(out, p, strlen(p) + 1);
+    free(mag);
+    return out;
+}
+
+/* Integer for a decimal literal too long to be sure it fits a fixnum:
+ * the digits are folded in with one multiply-add pass each */
+Obj* big_from_digits(const char* digits, size_t count, int negative) {
+    /* Each digit adds under 3.33 bits */
+    Obj* obj = make_big((int)(count / 9 + 2));
+    uint32_t* limbs = obj->big.limbs;
+    int len = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t carry = (uint64_t)(digits[i] - '0');
+        for (int j = 0; j < len; j++) {
+            carry += (uint64_t)limbs[j] * 10;
+            limbs[j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        if (carry) limbs[len++] = (uint32_t)carry;
+    }
+    obj->big.negative = negative;
+    return big_normalize(obj);
+}
+
+/* FNV-1a hash of a symbol name */
+unsigned int hash_name(const char* name, size_t len) {
+    unsigned int h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Re-insert every symbol into a table twice the size */
+void grow_symbol_table() {
+    size_t old_capacity = interp->symbol_capacity;
+    Obj** old_table = interp->symbol_table;
+    
+    interp->symbol_capacity = old_capacity ? old_capacity * 2 : 256;
+    interp->symbol_table = (Obj**)calloc(interp->symbol_capacity, sizeof(Obj*));
+    if (!interp->symbol_table) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < old_capacity; i++) {
+        Obj* sym = old_table[i];
+        if (!sym) continue;
+        size_t j = sym->hash & (interp->symbol_capacity - 1);
+        while (interp->symbol_table[j]) j = (j + 1) & (interp->symbol_capacity - 1);
+        interp->symbol_table[j] = sym;
+    }
+    free(old_table);
+}
+
+/* Return the interned symbol for the len bytes at name, which need not
+ * be NUL-terminated.  If there is none yet, obj (nil or t, already set
+ * up by init_constants) is entered as that symbol, or a new heap symbol
+ * when obj is NULL. */
+Obj* intern(const char* name, size_t len, Obj* obj) {
+    lock_tables();
+    if (interp->symbol_count * 2 >= interp->symbol_capacity) {
+        grow_symbol_table();
+    }
+    
+    unsigned int hash = hash_name(name, len);
+    size_t mask = interp->symbol_capacity - 1;
+    size_t i = hash & mask;
+    while (interp->symbol_table[i]) {
+        Obj* sym = interp->symbol_table[i];
+        if (sym->hash == hash && strncmp(sym->sym, name, len) == 0 && sym->sym[len] == '\0') {
+            unlock_tables();
+            return sym;
+        }
+        i = (i + 1) & mask;
+    }
+    
+    /* A frozen parent's table never changes, so it is read unlocked */
+    Interp* parent = interp->parent;
+    if (parent) {
+        size_t parent_mask = parent->symbol_capacity - 1;
+        for (size_t j = hash & parent_mask; parent->symbol_table[j]; j = (j + 1) & parent_mask) {
+            Obj* sym = parent->symbol_table[j];
+            if (sym->hash == hash && strncmp(sym->sym, name, len) == 0 && sym->sym[len] == '\0') {
+                unlock_tables();
+                return sym;
+            }
+        }
+    }
+    
+    if (!obj) {
+        char* copy = (char*)malloc(len + 1);
+        if (!copy) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        memcpy(copy, name, len);
+        copy[len] = '\0';
+        
+        obj = alloc_obj(T_SYMBOL);
+        obj->sym = copy;
+        obj->special = SF_NONE;
+        obj->hash = hash;
+    }
+    interp->symbol_table[i] = obj;
+    interp->symbol_count++;
+    unlock_tables();
+    return obj;
+}
+
+/* Create symbol: returns the one interned symbol for a name, so symbols
+ * can be compared by pointer */
+Obj* make_symbol(const char* name) {
+    return intern(name, strlen(name), NULL);
+}
+
+/* A symbol outside the symbol table, distinct from every other symbol,
+ * that takes ownership of the malloc'd name */
+Obj* make_uninterned(char* name) {
+    Obj* sym = alloc_obj(T_SYMBOL);
+    sym->sym = name;
+    sym->special = SF_NONE;
+    sym->hash = hash_name(name, strlen(name));
+    return sym;
+}
+
+/* Intern a symbol and tag it as naming a special form */
+Obj* make_special(const char* name, SpecialForm form) {
+    Obj* sym = make_symbol(name);
+    sym->special = form;
+    return sym;
+}
+
+/* Create cons cell */
+Obj* cons(Obj* car, Obj* cdr) {
+    Obj* obj = alloc_obj(T_CONS);
+    obj->cons.car = car;
+    obj->cons.cdr = cdr;
+    return obj;
+}
+
+/* Create built-in function */
+Obj* make_func(BuiltinFunc func) {
+    Obj* obj = alloc_obj(T_FUNC);
+    obj->func = func;
+    return obj;
+}
+
+/* Create lambda */
+Obj* make_lambda(Obj* params, Obj* body, Obj* env) {
+    Obj* obj = alloc_obj(T_LAMBDA);
+    obj->lambda.params = params;
+    obj->lambda.body = body;
+    obj->lambda.env = env;
+    return obj;
+}
+
+/* Create vector of len elements, all nil or, for a numeric vector, 0.
+ * Numeric vectors hold raw integers, so their elements sit contiguously
+ * with no tags and the collector never scans them. */
+Obj* make_vector(int len, int numeric) {
+    Obj* vec;
+    if (len <= MAX_INLINE_SLOTS) {
+        /* Room for pointers either way, so it can be generalized in place */
+        vec = alloc_sized(T_VECTOR, len * sizeof(Obj*));
+        vec->vector.items = (Obj**)(vec + 1);
+    } else {
+        vec = alloc_obj(T_VECTOR);
+        vec->vector.items = (Obj**)malloc(len * (numeric ? sizeof(int) : sizeof(Obj*)));
+        if (!vec->vector.items) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    vec->vector.numeric = numeric;
+    vec->vector.len = len;
+    if (len > MAX_INLINE_SLOTS) {
+        __atomic_add_fetch(&interp->vector_bytes, vector_storage(vec), __ATOMIC_RELAXED);
+    }
+    for (int i = 0; i < len; i++) {
+        if (numeric) {
+            vec->vector.nums[i] = 0;
+        } else {
+            vec->vector.items[i] = nil_obj;
+        }
+    }
+    return vec;
+}
+
+/* Element i of a vector */
+Obj* vector_ref(Obj* vec, int i) {
+    if (vec->vector.numeric) return make_int(vec->vector.nums[i]);
+    return vec->vector.items[i];
+}
+
+/* Turn a numeric vector into a general one in place, so it can hold
+ * values other than integers */
+void vector_generalize(Obj* vec) {
+    if (!vec->vector.numeric) return;
+    if (vec->vector.len > MAX_INLINE_SLOTS) {
+        vec->vector.items = (Obj**)realloc(vec->vector.items, vec->vector.len * sizeof(Obj*));
+        if (!vec->vector.items) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        __atomic_add_fetch(&interp->vector_bytes, vec->vector.len * (sizeof(Obj*) - sizeof(int)),
+                           __ATOMIC_RELAXED);
+    }
+    /* Widen from the end, so no integer is overwritten before it is read */
+    for (int i = vec->vector.len - 1; i >= 0; i--) {
+        vec->vector.items[i] = make_int(vec->vector.nums[i]);
+    }
+    vec->vector.numeric = 0;
+    WRITE_BARRIER(vec);
+}
+
+/* Check if object is nil */
+int is_nil(Obj* obj) {
+    return obj == nil_obj;
+}
+
+/* List operations */
+Obj* car(Obj* obj) {
+    if (TYPE(obj) != T_CONS) {
+        fprintf(stderr, "CAR: not a cons cell\n");
+        return nil_obj;
+    }
+    return obj->cons.car;
+}
+
+Obj* cdr(Obj* obj) {
+    if (TYPE(obj) != T_CONS) {
+        fprintf(stderr, "CDR: not a cons cell\n");
+        return nil_obj;
+    }
+    return obj->cons.cdr;
+}
+
+/* Printer
+ *
+ * Objects are rendered into a buffer and written out with one fwrite,
+ * so printing a long list costs a few large writes instead of a stdio
+ * call per atom.  Lists and vectors are walked with an explicit stack of
+ * the ones still open, so printing deeply nested data uses a fixed
+ * amount of C stack.
+ */
+typedef enum {
+    PRINT_OBJ,                  /* Print obj */
+    PRINT_LIST,                 /* The rest of a list, obj, then its ) */
+    PRINT_VECTOR,               /* Elements of vector obj from index on, then ) */
+    PRINT_CLOSE                 /* The ) after the final cdr of a dotted list */
+} PrintStep;
+
+typedef struct {
+    PrintStep step;
+    int index;
+    Obj* obj;
+} PrintTask;
+
+#define PRINT_STACK 64                  /* Open lists before the stack is malloc'd */
+#define PRINT_BUFFER_KEEP (1 << 20)     /* Largest print buffer kept between prints */
+
+void buffer_int(Buffer* b, long long value) {
+    char digits[24];
+    char* p = digits + sizeof(digits);
+    unsigned long long n = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+    do {
+        *--p = (char)('0' + n % 10);
+        n /= 10;
+    } while (n);
+    if (value < 0) *--p = '-';
+    buffer_append(b, p, digits + sizeof(digits) - p);
+}
+
+void buffer_str(Buffer* b, const char* text) {
+    buffer_append(b, text, strlen(text));
+}
+
+/* Print an object that has no elements */
+void print_atom(Buffer* b, Obj* obj) {
+    if (!obj) {
+        buffer_str(b, "NULL");
+        return;
+    }
+    switch (TYPE(obj)) {
+        case T_INT:
+            buffer_int(b, INT_VAL(obj));
+            break;
+        case T_SYMBOL:
+            buffer_str(b, obj->sym);
+            break;
+        case T_FUNC:
+            buffer_str(b, "<built-in function>");
+            break;
+        case T_LAMBDA:
+            buffer_str(b, "<lambda>");
+            break;
+        case T_FRAME:
+            buffer_str(b, "<frame>");
+            break;
+        case T_LOCAL:
+            buffer_str(b, obj->local.name->sym);
+            break;
+        case T_GLOBAL:
+            buffer_str(b, obj->cell->cons.car->sym);
+            break;
+        case T_CODE:
+            buffer_str(b, "<code>");
+            break;
+        case T_MEMO:
+            buffer_str(b, "<memoized function>");
+            break;
+        case T_MACRO:
+            buffer_str(b, "<macro>");
+            break;
+        case T_HASH:
+            buffer_str(b, "<hash table, count ");
+            buffer_int(b, obj->htab.count);
+            buffer_str(b, ">");
+            break;
+        case T_FUTURE:
+            buffer_str(b, "<future>");
+            break;
+        case T_BIG: {
+            char* digits = big_to_string(obj);
+            buffer_str(b, digits);
+            free(digits);
+            break;
+        }
+        case T_FREE:
+            buffer_str(b, "<free>");
+            break;
+        case T_CONS:
+        case T_VECTOR:
+            break;
+    }
+}
+
+void push_print(PrintTask** stack, size_t* count, PrintStep step, int index, Obj* obj) {
+    PrintTask* task = &(*stack)[(*count)++];
+    task->step = step;
+    task->index = index;
+    task->obj = obj;
+}
+
+/* Append the printed form of obj to b */
+void print_to_buffer(Buffer* b, Obj* obj) {
+    PrintTask local[PRINT_STACK];
+    PrintTask* stack = local;
+    size_t count = 0;
+    size_t capacity = PRINT_STACK;
+    push_print(&stack, &count, PRINT_OBJ, 0, obj);
+    
+    while (count > 0) {
+        /* Room for the two tasks a step can push */
+        if (count + 2 > capacity) {
+            capacity *= 2;
+            PrintTask* grown = (PrintTask*)malloc(capacity * sizeof(PrintTask));
+            if (!grown) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            memcpy(grown, stack, count * sizeof(PrintTask));
+            if (stack != local) free(stack);
+            stack = grown;
+        }
+        
+        PrintTask task = stack[--count];
+        obj = task.obj;
+        switch (task.step) {
+            case PRINT_OBJ:
+                if (obj && TYPE(obj) == T_CONS) {
+                    buffer_str(b, "(");
+                    push_print(&stack, &count, PRINT_LIST, 0, cdr(obj));
+                    push_print(&stack, &count, PRINT_OBJ, 0, car(obj));
+                } else if (obj && TYPE(obj) == T_VECTOR) {
+                    buffer_str(b, "#(");
+                    push_print(&stack, &count, PRINT_VECTOR, 0, obj);
+                } else {
+                    print_atom(b, obj);
+                }
+                break;
+            case PRINT_LIST:
+                if (is_nil(obj)) {
+                    buffer_str(b, ")");
+                } else if (TYPE(obj) == T_CONS) {
+                    buffer_str(b, " ");
+                    push_print(&stack, &count, PRINT_LIST, 0, cdr(obj));
+                    push_print(&stack, &count, PRINT_OBJ, 0, car(obj));
+                } else {
+                    buffer_str(b, " . ");
+                    push_print(&stack, &count, PRINT_CLOSE, 0, NULL);
+                    push_print(&stack, &count, PRINT_OBJ, 0, obj);
+                }
+                break;
+            case PRINT_VECTOR:
+                if (task.index == obj->vector.len) {
+                    buffer_str(b, ")");
+                } else {
+                    if (task.index > 0) buffer_str(b, " ");
+                    push_print(&stack, &count, PRINT_VECTOR, task.index + 1, obj);
+                    push_print(&stack, &count, PRINT_OBJ, 0, vector_ref(obj, task.index));
+                }
+                break;
+            case PRINT_CLOSE:
+                buffer_str(b, ")");
+                break;
+        }
+    }
+    
+    if (stack != local) free(stack);
+}
+
+/* Each thread renders into its own buffer, kept between prints */
+__thread Buffer print_buffer = {NULL, 0, 0};
+
+/* Write out what has been rendered into print_buffer, or add it to the
+ * instance's output */
+void print_flush() {
+    if (interp && interp->output) {
+        pthread_mutex_lock(&interp->output_lock);
+        buffer_append(interp->output, print_buffer.data, print_buffer.len);
+        pthread_mutex_unlock(&interp->output_lock);
+    } else {
+        fwrite(print_buffer.data, 1, print_buffer.len, stdout);
+    }
+    print_buffer.len = 0;
+    /* Don't hold on to the buffer of one huge print */
+    if (print_buffer.cap > PRINT_BUFFER_KEEP) {
+        free(print_buffer.data);
+        print_buffer.data = NULL;
+        print_buffer.cap = 0;
+    }
+}
+
+/* Print object */
+void print_obj(Obj* obj) {
+    print_to_buffer(&print_buffer, obj);
+    print_flush();
+}
+
+/* Print each of n objects on a line of its own, with one write */
+void print_lines(Obj** objs, int n) {
+    for (int i = 0; i < n; i++) {
+        print_to_buffer(&print_buffer, objs[i]);
+        buffer_append(&print_buffer, "\n", 1);
+    }
+    print_flush();
+}
+
+/* The printed form of obj as a malloc'd string */
+char* print_to_string(Obj* obj) {
+    Buffer b = {NULL, 0, 0};
+    print_to_buffer(&b, obj);
+    if (!b.data) buffer_append(&b, "", 0);
+    return b.data;
+}
+
+/* Tokenizer.  The input is a length-delimited buffer (possibly a
+ * mapped file), so it need not be NUL-terminated. */
+typedef struct {
+    const char* input;
+    size_t pos;
+    size_t len;
+} Tokenizer;
+
+/* Current character, or 0 at the end of the input */
+int peek(Tokenizer* t) {
+    return t->pos < t->len ? (unsigned char)t->input[t->pos] : 0;
+}
+
+void skip_whitespace(Tokenizer* t) {
+    while (peek(t)) {
+        if (isspace(peek(t))) {
+            t->pos++;
+        } else if (peek(t) == ';') {
+            /* Skip comment until end of line */
+            while (peek(t) && peek(t) != '\n') {
+                t->pos++;
+            }
+        } else {
+            break;
+        }
+    }
+}
+
+/* Token kinds */
+typedef enum {
+    TOK_EOF,
+    TOK_LPAREN,
+    TOK_RPAREN,
+    TOK_QUOTE,  /* ' ` , or ,@ */
+    TOK_VECTOR, /* #( */
+    TOK_ATOM    /* Number or symbol */
+} TokenKind;
+
+/* A token is a view into the tokenizer input, never a copy */
+typedef struct {
+    TokenKind kind;
+    const char* start;
+    size_t len;
+} Token;
+
+Token read_token(Tokenizer* t) {
+    skip_whitespace(t);
+    
+    Token tok = {TOK_EOF, &t->input[t->pos], 0};
+    switch (peek(t)) {
+        case 0:    return tok;
+        case '(':  tok.kind = TOK_LPAREN; break;
+        case ')':  tok.kind = TOK_RPAREN; break;
+        case '\'':
+        case '`':  tok.kind = TOK_QUOTE; break;
+        case ',':
+            tok.kind = TOK_QUOTE;
+            if (t->pos + 1 < t->len && t->input[t->pos + 1] == '@') {
+                t->pos += 2;
+                tok.len = 2;
+                return tok;
+            }
+            break;
+        case '#':
+            /* #( opens a vector; any other # is part of a symbol */
+            if (t->pos + 1 < t->len && t->input[t->pos + 1] == '(') {
+                tok.kind = TOK_VECTOR;
+                t->pos += 2;
+                tok.len = 2;
+                return tok;
+            }
+            /* fall through */
+        default:
+            tok.kind = TOK_ATOM;
+            while (peek(t) && !isspace(peek(t)) && 
+                   peek(t) != '(' && peek(t) != ')') {
+                t->pos++;
+            }
+            tok.len = &t->input[t->pos] - tok.start;
+            return tok;
+    }
+    t->pos++;
+    tok.len = 1;
+    return tok;
+}
+
+/* Parse an atom token as an integer, returning NULL if it is not one */
+Obj* parse_number(Token tok) {
+    size_t start = (tok.start[0] == '-') ? 1 : 0;
+    if (start == tok.len) return NULL;
+    
+    unsigned int value = 0;
+    for (size_t i = start; i < tok.len; i++) {
+        if (!isdigit((unsigned char)tok.start[i])) return NULL;
+        value = value * 10 + (unsigned int)(tok.start[i] - '0');
+    }
+    /* Nine digits always fit a fixnum */
+    if (tok.len - start > 9) {
+        return big_from_digits(tok.start + start, tok.len - start, start == 1);
+    }
+    return make_int((int)(start == 1 ? 0u - value : value));
+}
+
+/* Parser.  Iterative: each open list or pending quote is a level on an
+ * explicit stack, whose partial lists are kept on the value stack so
+ * the collector sees them.  Lists grow by appending at a tail pointer,
+ * so parsing is linear in the input and uses constant C stack however
+ * long or deeply nested it is. */
+struct ParseLevel {
+    Obj* quote;                 /* Symbol to wrap the next datum in for ',
+                                 * `, , and ,@; NULL for a list */
+    int vector;                 /* A #( list, made into a vector when closed */
+    Obj* tail;                  /* Last cell of the list so far, or NULL */
+    size_t pos;                 /* Input offset of the (, #( or ' */
+};
+
+/* Vector holding the elements of a list; numeric if they all are integers */
+Obj* list_to_vector(Obj* list) {
+    int len = 0;
+    int numeric = 1;
+    for (Obj* l = list; TYPE(l) == T_CONS; l = cdr(l)) {
+        if (!IS_INT(car(l))) numeric = 0;
+        len++;
+    }
+    
+    PROTECT(list);
+    Obj* vec = make_vector(len, numeric);
+    UNPROTECT(1);
+    for (int i = 0; i < len; i++, list = cdr(list)) {
+        if (numeric) {
+            vec->vector.nums[i] = (int)INT_VAL(car(list));
+        } else {
+            vec->vector.items[i] = car(list);
+        }
+    }
+    return vec;
+}
+
+/* Report a syntax error with the line and column of an input offset */
+void parse_error(Tokenizer* t, const char* msg, size_t pos) {
+    int line = 1, column = 1;
+    for (size_t i = 0; i < pos; i++) {
+        if (t->input[i] == '\n') {
+            line++;
+            column = 1;
+        } else {
+            column++;
+        }
+    }
+    fprintf(stderr, "%s at line %d, column %d\n", msg, line, column);
+}
+
+/* Parse the next datum, or return NULL at the end of the input */
+Obj* parse_expr(Tokenizer* t) {
+    size_t base = value_sp;
+    size_t depth = 0;
+    Obj* datum = nil_obj;
+    PROTECT(datum);
+    
+    while (1) {
+        Token tok = read_token(t);
+        size_t pos = tok.start - t->input;
+        
+        if (tok.kind == TOK_EOF) {
+            if (depth > 0) {
+                parse_error(t, interp->parse_levels[depth - 1].quote ?
+                            "Unexpected EOF after quote" : "Unexpected EOF in list",
+                            interp->parse_levels[depth - 1].pos);
+            }
+            value_sp = base;
+            UNPROTECT(1);
+            return NULL;
+        }
+        
+        if (tok.kind == TOK_LPAREN || tok.kind == TOK_QUOTE || tok.kind == TOK_VECTOR) {
+            if (depth == interp->parse_capacity) {
+                interp->parse_capacity = interp->parse_capacity ? interp->parse_capacity * 2 : 64;
+                interp->parse_levels = (ParseLevel*)realloc(interp->parse_levels, interp->parse_capacity * sizeof(ParseLevel));
+                if (!interp->parse_levels) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+            }
+            ParseLevel* level = &interp->parse_levels[depth++];
+            level->quote = NULL;
+            if (tok.kind == TOK_QUOTE) {
+                switch (tok.start[0]) {
+                    case '\'': level->quote = interp->sym_quote; break;
+                    case '`': level->quote = interp->sym_quasiquote; break;
+                    default:
+                        level->quote = tok.len == 2 ? interp->sym_unquote_splicing : interp->sym_unquote;
+                        break;
+                }
+            }
+            level->vector = tok.kind == TOK_VECTOR;
+            level->tail = NULL;
+            level->pos = pos;
+            reserve_values(1);
+            value_stack[value_sp++] = nil_obj;
+            continue;
+        }
+        
+        if (tok.kind == TOK_RPAREN) {
+            while (depth > 0 && interp->parse_levels[depth - 1].quote) {
+                parse_error(t, "Missing datum after quote", interp->parse_levels[depth - 1].pos);
+                value_sp--;
+                depth--;
+            }
+            if (depth == 0) {
+                parse_error(t, "Unexpected ')'", pos);
+                continue;
+            }
+            datum = value_stack[value_sp - 1];
+            if (interp->parse_levels[depth - 1].vector) datum = list_to_vector(datum);
+            value_sp--;
+            depth--;
+        } else {
+            datum = parse_number(tok);
+            if (!datum) datum = intern(tok.start, tok.len, NULL);
+        }
+        
+        /* Hand the finished datum to the enclosing levels */
+        while (depth > 0 && interp->parse_levels[depth - 1].quote) {
+            datum = cons(datum, nil_obj);
+            datum = cons(interp->parse_levels[depth - 1].quote, datum);
+            value_sp--;
+            depth--;
+        }
+        if (depth == 0) {
+            value_sp = base;
+            UNPROTECT(1);
+            return datum;
+        }
+        
+        ParseLevel* level = &interp->parse_levels[depth - 1];
+        Obj* cell = cons(datum, nil_obj);
+        if (level->tail) {
+            level->tail->cons.cdr = cell;
+            WRITE_BARRIER(level->tail);
+        } else {
+            value_stack[value_sp - 1] = cell;
+        }
+        level->tail = cell;
+    }
+}
+
+/* Environment operations
+ *
+ * Local variables live in frames: each lambda call or let allocates one
+ * frame holding its variables in order, linked to the enclosing frame.
+ * Global bindings are (symbol . value) pairs in global_table.  Code refers
+ * to the pair itself, so a global's value is NULL until defined.
+ */
+Obj* make_frame(int size, Obj* parent) {
+    PROTECT(parent);
+    Obj* frame;
+    if (size <= MAX_INLINE_SLOTS) {
+        frame = alloc_sized(T_FRAME, size * sizeof(Obj*));
+        frame->frame.slots = (Obj**)(frame + 1);
+    } else {
+        frame = alloc_obj(T_FRAME);
+        frame->frame.slots = (Obj**)malloc(size * sizeof(Obj*));
+        if (!frame->frame.slots) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    frame->frame.parent = parent;
+    frame->frame.size = size;
+    for (int i = 0; i < size; i++) {
+        frame->frame.slots[i] = nil_obj;
+    }
+    UNPROTECT(1);
+    return frame;
+}
+
+/* Re-insert every global binding into a table twice the size */
+void grow_global_table() {
+    size_t old_capacity = interp->global_capacity;
+    Obj** old_table = interp->global_table;
+    
+    interp->global_capacity = old_capacity ? old_capacity * 2 : 256;
+    interp->global_table = (Obj**)calloc(interp->global_capacity, sizeof(Obj*));
+    if (!interp->global_table) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < old_capacity; i++) {
+        Obj* pair = old_table[i];
+        if (!pair) continue;
+        size_t j = car(pair)->hash & (interp->global_capacity - 1);
+        while (interp->global_table[j]) j = (j + 1) & (interp->global_capacity - 1);
+        interp->global_table[j] = pair;
+    }
+    free(old_table);
+}
+
+/* Find the global binding for a symbol, creating an unbound one if
+ * needed.  With inherit set, an overlay instance that has no binding of
+ * its own uses its parent's, if that one is bound. */
+Obj* find_global(Obj* sym, int inherit) {
+    lock_tables();
+    if (interp->global_count * 2 >= interp->global_capacity) {
+        grow_global_table();
+    }
+    
+    size_t mask = interp->global_capacity - 1;
+    size_t i = sym->hash & mask;
+    counters->global_lookups++;
+    counters->global_probes++;
+    while (interp->global_table[i]) {
+        if (car(interp->global_table[i]) == sym) {
+            unlock_tables();
+            return interp->global_table[i];
+        }
+        i = (i + 1) & mask;
+        counters->global_probes++;
+    }
+    
+    Interp* parent = interp->parent;
+    if (inherit && parent) {
+        size_t parent_mask = parent->global_capacity - 1;
+        for (size_t j = sym->hash & parent_mask; parent->global_table[j]; j = (j + 1) & parent_mask) {
+            Obj* pair = parent->global_table[j];
+            if (car(pair) == sym) {
+                if (!pair->cons.cdr) break;
+                unlock_tables();
+                return pair;
+            }
+        }
+    }
+    
+    Obj* pair = cons(sym, NULL);
+    interp->global_table[i] = pair;
+    interp->global_count++;
+    unlock_tables();
+    return pair;
+}
+
+Obj* global_cell(Obj* sym) {
+    return find_global(sym, 1);
+}
+
+/* Bind a global, replacing any previous value in place.  This makes
+ * every call site cache stale.  In an overlay instance the new binding
+ * shadows the parent's, which stays as it is. */
+void global_define(Obj* sym, Obj* value) {
+    PROTECT(value);
+    Obj* cell = find_global(sym, 0);
+    lock_tables();
+    cell->cons.cdr = value;
+    WRITE_BARRIER(cell);
+    __atomic_add_fetch(&interp->global_epoch, 1, __ATOMIC_RELEASE);
+    unlock_tables();
+    UNPROTECT(1);
+}
+
+/* Call site caches
+ *
+ * Each global reference in resolved code is its own T_GLOBAL, so the
+ * one in operator position of a call doubles as that call site's inline
+ * cache: it remembers the function last called through it and the
+ * global epoch at the time.  global_define bumps the epoch, so one
+ * redefinition invalidates every cache at once, and a hit costs two
+ * loads and a compare instead of a trip through eval.  Caches are
+ * filled under the table lock, which global_define holds too, so a
+ * cache's function and epoch always belong together.  The cached
+ * function is not traced: while the epoch matches it is the binding's
+ * value, and the binding is.  An overlay instance starts at its
+ * parent's epoch, so the parent's caches that were current stay valid
+ * until the overlay defines something; they are only ever read.
+ */
+Obj* global_callee(Obj* site) {
+    size_t epoch = __atomic_load_n(&interp->global_epoch, __ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&site->cached_epoch, __ATOMIC_ACQUIRE) == epoch) {
+        return __atomic_load_n(&site->cached, __ATOMIC_RELAXED);
+    }
+    
+    counters->call_cache_misses++;
+    if (site->shared) {
+        /* A call site in a frozen parent's code: its binding never
+         * changes, and the site must not be written */
+        Obj* func = site->cell->cons.cdr;
+        if (func) return func;
+        fprintf(stderr, "Undefined symbol: %s\n", car(site->cell)->sym);
+        return nil_obj;
+    }
+    lock_tables();
+    Obj* func = site->cell->cons.cdr;
+    if (func) {
+        __atomic_store_n(&site->cached, func, __ATOMIC_RELAXED);
+        __atomic_store_n(&site->cached_epoch, interp->global_epoch, __ATOMIC_RELEASE);
+    }
+    unlock_tables();
+    if (!func) {
+        fprintf(stderr, "Undefined symbol: %s\n", car(site->cell)->sym);
+        return nil_obj;
+    }
+    return func;
+}
+
+int list_length(Obj* list) {
+    int n = 0;
+    while (!is_nil(list) && TYPE(list) == T_CONS) {
+        n++;
+        list = cdr(list);
+    }
+    return n;
+}
+
+Obj* compile_function(Obj* name, Obj* params, Obj* body);
+Obj* call_function(Obj* func, int argc);
+Obj* builtin_cons(int argc, Obj** argv);
+Obj* builtin_append(int argc, Obj** argv);
+
+/* Macros
+ *
+ * A (defmacro name params body) binds name to a T_MACRO around an
+ * ordinary lambda.  The resolver expands every call to it while it
+ * copies a top-level form, so a macro runs once per place it is used,
+ * when that code is read, and the resolved (and compiled) code only
+ * ever sees the expansion.  A parameter after &rest takes the list of
+ * remaining arguments: (defmacro when (test &rest body) ...).  A local
+ * variable of the same name shadows a macro.
+ */
+Obj* make_macro(Obj* expander, int rest) {
+    PROTECT(expander);
+    Obj* obj = alloc_obj(T_MACRO);
+    obj->macro.expander = expander;
+    obj->macro.rest = rest;
+    UNPROTECT(1);
+    return obj;
+}
+
+/* Lambda lists
+ *
+ * A parameter after &rest takes the list of the remaining arguments, in
+ * defun and lambda as well as defmacro: (defun f (a &rest more) ...).
+ * The body is resolved against the list without the &rest, so the rest
+ * parameter is the last slot of the frame.
+ */
+
+/* Number of slots a lambda list binds; sets *rest if the last of them
+ * is a rest parameter */
+int param_count(Obj* params, int* rest) {
+    int n = 0;
+    *rest = 0;
+    for (; TYPE(params) == T_CONS; params = cdr(params)) {
+        if (car(params) == interp->sym_rest) {
+            *rest = TYPE(cdr(params)) == T_CONS;
+        } else {
+            n++;
+        }
+    }
+    return n;
+}
+
+/* Frame for a call from the argc values on top of the stack.  With a
+ * rest parameter, its slot gets a list of the arguments left over. */
+Obj* bind_frame(int nparams, int rest, Obj* env, int argc) {
+    Obj* frame = make_frame(nparams, env);
+    Obj** argv = &value_stack[value_sp - argc];
+    int fixed = nparams - rest;
+    for (int i = 0; i < argc && i < fixed; i++) {
+        frame->frame.slots[i] = argv[i];
+    }
+    if (rest && argc > fixed) {
+        Obj* list = nil_obj;
+        PROTECT(frame);
+        PROTECT(list);
+        for (int i = argc - 1; i >= fixed; i--) {
+            list = cons(value_stack[value_sp - argc + i], list);
+        }
+        frame->frame.slots[fixed] = list;
+        WRITE_BARRIER(frame);
+        UNPROTECT(2);
+    }
+    return frame;
+}
+
+/* Does a parameter list have an &rest parameter? */
+int rest_params(Obj* params) {
+    for (; TYPE(params) == T_CONS; params = cdr(params)) {
+        if (car(params) == interp->sym_rest) return 1;
+    }
+    return 0;
+}
+
+/* A lambda list's parameters as the frame binds them, without the &rest */
+Obj* bound_params(Obj* params) {
+    if (TYPE(params) != T_CONS) return params;
+    if (car(params) == interp->sym_rest) return cdr(params);
+    PROTECT(params);
+    Obj* rest = bound_params(cdr(params));
+    PROTECT(rest);
+    rest = cons(car(params), rest);
+    UNPROTECT(2);
+    return rest;
+}
+
+/* The macro a form's operator names, or NULL if it names none or is a
+ * local variable in this scope */
+Obj* form_macro(Obj* op, Obj* scope) {
+    if (TYPE(op) != T_SYMBOL || op->special != SF_NONE || op == nil_obj || op == t_obj) return NULL;
+    for (; !is_nil(scope); scope = cdr(scope)) {
+        for (Obj* v = car(scope); !is_nil(v); v = cdr(v)) {
+            if (car(v) == op) return NULL;
+        }
+    }
+    Obj* value = global_cell(op)->cons.cdr;
+    return value && TYPE(value) == T_MACRO ? value : NULL;
+}
+
+/* Run a macro's expander on the unevaluated arguments of a form */
+Obj* macro_expand(Obj* macro, Obj* args) {
+    PROTECT(macro);
+    Obj* expander = macro->macro.expander;
+    int nparams = list_length(expander->lambda.params);
+    size_t base = value_sp;
+    reserve_values(nparams);
+    for (int i = 0; i < nparams; i++) {
+        if (macro->macro.rest && i == nparams - 1) {
+            value_stack[value_sp++] = args;
+        } else {
+            value_stack[value_sp++] = car(args);
+            args = cdr(args);
+        }
+    }
+    Obj* expansion = call_function(expander, nparams);
+    value_sp = base;
+    UNPROTECT(1);
+    return expansion;
+}
+
+/* Quasiquote
+ *
+ * `x reads as (quasiquote x), ,x as (unquote x) and ,@x as
+ * (unquote-splicing x).  The resolver rewrites a quasiquote into the
+ * calls that build it: cons for each cell that holds an unquote, append
+ * for a splice and quote for any part without one, which is shared
+ * rather than copied.  The calls go to the built-in function objects
+ * themselves, so redefining cons or append does not change what a
+ * template builds.  A nested quasiquote is built as a template one
+ * level deeper.  Vector literals are taken as they are.
+ */
+int has_unquote(Obj* x, int depth) {
+    while (TYPE(x) == T_CONS) {
+        Obj* head = car(x);
+        if (head == interp->sym_unquote || head == interp->sym_unquote_splicing) {
+            if (depth == 1) return 1;
+            return has_unquote(cdr(x), depth - 1);
+        }
+        if (head == interp->sym_quasiquote) return has_unquote(cdr(x), depth + 1);
+        if (has_unquote(head, depth)) return 1;
+        x = cdr(x);
+    }
+    return 0;
+}
+
+/* (func a b), with func a built-in */
+Obj* builtin_call2(BuiltinFunc func, Obj* a, Obj* b) {
+    PROTECT(a);
+    PROTECT(b);
+    Obj* form = cons(b, nil_obj);
+    PROTECT(form);
+    form = cons(a, form);
+    Obj* op = make_func(func);
+    PROTECT(op);
+    form = cons(op, form);
+    UNPROTECT(4);
+    return form;
+}
+
+/* (quote x) */
+Obj* quote_form(Obj* x) {
+    PROTECT(x);
+    Obj* form = cons(x, nil_obj);
+    PROTECT(form);
+    form = cons(interp->sym_quote, form);
+    UNPROTECT(2);
+    return form;
+}
+
+Obj* quasi_expand(Obj* x, int depth) {
+    if (!has_unquote(x, depth)) return quote_form(x);
+
+    PROTECT(x);
+    Obj* head = car(x);
+    Obj* a = nil_obj;
+    Obj* b = nil_obj;
+    PROTECT(a);
+    PROTECT(b);
+    if (head == interp->sym_unquote && depth == 1) {
+        a = car(cdr(x));
+    } else if (head == interp->sym_unquote || head == interp->sym_unquote_splicing ||
+               head == interp->sym_quasiquote) {
+        /* (unquote e) inside an inner quasiquote: rebuild it, one level out */
+        a = quasi_expand(cdr(x), head == interp->sym_quasiquote ? depth + 1 : depth - 1);
+        b = quote_form(head);
+        a = builtin_call2(builtin_cons, b, a);
+    } else if (TYPE(head) == T_CONS && car(head) == interp->sym_unquote_splicing && depth == 1) {
+        b = quasi_expand(cdr(x), depth);
+        a = builtin_call2(builtin_append, car(cdr(head)), b);
+    } else {
+        a = quasi_expand(head, depth);
+        b = quasi_expand(cdr(x), depth);
+        a = builtin_call2(builtin_cons, a, b);
+    }
+    UNPROTECT(3);
+    return a;
+}
+
+/* Lexical addressing
+ *
+ * Before a top-level form is evaluated, resolve() copies it, replacing
+ * every variable reference with a T_LOCAL (frame depth, slot index) or a
+ * T_GLOBAL pointing at the global binding.  The scope is a list of
+ * variable lists, innermost first, mirroring the frames eval will build.
+ * Quoted data is left untouched.  With the bytecode engine enabled, the
+ * body of each lambda and defun is compiled here as well.
+ */
+Obj* resolve(Obj* expr, Obj* scope);
+
+Obj* resolve_symbol(Obj* sym, Obj* scope) {
+    if (sym == nil_obj || sym == t_obj) return sym;
+    
+    int depth = 0;
+    for (; !is_nil(scope); scope = cdr(scope), depth++) {
+        int index = 0;
+        for (Obj* v = car(scope); !is_nil(v); v = cdr(v), index++) {
+            if (car(v) == sym) {
+                Obj* ref = alloc_obj(T_LOCAL);
+                ref->local.depth = depth;
+                ref->local.index = index;
+                ref->local.name = sym;
+                return ref;
+            }
+        }
+    }
+    
+    Obj* cell = global_cell(sym);
+    PROTECT(cell);
+    Obj* ref = alloc_obj(T_GLOBAL);
+    ref->cell = cell;
+    ref->cached = NULL;
+    ref->cached_epoch = 0;
+    UNPROTECT(1);
+    return ref;
+}
+
+/* Resolve each element of a list of forms */
+Obj* resolve_list(Obj* list, Obj* scope) {
+    Obj* head = nil_obj;
+    Obj* tail = nil_obj;
+    Obj* val = nil_obj;
+    PROTECT(list);
+    PROTECT(scope);
+    PROTECT(head);
+    PROTECT(val);
+    
+    while (!is_nil(list) && TYPE(list) == T_CONS) {
+        val = resolve(car(list), scope);
+        Obj* cell = cons(val, nil_obj);
+        if (is_nil(head)) {
+            head = cell;
+        } else {
+            tail->cons.cdr = cell;
+            WRITE_BARRIER(tail);
+        }
+        tail = cell;
+        list = cdr(list);
+    }
+    
+    UNPROTECT(4);
+    return head;
+}
+
+/* Resolve a list of (var init) bindings; the inits see the outer scope */
+Obj* resolve_bindings(Obj* bindings, Obj* scope) {
+    Obj* head = nil_obj;
+    Obj* tail = nil_obj;
+    Obj* val = nil_obj;
+    PROTECT(bindings);
+    PROTECT(scope);
+    PROTECT(head);
+    PROTECT(val);
+    
+    for (; !is_nil(bindings); bindings = cdr(bindings)) {
+        Obj* binding = car(bindings);
+        val = resolve(car(cdr(binding)), scope);
+        val = cons(val, nil_obj);
+        val = cons(car(binding), val);
+        Obj* cell = cons(val, nil_obj);
+        if (is_nil(head)) {
+            head = cell;
+        } else {
+            tail->cons.cdr = cell;
+            WRITE_BARRIER(tail);
+        }
+        tail = cell;
+    }
+    
+    UNPROTECT(4);
+    return head;
+}
+
+Obj* resolve(Obj* expr, Obj* scope) {
+    if (!expr) return NULL;
+    if (TYPE(expr) == T_SYMBOL) return resolve_symbol(expr, scope);
+    if (TYPE(expr) != T_CONS) return expr;
+    
+    size_t saved_roots = root_count;
+    PROTECT(expr);
+    PROTECT(scope);
+    
+    Obj* op = car(expr);
+    Obj* args = cdr(expr);
+    Obj* result = nil_obj;
+    PROTECT(result);
+    
+    Obj* macro = form_macro(op, scope);
+    if (macro) {
+        result = macro_expand(macro, args);
+        result = resolve(result, scope);
+    } else if (TYPE(op) == T_SYMBOL && op->special != SF_NONE) {
+        switch (op->special) {
+            case SF_QUOTE:
+                result = expr;
+                break;
+            
+            case SF_QUASIQUOTE:
+                result = quasi_expand(car(args), 1);
+                result = resolve(result, scope);
+                break;
+            
+            case SF_LAMBDA: {
+                /* (lambda params body) */
+                Obj* params = car(args);
+                Obj* flat = bound_params(params);
+                PROTECT(flat);
+                Obj* inner = cons(flat, scope);
+                PROTECT(inner);
+                result = resolve_list(cdr(args), inner);
+                Obj* code = use_vm ? compile_function(nil_obj, params, car(result)) : NULL;
+                if (code) {
+                    PROTECT(code);
+                    result = cons(code, nil_obj);
+                }
+                result = cons(params, result);
+                result = cons(op, result);
+                break;
+            }
+            
+            case SF_DEFUN:
+            case SF_DEFUN_MEMO:
+            case SF_DEFMACRO: {
+                /* (defun name params body): the body only sees its params.
+                 * A macro's expander is called with the rest list as its
+                 * last argument, so it binds the flat list. */
+                Obj* params = car(cdr(args));
+                Obj* flat = bound_params(params);
+                PROTECT(flat);
+                /* An overlay instance redefining one of its parent's
+                 * globals: recursive calls in the body go to the new one */
+                if (interp->parent) find_global(car(args), 0);
+                Obj* inner = cons(flat, nil_obj);
+                PROTECT(inner);
+                result = resolve_list(cdr(cdr(args)), inner);
+                Obj* code = use_vm ? compile_function(car(args), op->special == SF_DEFMACRO ? flat : params,
+                                                     car(result)) : NULL;
+                if (code) {
+                    PROTECT(code);
+                    result = cons(code, nil_obj);
+                }
+                result = cons(params, result);
+                result = cons(car(args), result);
+                result = cons(op, result);
+                break;
+            }
+            
+            case SF_FUTURE: {
+                /* (future expr) runs expr as the body of (lambda () expr) */
+                Obj* thunk = cons(car(args), nil_obj);
+                PROTECT(thunk);
+                thunk = cons(nil_obj, thunk);
+                thunk = cons(interp->sym_lambda, thunk);
+                result = resolve(thunk, scope);
+                result = cons(result, nil_obj);
+                result = cons(op, result);
+                break;
+            }
+            
+            case SF_LET: {
+                /* (let ((var init) ...) body...) */
+                Obj* vars = nil_obj;
+                PROTECT(vars);
+                for (Obj* b = car(args); !is_nil(b); b = cdr(b)) {
+                    vars = cons(car(car(b)), vars);
+                }
+                /* Slots are numbered in binding order */
+                Obj* ordered = nil_obj;
+                PROTECT(ordered);
+                for (Obj* v = vars; !is_nil(v); v = cdr(v)) {
+                    ordered = cons(car(v), ordered);
+                }
+                Obj* inner = cons(ordered, scope);
+                PROTECT(inner);
+                Obj* bindings = resolve_bindings(car(args), scope);
+                PROTECT(bindings);
+                result = resolve_list(cdr(args), inner);
+                result = cons(bindings, result);
+                result = cons(op, result);
+                break;
+            }
+            
+            case SF_COND: {
+                /* Each clause is itself a list of forms */
+                Obj* clauses = nil_obj;
+                Obj* tail = nil_obj;
+                Obj* clause = nil_obj;
+                PROTECT(clauses);
+                PROTECT(clause);
+                for (Obj* c = args; !is_nil(c); c = cdr(c)) {
+                    clause = resolve_list(car(c), scope);
+                    Obj* cell = cons(clause, nil_obj);
+                    if (is_nil(clauses)) {
+                        clauses = cell;
+                    } else {
+                        tail->cons.cdr = cell;
+                        WRITE_BARRIER(tail);
+                    }
+                    tail = cell;
+                }
+                result = cons(op, clauses);
+                break;
+            }
+            
+            default:
+                /* if, progn: every argument is a form */
+                result = resolve_list(args, scope);
+                result = cons(op, result);
+                break;
+        }
+    } else {
+        result = resolve_list(expr, scope);
+    }
+    
+    root_count = saved_roots;
+    return result;
+}
+
+/* Evaluator */
+Obj* eval(Obj* expr, Obj* env);
+
+Obj* eval_form(Obj** expr, Obj** env);
+Obj* vm_apply(Obj* func, Obj* frame);
+Obj* make_memo(Obj* func, size_t limit);
+Obj* memo_call(Obj* memo, int argc);
+Obj* spawn_future(Obj* call);
+
+/* Evaluate all but the last form of a body and return the last form
+ * unevaluated, so the caller can evaluate it in tail position.  An empty
+ * body yields nil. */
+Obj* eval_leading(Obj* body, Obj* env) {
+    if (is_nil(body)) return nil_obj;
+    while (!is_nil(cdr(body))) {
+        eval(car(body), env);
+        body = cdr(body);
+    }
+    return car(body);
+}
+
+/* Evaluate an expression that is not a list form */
+Obj* eval_atom(Obj* expr, Obj* env) {
+    if (!expr) return nil_obj;
+    if (IS_INT(expr)) return expr;
+    
+    /* Variable references, resolved to a frame slot or a global binding */
+    if (expr->type == T_LOCAL) {
+        Obj* frame = env;
+        for (int depth = expr->local.depth; depth > 0; depth--) {
+            frame = frame->frame.parent;
+        }
+        return frame->frame.slots[expr->local.index];
+    }
+    
+    if (expr->type == T_GLOBAL) {
+        Obj* val = expr->cell->cons.cdr;
+        if (!val) {
+            fprintf(stderr, "Undefined symbol: %s\n", car(expr->cell)->sym);
+            return nil_obj;
+        }
+        return val;
+    }
+    
+    /* The symbols left by the resolver (nil and t) are self-evaluating */
+    return expr;
+}
+
+/* Evaluate an expression.  Forms in tail position (the taken branch of
+ * an if or cond, the last form of a progn or let body and the body of an
+ * applied lambda) are evaluated by looping here rather than recursing, so
+ * tail-recursive Lisp code runs in constant C stack. */
+Obj* eval(Obj* expr, Obj* env) {
+    if (!expr || TYPE(expr) != T_CONS) return eval_atom(expr, env);
+    
+    /* Everything eval_form protects is released on each iteration */
+    size_t saved_roots = root_count;
+    size_t prof_base = prof_depth;
+    PROTECT(expr);
+    PROTECT(env);
+    
+    Obj* result;
+    while (1) {
+        if (!expr || TYPE(expr) != T_CONS) {
+            result = eval_atom(expr, env);
+            break;
+        }
+        if (prof_pending) prof_sample();
+        counters->eval_calls++;
+        result = eval_form(&expr, &env);
+        if (result) break;
+        root_count = saved_roots + 2;
+        
+        /* A lambda entered in tail position replaces its caller */
+        if (prof_depth > prof_base + 1) {
+            prof_stack[prof_base] = prof_stack[prof_depth - 1];
+            prof_depth = prof_base + 1;
+        }
+    }
+    
+    root_count = saved_roots;
+    prof_depth = prof_base;
+    return result;
+}
+
+/* Evaluate a list form; called from eval with *expr and *env protected.
+ * Returns the value, or NULL after replacing *expr and *env with a form
+ * in tail position that eval should continue with. */
+Obj* eval_form(Obj** expr, Obj** env) {
+    Obj* op = car(*expr);
+    Obj* args = cdr(*expr);
+    
+    /* Special forms */
+    if (TYPE(op) == T_SYMBOL && op->special != SF_NONE) {
+        switch (op->special) {
+            case SF_QUOTE:
+                return car(args);
+            
+            case SF_IF: {
+                Obj* cond = eval(car(args), *env);
+                if (!is_nil(cond)) {
+                    *expr = car(cdr(args));
+                } else if (!is_nil(cdr(cdr(args)))) {
+                    *expr = car(cdr(cdr(args)));
+                } else {
+                    return nil_obj;
+                }
+                return NULL;
+            }
+            
+            case SF_LAMBDA: {
+                Obj* params = car(args);
+                Obj* body = car(cdr(args));
+                return make_lambda(params, body, *env);
+            }
+            
+            case SF_DEFUN:
+            case SF_DEFUN_MEMO: {
+                Obj* name = car(args);
+                Obj* params = car(cdr(args));
+                Obj* body = car(cdr(cdr(args)));
+                /* Store in global environment; the body only sees globals */
+                Obj* func = make_lambda(params, body, nil_obj);
+                if (op->special == SF_DEFUN_MEMO) {
+                    func = make_memo(func, MEMO_DEFAULT_LIMIT);
+                }
+                global_define(name, func);
+                return name;
+            }
+            
+            case SF_DEFMACRO: {
+                /* (defmacro name params body): the expander takes the
+                 * &rest parameter as its last */
+                Obj* name = car(args);
+                Obj* params = bound_params(car(cdr(args)));
+                PROTECT(params);
+                Obj* body = car(cdr(cdr(args)));
+                Obj* func = make_lambda(params, body, nil_obj);
+                global_define(name, make_macro(func, rest_params(car(cdr(args)))));
+                return name;
+            }
+            
+            case SF_FUTURE: {
+                Obj* call = eval(car(args), *env);
+                PROTECT(call);
+                call = cons(call, nil_obj);
+                return spawn_future(call);
+            }
+            
+            case SF_PROGN:
+                *expr = eval_leading(args, *env);
+                return NULL;
+            
+            case SF_LET: {
+                /* (let ((var init) ...) body...): inits are evaluated in
+                 * the outer environment */
+                Obj* frame = make_frame(list_length(car(args)), *env);
+                PROTECT(frame);
+                int i = 0;
+                for (Obj* b = car(args); !is_nil(b); b = cdr(b)) {
+                    Obj* val = eval(car(cdr(car(b))), *env);
+                    frame->frame.slots[i++] = val;
+                    WRITE_BARRIER(frame);
+                }
+                *expr = eval_leading(cdr(args), frame);
+                *env = frame;
+                return NULL;
+            }
+            
+            case SF_COND:
+                /* (cond (test body...) ...): a clause without a body
+                 * returns the value of its test */
+                for (Obj* c = args; !is_nil(c); c = cdr(c)) {
+                    Obj* clause = car(c);
+                    Obj* test = eval(car(clause), *env);
+                    if (!is_nil(test)) {
+                        if (is_nil(cdr(clause))) return test;
+                        *expr = eval_leading(cdr(clause), *env);
+                        return NULL;
+                    }
+                }
+                return nil_obj;
+            
+            case SF_QUASIQUOTE:
+            case SF_NONE:
+                break;
+        }
+    }
+    
+    /* Function application; a global operator goes through its call site
+     * cache */
+    Obj* func = TYPE(op) == T_GLOBAL ? global_callee(op) : eval(op, *env);
+    PROTECT(func);
+    
+    if (TYPE(func) == T_FUNC || TYPE(func) == T_MEMO) {
+        /* Built-in or memoized function: push the arguments on the value
+         * stack */
+        size_t base = value_sp;
+        for (Obj* a = args; !is_nil(a); a = cdr(a)) {
+            Obj* val = eval(car(a), *env);
+            reserve_values(1);
+            value_stack[value_sp++] = val;
+        }
+        Obj* result;
+        if (TYPE(func) == T_MEMO) {
+            result = memo_call(func, value_sp - base);
+        } else {
+            counters->builtin_calls++;
+            result = func->func(value_sp - base, &value_stack[base]);
+        }
+        value_sp = base;
+        return result;
+    }
+    
+    if (TYPE(func) == T_LAMBDA) {
+        /* User-defined function: evaluate the arguments straight into
+         * the new frame's slots, then continue with the body */
+        int rest;
+        int nparams = param_count(func->lambda.params, &rest);
+        int fixed = nparams - rest;
+        Obj* frame = make_frame(nparams, func->lambda.env);
+        PROTECT(frame);
+        counters->lambda_calls++;
+        
+        int i = 0;
+        Obj* rest_tail = NULL;
+        for (Obj* a = args; !is_nil(a); a = cdr(a), i++) {
+            Obj* val = eval(car(a), *env);
+            if (i < fixed) {
+                frame->frame.slots[i] = val;
+                WRITE_BARRIER(frame);
+            } else if (rest) {
+                /* Append to the rest list, which the frame keeps alive */
+                PROTECT(val);
+                Obj* cell = cons(val, nil_obj);
+                UNPROTECT(1);
+                if (rest_tail) {
+                    rest_tail->cons.cdr = cell;
+                    WRITE_BARRIER(rest_tail);
+                } else {
+                    frame->frame.slots[fixed] = cell;
+                    WRITE_BARRIER(frame);
+                }
+                rest_tail = cell;
+            }
+        }
+        
+        if (TYPE(func->lambda.body) == T_CODE) {
+            return vm_apply(func, frame);
+        }
+        
+        if (profiling) {
+            if (prof_depth == prof_capacity) {
+                prof_capacity = prof_capacity ? prof_capacity * 2 : 256;
+                prof_stack = (Obj**)realloc(prof_stack, prof_capacity * sizeof(Obj*));
+                if (!prof_stack) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+            }
+            prof_stack[prof_depth++] = TYPE(op) == T_GLOBAL ? car(op->cell) : NULL;
+        }
+        
+        *expr = func->lambda.body;
+        *env = frame;
+        return NULL;
+    }
+    
+    fprintf(stderr, "Not a function\n");
+    return nil_obj;
+}
+
+/* Built-in functions */
+Obj* builtin_car(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    return car(argv[0]);
+}
+
+Obj* builtin_cdr(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    return cdr(argv[0]);
+}
+
+Obj* builtin_cons(int argc, Obj** argv) {
+    if (argc < 2) return nil_obj;
+    return cons(argv[0], argv[1]);
+}
+
+/* (append list...): copies every list but the last, which becomes the
+ * tail of the result as it is */
+Obj* builtin_append(int argc, Obj** argv) {
+    if (argc == 0) return nil_obj;
+    Obj* head = argv[argc - 1];
+    Obj* tail = nil_obj;
+    PROTECT(head);
+    for (int i = argc - 2; i >= 0; i--) {
+        /* Copy argv[i] in front of head: build it forwards, then link */
+        Obj* copy = nil_obj;
+        tail = nil_obj;
+        PROTECT(copy);
+        for (Obj* x = argv[i]; TYPE(x) == T_CONS; x = cdr(x)) {
+            Obj* cell = cons(car(x), nil_obj);
+            if (is_nil(copy)) {
+                copy = cell;
+            } else {
+                tail->cons.cdr = cell;
+                WRITE_BARRIER(tail);
+            }
+            tail = cell;
+        }
+        if (!is_nil(copy)) {
+            tail->cons.cdr = head;
+            WRITE_BARRIER(tail);
+            head = copy;
+        }
+        UNPROTECT(1);
+    }
+    UNPROTECT(1);
+    return head;
+}
+
+/* (gensym): a fresh symbol, distinct from every other, for macros to
+ * name the variables they introduce */
+Obj* builtin_gensym(int argc, Obj** argv) {
+    char name[32];
+    int len = snprintf(name, sizeof(name), "g%d",
+                       __atomic_add_fetch(&interp->gensym_count, 1, __ATOMIC_RELAXED));
+    char* copy = (char*)malloc(len + 1);
+    if (!copy) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    memcpy(copy, name, len + 1);
+    return make_uninterned(copy);
+}
+
+/* Arithmetic runs on fixnums while every step fits an int; the first
+ * overflow or bignum argument hands the rest of the arguments to
+ * arith_big, with the result so far in acc.  It returns NULL for an
+ * argument that is not an integer, or a zero divisor. */
+typedef enum { ARITH_ADD, ARITH_SUB, ARITH_MUL, ARITH_DIV } ArithOp;
+
+Obj* arith_big(ArithOp op, Obj* acc, int argc, Obj** argv) {
+    PROTECT(acc);
+    for (int i = 0; i < argc && acc; i++) {
+        if (!is_integer(argv[i])) {
+            acc = NULL;
+            break;
+        }
+        switch (op) {
+            case ARITH_ADD: acc = big_add(acc, argv[i], 0); break;
+            case ARITH_SUB: acc = big_add(acc, argv[i], 1); break;
+            case ARITH_MUL: acc = big_mul(acc, argv[i]); break;
+            case ARITH_DIV: acc = big_div(acc, argv[i]); break;
+        }
+    }
+    UNPROTECT(1);
+    return acc;
+}
+
+Obj* builtin_add(int argc, Obj** argv) {
+    int sum = 0;
+    for (int i = 0; i < argc; i++) {
+        int next;
+        if (!IS_INT(argv[i]) || __builtin_add_overflow(sum, (int)INT_VAL(argv[i]), &next)) {
+            Obj* result = arith_big(ARITH_ADD, make_int(sum), argc - i, argv + i);
+            if (result) return result;
+            fprintf(stderr, "+: expected integer\n");
+            return make_int(0);
+        }
+        sum = next;
+    }
+    return make_int(sum);
+}
+
+Obj* builtin_sub(int argc, Obj** argv) {
+    if (argc < 1) return make_int(0);
+    if (!is_integer(argv[0])) return make_int(0);
+    
+    if (argc == 1) {
+        if (IS_INT(argv[0]) && INT_VAL(argv[0]) != INT_MIN) return make_int(-INT_VAL(argv[0]));
+        return big_add(make_int(0), argv[0], 1);
+    }
+    
+    Obj* result = NULL;
+    if (IS_INT(argv[0])) {
+        int diff = INT_VAL(argv[0]);
+        int i = 1;
+        for (int next; i < argc; i++) {
+            if (!IS_INT(argv[i]) || __builtin_sub_overflow(diff, (int)INT_VAL(argv[i]), &next)) break;
+            diff = next;
+        }
+        if (i == argc) return make_int(diff);
+        result = arith_big(ARITH_SUB, make_int(diff), argc - i, argv + i);
+    } else {
+        result = arith_big(ARITH_SUB, argv[0], argc - 1, argv + 1);
+    }
+    return result ? result : make_int(0);
+}
+
+Obj* builtin_mul(int argc, Obj** argv) {
+    int product = 1;
+    for (int i = 0; i < argc; i++) {
+        int next;
+        if (!IS_INT(argv[i]) || __builtin_mul_overflow(product, (int)INT_VAL(argv[i]), &next)) {
+            Obj* result = arith_big(ARITH_MUL, make_int(product), argc - i, argv + i);
+            return result ? result : make_int(1);
+        }
+        product = next;
+    }
+    return make_int(product);
+}
+
+Obj* builtin_div(int argc, Obj** argv) {
+    if (argc < 1) return make_int(1);
+    if (!is_integer(argv[0])) return make_int(1);
+    
+    Obj* result = NULL;
+    if (IS_INT(argv[0])) {
+        int quotient = INT_VAL(argv[0]);
+        int i = 1;
+        for (; i < argc; i++) {
+            /* INT_MIN / -1 is the one quotient that overflows */
+            if (!IS_INT(argv[i]) || INT_VAL(argv[i]) == 0 ||
+                (quotient == INT_MIN && INT_VAL(argv[i]) == -1)) break;
+            quotient /= INT_VAL(argv[i]);
+        }
+        if (i == argc) return make_int(quotient);
+        result = arith_big(ARITH_DIV, make_int(quotient), argc - i, argv + i);
+    } else {
+        result = arith_big(ARITH_DIV, argv[0], argc - 1, argv + 1);
+    }
+    if (result) return result;
+    fprintf(stderr, "/: division by zero or bad argument\n");
+    return make_int(0);
+}
+
+/* Fixnums are immediates, so equal fixnums are the same pointer; only
+ * bignums need comparing by value */
+Obj* builtin_eq(int argc, Obj** argv) {
+    if (argc < 2) return nil_obj;
+    return (argv[0] == argv[1] || big_equal(argv[0], argv[1])) ? t_obj : nil_obj;
+}
+
+/* Structural equality and hashing
+ *
+ * equal is true of identical objects, equal bignums and cons trees with
+ * equal leaves; sxhash hashes the same way, so equal objects always hash
+ * alike.  Both walk the tree with an explicit stack instead of recursing,
+ * so very long or deeply nested lists keep a bounded C stack, and neither
+ * allocates on the Lisp heap.  The memoization cache keys on them too.
+ */
+#define EQUAL_STACK 64
+
+/* A pair still to compare */
+typedef struct {
+    Obj* a;
+    Obj* b;
+} EqualPair;
+
+int atom_equal(Obj* a, Obj* b) {
+    return a == b || big_equal(a, b);
+}
+
+int obj_equal(Obj* a, Obj* b) {
+    EqualPair local[EQUAL_STACK];
+    EqualPair* stack = local;
+    size_t count = 0;
+    size_t capacity = EQUAL_STACK;
+    int result = 1;
+    
+    while (1) {
+        /* Follow the cdrs, setting aside the cars that are themselves
+         * lists; a long list costs no stack, a deep one one slot a level */
+        while (a != b) {
+            if (TYPE(a) != T_CONS || TYPE(b) != T_CONS) {
+                if (!atom_equal(a, b)) result = 0;
+                break;
+            }
+            Obj* x = car(a);
+            Obj* y = car(b);
+            if (x != y && TYPE(x) == T_CONS && TYPE(y) == T_CONS) {
+                if (count == capacity) {
+                    capacity *= 2;
+                    EqualPair* grown = (EqualPair*)malloc(capacity * sizeof(EqualPair));
+                    if (!grown) {
+                        fprintf(stderr, "Out of memory\n");
+                        exit(1);
+                    }
+                    memcpy(grown, stack, count * sizeof(EqualPair));
+                    if (stack != local) free(stack);
+                    stack = grown;
+                }
+                stack[count].a = x;
+                stack[count].b = y;
+                count++;
+            } else if (!atom_equal(x, y)) {
+                result = 0;
+                break;
+            }
+            a = cdr(a);
+            b = cdr(b);
+        }
+        if (!result || count == 0) break;
+        count--;
+        a = stack[count].a;
+        b = stack[count].b;
+    }
+    
+    if (stack != local) free(stack);
+    return result;
+}
+
+/* Hash of anything that is not a cons: integers and symbols by value,
+ * anything else by identity */
+unsigned int atom_hash(Obj* obj) {
+    if (IS_INT(obj)) return (unsigned int)INT_VAL(obj) * 2654435761u;
+    if (obj->type == T_SYMBOL) return obj->hash;
+    if (obj->type == T_BIG) {
+        unsigned int h = obj->big.negative ? 0x85ebca6bu : 0x9e3779b9u;
+        for (int i = 0; i < obj->big.len; i++) h = (h ^ obj->big.limbs[i]) * 16777619u;
+        return h;
+    }
+    return (unsigned int)((uintptr_t)obj >> 4) * 2654435761u;
+}
+
+/* Hash the first EQUAL_STACK conses of a tree in preorder.  Each cons
+ * visited pushes at most one more node than it pops, so the fixed stack
+ * always has room, and stopping after a fixed number of conses keeps the
+ * hash of a huge structure cheap and still consistent with equal. */
+unsigned int obj_hash(Obj* obj) {
+    Obj* stack[EQUAL_STACK + 1];
+    int count = 0;
+    int budget = EQUAL_STACK;
+    unsigned int h = 0x9e3779b9u;
+    stack[count++] = obj;
+    while (count > 0) {
+        obj = stack[--count];
+        if (TYPE(obj) != T_CONS) {
+            h = (h ^ atom_hash(obj)) * 16777619u;
+        } else if (budget-- > 0) {
+            h = (h ^ 0x27d4eb2du) * 16777619u;
+            stack[count++] = cdr(obj);
+            stack[count++] = car(obj);
+        }
+    }
+    return h;
+}
+
+/* (equal a b) */
+Obj* builtin_equal(int argc, Obj** argv) {
+    if (argc < 2) return nil_obj;
+    return obj_equal(argv[0], argv[1]) ? t_obj : nil_obj;
+}
+
+/* (sxhash x): a non-negative integer, the same for equal objects */
+Obj* builtin_sxhash(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    return make_int((int)(obj_hash(argv[0]) & 0x7fffffff));
+}
+
+Obj* builtin_lt(int argc, Obj** argv) {
+    if (argc < 2) return nil_obj;
+    if (IS_INT(argv[0]) && IS_INT(argv[1])) {
+        return (INT_VAL(argv[0]) < INT_VAL(argv[1])) ? t_obj : nil_obj;
+    }
+    if (!is_integer(argv[0]) || !is_integer(argv[1])) return nil_obj;
+    return big_cmp(argv[0], argv[1]) < 0 ? t_obj : nil_obj;
+}
+
+Obj* builtin_print(int argc, Obj** argv) {
+    print_lines(argv, argc);
+    return nil_obj;
+}
+
+/* (print-to-string x): the text print would write for x.  There is no
+ * string type, so the text comes back as an uninterned symbol, which
+ * prints as exactly that text. */
+Obj* builtin_print_to_string(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    return make_uninterned(print_to_string(argv[0]));
+}
+
+/* Vectors */
+
+/* Check that argv[0] is a vector and argv[1] an index into it */
+int vector_index(const char* name, int argc, Obj** argv, int* index) {
+    if (argc < 2 || TYPE(argv[0]) != T_VECTOR || !IS_INT(argv[1]) ||
+        INT_VAL(argv[1]) < 0 || INT_VAL(argv[1]) >= argv[0]->vector.len) {
+        fprintf(stderr, "%s: expected a vector and an index in range\n", name);
+        return 0;
+    }
+    *index = (int)INT_VAL(argv[1]);
+    return 1;
+}
+
+/* (make-vector n [init]) */
+Obj* builtin_make_vector(int argc, Obj** argv) {
+    if (argc < 1 || !IS_INT(argv[0]) || INT_VAL(argv[0]) < 0) {
+        fprintf(stderr, "make-vector: expected a length\n");
+        return nil_obj;
+    }
+    int len = (int)INT_VAL(argv[0]);
+    Obj* init = argc > 1 ? argv[1] : make_int(0);
+    Obj* vec = make_vector(len, IS_INT(init));
+    for (int i = 0; i < len; i++) {
+        if (IS_INT(init)) {
+            vec->vector.nums[i] = (int)INT_VAL(init);
+        } else {
+            vec->vector.items[i] = argv[1];
+        }
+    }
+    return vec;
+}
+
+/* (vector x...) */
+Obj* builtin_vector(int argc, Obj** argv) {
+    int numeric = 1;
+    for (int i = 0; i < argc; i++) {
+        if (!IS_INT(argv[i])) numeric = 0;
+    }
+    Obj* vec = make_vector(argc, numeric);
+    for (int i = 0; i < argc; i++) {
+        if (numeric) {
+            vec->vector.nums[i] = (int)INT_VAL(argv[i]);
+        } else {
+            vec->vector.items[i] = argv[i];
+        }
+    }
+    return vec;
+}
+
+Obj* builtin_vref(int argc, Obj** argv) {
+    int i;
+    if (!vector_index("vref", argc, argv, &i)) return nil_obj;
+    return vector_ref(argv[0], i);
+}
+
+/* (vset! v i x) stores x and returns it */
+Obj* builtin_vset(int argc, Obj** argv) {
+    int i;
+    if (!vector_index("vset!", argc, argv, &i)) return nil_obj;
+    Obj* vec = argv[0];
+    if (vec->shared) {
+        fprintf(stderr, "vset!: vector belongs to the warm environment\n");
+        return nil_obj;
+    }
+    Obj* val = argc > 2 ? argv[2] : nil_obj;
+    if (vec->vector.numeric && !IS_INT(val)) vector_generalize(vec);
+    if (vec->vector.numeric) {
+        vec->vector.nums[i] = (int)INT_VAL(val);
+    } else {
+        vec->vector.items[i] = val;
+        WRITE_BARRIER(vec);
+    }
+    return val;
+}
+
+Obj* builtin_vlength(int argc, Obj** argv) {
+    if (argc < 1 || TYPE(argv[0]) != T_VECTOR) {
+        fprintf(stderr, "vlength: expected a vector\n");
+        return nil_obj;
+    }
+    return make_int(argv[0]->vector.len);
+}
+
+/* Bulk kernels over numeric vectors. They run 8 lanes at a time with
+ * AVX2 or 4 with NEON when the compiler targets them (-march=native),
+ * and finish the tail, or the whole vector otherwise, one element at a
+ * time. Arithmetic wraps like the lanes do. */
+
+typedef enum {
+    VOP_ADD,
+    VOP_MUL,
+    VOP_LT,
+    VOP_EQ
+} VecOp;
+
+/* One element of vec_map */
+int vec_lane(VecOp op, int x, int y) {
+    switch (op) {
+        case VOP_ADD: return (int)((unsigned)x + (unsigned)y);
+        case VOP_MUL: return (int)((unsigned)x * (unsigned)y);
+        case VOP_LT: return x < y;
+        case VOP_EQ: return x == y;
+    }
+    return 0;
+}
+
+/* out[i] = a[i] op b[i], or a[i] op scalar when b is NULL */
+void vec_map(VecOp op, int* out, const int* a, const int* b, int scalar, int n) {
+    int i = 0;
+#if defined(__AVX2__)
+    __m256i s = _mm256_set1_epi32(scalar);
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = b ? _mm256_loadu_si256((const __m256i*)(b + i)) : s;
+        __m256i r;
+        switch (op) {
+            case VOP_ADD: r = _mm256_add_epi32(x, y); break;
+            case VOP_MUL: r = _mm256_mullo_epi32(x, y); break;
+            case VOP_LT: r = _mm256_srli_epi32(_mm256_cmpgt_epi32(y, x), 31); break;
+            default: r = _mm256_srli_epi32(_mm256_cmpeq_epi32(x, y), 31); break;
+        }
+        _mm256_storeu_si256((__m256i*)(out + i), r);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int32x4_t s = vdupq_n_s32(scalar);
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t x = vld1q_s32(a + i);
+        int32x4_t y = b ? vld1q_s32(b + i) : s;
+        int32x4_t r;
+        switch (op) {
+            case VOP_ADD: r = vaddq_s32(x, y); break;
+            case VOP_MUL: r = vmulq_s32(x, y); break;
+            case VOP_LT: r = vreinterpretq_s32_u32(vshrq_n_u32(vcltq_s32(x, y), 31)); break;
+            default: r = vreinterpretq_s32_u32(vshrq_n_u32(vceqq_s32(x, y), 31)); break;
+        }
+        vst1q_s32(out + i, r);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = vec_lane(op, a[i], b ? b[i] : scalar);
+    }
+}
+
+/* Sum of a[i] * b[i], or of a[i] when b is NULL, in 64 bits.  A plain
+ * sum always fits; for products the caller keeps n small enough. */
+long long vec_dot(const int* a, const int* b, int n) {
+    long long sum = 0;
+    int i = 0;
+#if defined(__AVX2__)
+    __m256i lo = _mm256_setzero_si256();
+    __m256i hi = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i xl = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x));
+        __m256i xh = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1));
+        if (b) {
+            __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+            xl = _mm256_mul_epi32(xl, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(y)));
+            xh = _mm256_mul_epi32(xh, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(y, 1)));
+        }
+        lo = _mm256_add_epi64(lo, xl);
+        hi = _mm256_add_epi64(hi, xh);
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(lo, hi));
+    for (int j = 0; j < 4; j++) sum += lanes[j];
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int64x2_t acc = vdupq_n_s64(0);
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t x = vld1q_s32(a + i);
+        if (b) {
+            int32x4_t y = vld1q_s32(b + i);
+            acc = vmlal_s32(acc, vget_low_s32(x), vget_low_s32(y));
+            acc = vmlal_high_s32(acc, x, y);
+        } else {
+            acc = vpadalq_s32(acc, x);
+        }
+    }
+    sum = vaddvq_s64(acc);
+#endif
+    for (; i < n; i++) {
+        sum += b ? (long long)a[i] * b[i] : a[i];
+    }
+    return sum;
+}
+
+/* Smallest element, or the largest if want_max; n must be positive */
+int vec_extreme(const int* a, int n, int want_max) {
+    int best = a[0];
+    int i = 0;
+#if defined(__AVX2__)
+    if (n >= 8) {
+        __m256i acc = _mm256_loadu_si256((const __m256i*)a);
+        for (i = 8; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+            acc = want_max ? _mm256_max_epi32(acc, x) : _mm256_min_epi32(acc, x);
+        }
+        int lanes[8];
+        _mm256_storeu_si256((__m256i*)lanes, acc);
+        for (int j = 0; j < 8; j++) {
+            if (want_max ? lanes[j] > best : lanes[j] < best) best = lanes[j];
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    if (n >= 4) {
+        int32x4_t acc = vld1q_s32(a);
+        for (i = 4; i + 4 <= n; i += 4) {
+            int32x4_t x = vld1q_s32(a + i);
+            acc = want_max ? vmaxq_s32(acc, x) : vminq_s32(acc, x);
+        }
+        best = want_max ? vmaxvq_s32(acc) : vminvq_s32(acc);
+    }
+#endif
+    for (; i < n; i++) {
+        if (want_max ? a[i] > best : a[i] < best) best = a[i];
+    }
+    return best;
+}
+
+/* Check that obj is a vector holding only integers */
+int numeric_vector(const char* name, Obj* obj) {
+    if (TYPE(obj) != T_VECTOR || !obj->vector.numeric) {
+        fprintf(stderr, "%s: expected a numeric vector\n", name);
+        return 0;
+    }
+    return 1;
+}
+
+/* Largest magnitude of the elements, 0 for an empty vector */
+unsigned long long vec_magnitude(const int* a, int n) {
+    if (n == 0) return 0;
+    long long lo = vec_extreme(a, n, 0);
+    long long hi = vec_extreme(a, n, 1);
+    return (unsigned long long)(-lo > hi ? -lo : hi);
+}
+
+Obj* builtin_vsum(int argc, Obj** argv) {
+    if (argc < 1 || !numeric_vector("vsum", argv[0])) return nil_obj;
+    return make_integer(vec_dot(argv[0]->vector.nums, NULL, argv[0]->vector.len));
+}
+
+Obj* builtin_vdot(int argc, Obj** argv) {
+    if (argc < 2 || !numeric_vector("vdot", argv[0]) || !numeric_vector("vdot", argv[1])) {
+        return nil_obj;
+    }
+    if (argv[0]->vector.len != argv[1]->vector.len) {
+        fprintf(stderr, "vdot: vectors differ in length\n");
+        return nil_obj;
+    }
+    const int* a = argv[0]->vector.nums;
+    const int* b = argv[1]->vector.nums;
+    int n = argv[0]->vector.len;
+    /* No product exceeds bound in magnitude, so LLONG_MAX / bound of
+     * them always sum within 64 bits.  Longer vectors are summed in
+     * chunks of that many, and the chunks added up as bignums. */
+    unsigned long long bound = vec_magnitude(a, n) * vec_magnitude(b, n);
+    int chunk = n;
+    if (bound != 0 && LLONG_MAX / bound < (unsigned long long)n) chunk = (int)(LLONG_MAX / bound);
+    if (chunk == n) return make_integer(vec_dot(a, b, n));
+    Obj* total = make_int(0);
+    PROTECT(total);
+    for (int i = 0; i < n; i += chunk) {
+        int len = n - i < chunk ? n - i : chunk;
+        total = big_add(total, make_integer(vec_dot(a + i, b + i, len)), 0);
+    }
+    UNPROTECT(1);
+    return total;
+}
+
+/* (vmin v) and (vmax v); nil for an empty vector */
+Obj* vector_extreme(const char* name, int argc, Obj** argv, int want_max) {
+    if (argc < 1 || !numeric_vector(name, argv[0])) return nil_obj;
+    if (argv[0]->vector.len == 0) return nil_obj;
+    return make_int(vec_extreme(argv[0]->vector.nums, argv[0]->vector.len, want_max));
+}
+
+Obj* builtin_vmin(int argc, Obj** argv) {
+    return vector_extreme("vmin", argc, argv, 0);
+}
+
+Obj* builtin_vmax(int argc, Obj** argv) {
+    return vector_extreme("vmax", argc, argv, 1);
+}
+
+/* (vmap+ v w) and friends: a fresh numeric vector of v[i] op w[i], where
+ * w is a numeric vector of the same length or an integer applied to
+ * every element. The comparisons give 1 or 0. */
+Obj* vector_map(const char* name, VecOp op, int argc, Obj** argv) {
+    if (argc < 2 || !numeric_vector(name, argv[0])) return nil_obj;
+    int len = argv[0]->vector.len;
+    if (!IS_INT(argv[1])) {
+        if (!numeric_vector(name, argv[1])) return nil_obj;
+        if (argv[1]->vector.len != len) {
+            fprintf(stderr, "%s: vectors differ in length\n", name);
+            return nil_obj;
+        }
+    }
+    Obj* vec = make_vector(len, 1);
+    if (IS_INT(argv[1])) {
+        vec_map(op, vec->vector.nums, argv[0]->vector.nums, NULL, (int)INT_VAL(argv[1]), len);
+    } else {
+        vec_map(op, vec->vector.nums, argv[0]->vector.nums, argv[1]->vector.nums, 0, len);
+    }
+    return vec;
+}
+
+Obj* builtin_vmap_add(int argc, Obj** argv) {
+    return vector_map("vmap+", VOP_ADD, argc, argv);
+}
+
+Obj* builtin_vmap_mul(int argc, Obj** argv) {
+    return vector_map("vmap*", VOP_MUL, argc, argv);
+}
+
+Obj* builtin_vmap_lt(int argc, Obj** argv) {
+    return vector_map("vmap<", VOP_LT, argc, argv);
+}
+
+Obj* builtin_vmap_eq(int argc, Obj** argv) {
+    return vector_map("vmap=", VOP_EQ, argc, argv);
+}
+
+/* Hash tables
+ *
+ * A T_HASH maps keys to values, comparing keys with equal and hashing
+ * them with sxhash.  Its entries are an open-addressing array that
+ * doubles once it is half full, like the symbol and global tables, and
+ * each entry keeps its key's hash so growing never rehashes a key.  A key
+ * must not be modified while it is in a table.  The array is counted with
+ * the vector storage, so a program that builds large tables is collected
+ * in proportion to them.
+ */
+#define HASH_MIN_CAPACITY 8
+
+/* An empty table with room for at least n entries */
+Obj* make_hash(int n) {
+    int capacity = HASH_MIN_CAPACITY;
+    while (capacity / 2 < n) capacity *= 2;
+    Obj* table = alloc_obj(T_HASH);
+    table->htab.entries = (HashEntry*)calloc(capacity, sizeof(HashEntry));
+    if (!table->htab.entries) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    table->htab.count = 0;
+    table->htab.capacity = capacity;
+    __atomic_add_fetch(&interp->vector_bytes, (size_t)capacity * sizeof(HashEntry), __ATOMIC_RELAXED);
+    return table;
+}
+
+/* The entry for key, or the empty slot where it would go */
+HashEntry* hash_slot(Obj* table, Obj* key, unsigned int hash) {
+    size_t mask = (size_t)table->htab.capacity - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        HashEntry* e = &table->htab.entries[i];
+        if (!e->key || (e->hash == hash && obj_equal(e->key, key))) return e;
+    }
+}
+
+/* Move the entries into an array of the given capacity */
+void hash_resize(Obj* table, int capacity) {
+    HashEntry* old = table->htab.entries;
+    int old_capacity = table->htab.capacity;
+    table->htab.entries = (HashEntry*)calloc(capacity, sizeof(HashEntry));
+    if (!table->htab.entries) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    table->htab.capacity = capacity;
+    size_t mask = (size_t)capacity - 1;
+    for (int i = 0; i < old_capacity; i++) {
+        if (!old[i].key) continue;
+        size_t j = old[i].hash & mask;
+        while (table->htab.entries[j].key) j = (j + 1) & mask;
+        table->htab.entries[j] = old[i];
+    }
+    free(old);
+    __atomic_add_fetch(&interp->vector_bytes, (size_t)(capacity - old_capacity) * sizeof(HashEntry),
+                       __ATOMIC_RELAXED);
+}
+
+void hash_put(Obj* table, Obj* key, Obj* value) {
+    if ((table->htab.count + 1) * 2 > table->htab.capacity) {
+        hash_resize(table, table->htab.capacity * 2);
+    }
+    unsigned int hash = obj_hash(key);
+    HashEntry* e = hash_slot(table, key, hash);
+    if (!e->key) {
+        e->key = key;
+        e->hash = hash;
+        table->htab.count++;
+    }
+    e->value = value;
+    WRITE_BARRIER(table);
+}
+
+/* Rebuild a table whose first count slots hold its entries in no
+ * particular place, as the image loader leaves them */
+void hash_rehash(Obj* table) {
+    int n = table->htab.count;
+    HashEntry* loaded = (HashEntry*)malloc((n + 1) * sizeof(HashEntry));
+    if (!loaded) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    memcpy(loaded, table->htab.entries, n * sizeof(HashEntry));
+    memset(table->htab.entries, 0, (size_t)table->htab.capacity * sizeof(HashEntry));
+    table->htab.count = 0;
+    for (int i = 0; i < n; i++) {
+        hash_put(table, loaded[i].key, loaded[i].value);
+    }
+    free(loaded);
+}
+
+int hash_arg(const char* name, Obj* obj) {
+    if (TYPE(obj) != T_HASH) {
+        fprintf(stderr, "%s: expected a hash table\n", name);
+        return 0;
+    }
+    return 1;
+}
+
+/* (make-hash [size]) */
+Obj* builtin_make_hash(int argc, Obj** argv) {
+    int n = 0;
+    if (argc > 0) {
+        if (!IS_INT(argv[0]) || INT_VAL(argv[0]) < 0 || INT_VAL(argv[0]) > (1 << 28)) {
+            fprintf(stderr, "make-hash: expected a size\n");
+            return nil_obj;
+        }
+        n = (int)INT_VAL(argv[0]);
+    }
+    return make_hash(n);
+}
+
+/* (gethash key table [default]) */
+Obj* builtin_gethash(int argc, Obj** argv) {
+    if (argc < 2 || !hash_arg("gethash", argv[1])) return nil_obj;
+    HashEntry* e = hash_slot(argv[1], argv[0], obj_hash(argv[0]));
+    if (e->key) return e->value;
+    return argc > 2 ? argv[2] : nil_obj;
+}
+
+/* (puthash key value table): returns the value */
+Obj* builtin_puthash(int argc, Obj** argv) {
+    if (argc < 3 || !hash_arg("puthash", argv[2])) return nil_obj;
+    if (argv[2]->shared) {
+        fprintf(stderr, "puthash: table belongs to the warm environment\n");
+        return nil_obj;
+    }
+    hash_put(argv[2], argv[0], argv[1]);
+    return argv[1];
+}
+
+Obj* builtin_hash_count(int argc, Obj** argv) {
+    if (argc < 1 || !hash_arg("hash-count", argv[0])) return nil_obj;
+    return make_int(argv[0]->htab.count);
+}
+
+/* Runtime counters, see alloc_total */
+const char* type_names[T_FREE] = {
+    "int", "symbol", "cons", "func", "lambda", "frame", "local", "global", "code",
+    "memo", "vector", "future", "bignum", "macro", "hash"
+};
+
+/* Sum of every thread's counters.  Threads that are still running may
+ * be a few increments ahead of what this sees. */
+Counters total_counters() {
+    Counters total;
+    memset(&total, 0, sizeof(total));
+    pthread_mutex_lock(&interp->world_lock);
+    for (Mutator* m = interp->mutators; m; m = m->next) {
+        Counters* c = &m->counters;
+        total.alloc_total += c->alloc_total;
+        for (int i = 0; i < T_FREE; i++) {
+            total.alloc_by_type[i] += c->alloc_by_type[i];
+        }
+        total.bytes_in_use += c->bytes_in_use;
+        total.eval_calls += c->eval_calls;
+        total.builtin_calls += c->builtin_calls;
+        total.lambda_calls += c->lambda_calls;
+        total.global_lookups += c->global_lookups;
+        total.global_probes += c->global_probes;
+        total.call_cache_misses += c->call_cache_misses;
+    }
+    pthread_mutex_unlock(&interp->world_lock);
+    return total;
+}
+
+/* Prepend (name . value) to an association list */
+Obj* stat_entry(Obj* list, const char* name, Obj* value) {
+    PROTECT(list);
+    PROTECT(value);
+    Obj* pair = cons(make_symbol(name), value);
+    PROTECT(pair);
+    pair = cons(pair, list);
+    UNPROTECT(3);
+    return pair;
+}
+
+/* (stats) returns the counters as an association list */
+Obj* builtin_stats(int argc, Obj** argv) {
+    Counters c = total_counters();
+    Obj* by_type = nil_obj;
+    PROTECT(by_type);
+    for (int i = T_FREE - 1; i > T_INT; i--) {
+        by_type = stat_entry(by_type, type_names[i], make_integer((long long)c.alloc_by_type[i]));
+    }
+    
+    Obj* list = nil_obj;
+    PROTECT(list);
+    list = stat_entry(list, "call-cache-misses", make_integer((long long)c.call_cache_misses));
+    list = stat_entry(list, "global-probes", make_integer((long long)c.global_probes));
+    list = stat_entry(list, "global-lookups", make_integer((long long)c.global_lookups));
+    list = stat_entry(list, "lambda-calls", make_integer((long long)c.lambda_calls));
+    list = stat_entry(list, "builtin-calls", make_integer((long long)c.builtin_calls));
+    list = stat_entry(list, "eval-calls", make_integer((long long)c.eval_calls));
+    list = stat_entry(list, "gc-minor-pause-max-us",
+                      make_integer((long long)(interp->gc_minor_pause_max_ms * 1000)));
+    list = stat_entry(list, "gc-pause-max-us", make_integer((long long)(interp->gc_pause_max_ms * 1000)));
+    list = stat_entry(list, "gc-pause-total-us", make_integer((long long)(interp->gc_pause_total_ms * 1000)));
+    list = stat_entry(list, "gc-full-cycles", make_integer((long long)interp->gc_full_cycles));
+    list = stat_entry(list, "gc-cycles", make_integer((long long)interp->gc_cycles));
+    list = stat_entry(list, "heap-peak-bytes", make_integer((long long)interp->heap_peak_bytes));
+    list = stat_entry(list, "heap-bytes", make_integer((long long)interp->heap_bytes));
+    list = stat_entry(list, "bytes-in-use", make_integer((long long)c.bytes_in_use));
+    list = stat_entry(list, "allocated-by-type", by_type);
+    list = stat_entry(list, "allocated", make_integer((long long)c.alloc_total));
+    UNPROTECT(2);
+    return list;
+}
+
+/* Report the counters on stderr (--stats) */
+void print_stats() {
+    Counters c = total_counters();
+    fprintf(stderr, "allocated       %zu objects\n", c.alloc_total);
+    for (int i = T_INT + 1; i < T_FREE; i++) {
+        if (c.alloc_by_type[i]) {
+            fprintf(stderr, "  %-13s %zu\n", type_names[i], c.alloc_by_type[i]);
+        }
+    }
+    fprintf(stderr, "bytes in use    %zu\n", c.bytes_in_use);
+    fprintf(stderr, "heap            %zu bytes (peak %zu)\n", interp->heap_bytes, interp->heap_peak_bytes);
+    fprintf(stderr, "gc              %zu cycles (%zu full), %.3fms total, %.3fms max pause"
+            " (%.3fms minor)\n", interp->gc_cycles, interp->gc_full_cycles,
+            interp->gc_pause_total_ms, interp->gc_pause_max_ms, interp->gc_minor_pause_max_ms);
+    fprintf(stderr, "eval calls      %zu\n", c.eval_calls);
+    fprintf(stderr, "builtin calls   %zu\n", c.builtin_calls);
+    fprintf(stderr, "lambda calls    %zu\n", c.lambda_calls);
+    fprintf(stderr, "global lookups  %zu (%.2f probes each)\n", c.global_lookups,
+            c.global_lookups ? (double)c.global_probes / c.global_lookups : 0.0);
+    fprintf(stderr, "call cache      %zu misses\n", c.call_cache_misses);
+}
+
+/* Bind a built-in function to a global name */
+void define_builtin(const char* name, BuiltinFunc func) {
+    if (interp->builtin_count == interp->builtin_capacity) {
+        interp->builtin_capacity = interp->builtin_capacity ? interp->builtin_capacity * 2 : 32;
+        interp->builtin_table = (BuiltinFunc*)realloc(interp->builtin_table, interp->builtin_capacity * sizeof(BuiltinFunc));
+        if (!interp->builtin_table) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    interp->builtin_table[interp->builtin_count++] = func;
+    
+    Obj* sym = make_symbol(name);
+    global_define(sym, make_func(func));
+}
+
+/* Bytecode engine (--vm)
+ *
+ * With use_vm set, the resolver compiles every lambda and defun body
+ * once into a T_CODE object that replaces the body in the lambda.  The
+ * code is run by a stack VM that shares frames, globals and built-ins
+ * with the tree walker.  Calls between compiled lambdas push VMFrames
+ * instead of recursing in C, and calls in tail position reuse the
+ * current VMFrame.
+ *
+ * Calls to +, -, *, <, eq, car, cdr and cons with the usual number of
+ * arguments compile to dedicated instructions.  They check at run time
+ * that the global still holds the original built-in and fall back to an
+ * ordinary call if it was redefined or the arguments are not integers.
+ */
+typedef enum {
+    OP_CONST,           /* k: push constant k */
+    OP_LOCAL0,          /* i: push slot i of the current frame */
+    OP_LOCAL,           /* d i: push slot i of the frame d levels up */
+    OP_GLOBAL,          /* k: push the value of global binding constant k */
+    OP_POP,
+    OP_DUP,
+    OP_JUMP,            /* target */
+    OP_JUMP_IF_NIL,     /* target: pop, jump if nil */
+    OP_CALL,            /* n: call the function below the top n values */
+    OP_TAILCALL,        /* n: same, replacing the current call */
+    OP_RETURN,
+    OP_CLOSURE,         /* k: push a lambda over code k and the current frame */
+    OP_DEFUN,           /* k: bind code k globally under its name, push the name */
+    OP_DEFUN_MEMO,      /* k: same, wrapping the lambda with memoize */
+    OP_DEFMACRO,        /* k r: bind code k as a macro, r if it has a rest parameter */
+    OP_LET,             /* n: pop n values into a new frame inside the current one */
+    OP_UNLET,           /* leave the innermost let frame */
+    OP_ADD,             /* k: inline call through global binding k */
+    OP_SUB,
+    OP_MUL,
+    OP_LT,
+    OP_EQ,
+    OP_CAR,
+    OP_CDR,
+    OP_CONS,
+    OP_FUTURE           /* start a future calling the closure on top */
+} OpCode;
+
+/* Compiler state for one function */
+typedef struct {
+    Obj* code;                  /* T_CODE being filled in */
+    int capacity;
+    int consts_capacity;
+    int depth;                  /* Current value stack depth */
+    int overflow;               /* An operand did not fit in an op */
+} Compiler;
+
+void emit(Compiler* c, int op) {
+    Code* code = c->code->code;
+    if (code->len == c->capacity) {
+        c->capacity = c->capacity ? c->capacity * 2 : 64;
+        code->ops = (unsigned short*)realloc(code->ops, c->capacity * sizeof(unsigned short));
+        if (!code->ops) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    if (op > USHRT_MAX || code->len > USHRT_MAX) c->overflow = 1;
+    code->ops[code->len++] = (unsigned short)op;
+}
+
+/* Track the stack effect of the instructions just emitted */
+void stack_effect(Compiler* c, int delta) {
+    c->depth += delta;
+    if (c->depth > c->code->code->max_stack) {
+        c->code->code->max_stack = c->depth;
+    }
+}
+
+int add_const(Compiler* c, Obj* value) {
+    Code* code = c->code->code;
+    for (int i = 0; i < code->nconsts; i++) {
+        if (code->consts[i] == value) return i;
+    }
+    if (code->nconsts == c->consts_capacity) {
+        c->consts_capacity = c->consts_capacity ? c->consts_capacity * 2 : 8;
+        code->consts = (Obj**)realloc(code->consts, c->consts_capacity * sizeof(Obj*));
+        if (!code->consts) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    code->consts[code->nconsts] = value;
+    WRITE_BARRIER(c->code);
+    return code->nconsts++;
+}
+
+/* Emit a jump with a placeholder target; returns the operand position */
+int emit_jump(Compiler* c, int op) {
+    emit(c, op);
+    emit(c, 0);
+    return c->code->code->len - 1;
+}
+
+void patch_jump(Compiler* c, int at) {
+    if (c->code->code->len > USHRT_MAX) c->overflow = 1;
+    c->code->code->ops[at] = (unsigned short)c->code->code->len;
+}
+
+void compile_expr(Compiler* c, Obj* expr, int tail);
+
+/* Emit a jump to the end of a cond, recording it in a growable array */
+int* add_end_jump(Compiler* c, int* ends, int* count, int* capacity) {
+    if (*count == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 16;
+        ends = (int*)realloc(ends, *capacity * sizeof(int));
+        if (!ends) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    ends[(*count)++] = emit_jump(c, OP_JUMP);
+    return ends;
+}
+
+/* Emit the value of a non-call expression, returning it if in tail position */
+void compile_return(Compiler* c, int tail) {
+    if (tail) emit(c, OP_RETURN);
+}
+
+void compile_body(Compiler* c, Obj* body, int tail) {
+    if (is_nil(body)) {
+        emit(c, OP_CONST);
+        emit(c, add_const(c, nil_obj));
+        stack_effect(c, 1);
+        compile_return(c, tail);
+        return;
+    }
+    while (!is_nil(cdr(body))) {
+        compile_expr(c, car(body), 0);
+        emit(c, OP_POP);
+        stack_effect(c, -1);
+        body = cdr(body);
+    }
+    compile_expr(c, car(body), tail);
+}
+
+/* Instruction for an inlinable built-in call, or -1 */
+int inline_op(Obj* op, int argc) {
+    if (TYPE(op) != T_GLOBAL) return -1;
+    const char* name = car(op->cell)->sym;
+    if (argc == 2) {
+        if (strcmp(name, "+") == 0) return OP_ADD;
+        if (strcmp(name, "-") == 0) return OP_SUB;
+        if (strcmp(name, "*") == 0) return OP_MUL;
+        if (strcmp(name, "<") == 0) return OP_LT;
+        if (strcmp(name, "eq") == 0) return OP_EQ;
+        if (strcmp(name, "cons") == 0) return OP_CONS;
+    }
+    if (argc == 1) {
+        if (strcmp(name, "car") == 0) return OP_CAR;
+        if (strcmp(name, "cdr") == 0) return OP_CDR;
+    }
+    return -1;
+}
+
+void compile_call(Compiler* c, Obj* expr, int tail) {
+    Obj* op = car(expr);
+    Obj* args = cdr(expr);
+    int argc = list_length(args);
+    
+    int inline_code = inline_op(op, argc);
+    if (inline_code >= 0) {
+        for (Obj* a = args; !is_nil(a); a = cdr(a)) {
+            compile_expr(c, car(a), 0);
+        }
+        emit(c, inline_code);
+        emit(c, add_const(c, op->cell));
+        stack_effect(c, 1 - argc);
+        compile_return(c, tail);
+        return;
+    }
+    
+    compile_expr(c, op, 0);
+    for (Obj* a = args; !is_nil(a); a = cdr(a)) {
+        compile_expr(c, car(a), 0);
+    }
+    emit(c, tail ? OP_TAILCALL : OP_CALL);
+    emit(c, argc);
+    stack_effect(c, -argc);
+}
+
+void compile_expr(Compiler* c, Obj* expr, int tail) {
+    if (!expr) expr = nil_obj;
+    
+    if (TYPE(expr) == T_LOCAL) {
+        if (expr->local.depth == 0) {
+            emit(c, OP_LOCAL0);
+        } else {
+            emit(c, OP_LOCAL);
+            emit(c, expr->local.depth);
+        }
+        emit(c, expr->local.index);
+        stack_effect(c, 1);
+        compile_return(c, tail);
+        return;
+    }
+    
+    if (TYPE(expr) == T_GLOBAL) {
+        emit(c, OP_GLOBAL);
+        emit(c, add_const(c, expr->cell));
+        stack_effect(c, 1);
+        compile_return(c, tail);
+        return;
+    }
+    
+    if (TYPE(expr) != T_CONS) {
+        emit(c, OP_CONST);
+        emit(c, add_const(c, expr));
+        stack_effect(c, 1);
+        compile_return(c, tail);
+        return;
+    }
+    
+    Obj* op = car(expr);
+    Obj* args = cdr(expr);
+    if (TYPE(op) != T_SYMBOL || op->special == SF_NONE) {
+        compile_call(c, expr, tail);
+        return;
+    }
+    
+    switch (op->special) {
+        case SF_QUOTE:
+            emit(c, OP_CONST);
+            emit(c, add_const(c, car(args)));
+            stack_effect(c, 1);
+            compile_return(c, tail);
+            break;
+        
+        case SF_IF: {
+            compile_expr(c, car(args), 0);
+            int to_else = emit_jump(c, OP_JUMP_IF_NIL);
+            stack_effect(c, -1);
+            compile_expr(c, car(cdr(args)), tail);
+            int to_end = tail ? -1 : emit_jump(c, OP_JUMP);
+            stack_effect(c, -1);
+            patch_jump(c, to_else);
+            /* Like eval, only the first form after the then-branch */
+            Obj* rest = cdr(cdr(args));
+            compile_expr(c, is_nil(rest) ? nil_obj : car(rest), tail);
+            if (to_end >= 0) patch_jump(c, to_end);
+            break;
+        }
+        
+        case SF_LAMBDA:
+            /* The resolver already compiled the body: (lambda params code) */
+            emit(c, OP_CLOSURE);
+            emit(c, add_const(c, car(cdr(args))));
+            stack_effect(c, 1);
+            compile_return(c, tail);
+            break;
+        
+        case SF_DEFUN:
+        case SF_DEFUN_MEMO:
+            emit(c, op->special == SF_DEFUN ? OP_DEFUN : OP_DEFUN_MEMO);
+            emit(c, add_const(c, car(cdr(cdr(args)))));
+            stack_effect(c, 1);
+            compile_return(c, tail);
+            break;
+        
+        case SF_DEFMACRO:
+            emit(c, OP_DEFMACRO);
+            emit(c, add_const(c, car(cdr(cdr(args)))));
+            emit(c, rest_params(car(cdr(args))));
+            stack_effect(c, 1);
+            compile_return(c, tail);
+            break;
+        
+        case SF_FUTURE:
+            compile_expr(c, car(args), 0);
+            emit(c, OP_FUTURE);
+            compile_return(c, tail);
+            break;
+        
+        case SF_PROGN:
+            compile_body(c, args, tail);
+            break;
+        
+        case SF_LET: {
+            int n = 0;
+            for (Obj* b = car(args); !is_nil(b); b = cdr(b), n++) {
+                compile_expr(c, car(cdr(car(b))), 0);
+            }
+            emit(c, OP_LET);
+            emit(c, n);
+            stack_effect(c, -n);
+            compile_body(c, cdr(args), tail);
+            if (!tail) emit(c, OP_UNLET);
+            break;
+        }
+        
+        case SF_COND: {
+            /* Jumps to the end are patched once the position is known */
+            int* ends = NULL;
+            int nends = 0;
+            int ends_capacity = 0;
+            for (Obj* cl = args; !is_nil(cl); cl = cdr(cl)) {
+                Obj* clause = car(cl);
+                compile_expr(c, car(clause), 0);
+                if (is_nil(cdr(clause))) {
+                    /* The test value is the result */
+                    emit(c, OP_DUP);
+                    stack_effect(c, 1);
+                    int next = emit_jump(c, OP_JUMP_IF_NIL);
+                    stack_effect(c, -1);
+                    if (tail) {
+                        emit(c, OP_RETURN);
+                    } else {
+                        ends = add_end_jump(c, ends, &nends, &ends_capacity);
+                    }
+                    patch_jump(c, next);
+                    emit(c, OP_POP);
+                    stack_effect(c, -1);
+                } else {
+                    int next = emit_jump(c, OP_JUMP_IF_NIL);
+                    stack_effect(c, -1);
+                    compile_body(c, cdr(clause), tail);
+                    stack_effect(c, -1);
+                    if (!tail) {
+                        ends = add_end_jump(c, ends, &nends, &ends_capacity);
+                    }
+                    patch_jump(c, next);
+                }
+            }
+            emit(c, OP_CONST);
+            emit(c, add_const(c, nil_obj));
+            stack_effect(c, 1);
+            compile_return(c, tail);
+            for (int i = 0; i < nends; i++) {
+                patch_jump(c, ends[i]);
+            }
+            free(ends);
+            break;
+        }
+        
+        case SF_QUASIQUOTE:
+        case SF_NONE:
+            break;
+    }
+}
+
+/* Compile a resolved function body into a T_CODE object, or return NULL
+ * if its code or constants are too large for 16-bit operands, leaving
+ * the body to the tree walker */
+Obj* compile_function(Obj* name, Obj* params, Obj* body) {
+    Obj* obj = alloc_obj(T_CODE);
+    obj->code = (Code*)calloc(1, sizeof(Code));
+    if (!obj->code) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    obj->code->params = params;
+    obj->code->name = name;
+    obj->code->nparams = param_count(params, &obj->code->rest);
+    PROTECT(obj);
+    
+    Compiler c = {obj, 0, 0, 0, 0};
+    compile_expr(&c, body, 1);
+    
+    UNPROTECT(1);
+    return c.overflow ? NULL : obj;
+}
+
+/* Start executing a compiled lambda whose frame is already built */
+void vm_push_frame(Obj* code, Obj* env) {
+    if (vm_fp == vm_frames_capacity) {
+        vm_frames_capacity = vm_frames_capacity ? vm_frames_capacity * 2 : 256;
+        vm_frames = (VMFrame*)realloc(vm_frames, vm_frames_capacity * sizeof(VMFrame));
+        if (!vm_frames) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    reserve_values(code->code->max_stack + 1);
+    VMFrame* f = &vm_frames[vm_fp++];
+    f->code = code;
+    f->env = env;
+    f->pc = 0;
+    f->base = value_sp;
+}
+
+/* Build the frame for a lambda from argc values on top of the stack */
+Obj* vm_bind_args(Obj* func, int argc) {
+    counters->lambda_calls++;
+    Code* code = func->lambda.body->code;
+    return bind_frame(code->nparams, code->rest, func->lambda.env, argc);
+}
+
+/* Call a function that is not compiled code: built-ins take their
+ * arguments straight from the stack, tree-walker lambdas are evaluated
+ * with eval */
+Obj* vm_call_native(Obj* func, int argc) {
+    if (TYPE(func) == T_FUNC) {
+        counters->builtin_calls++;
+        return func->func(argc, &value_stack[value_sp - argc]);
+    }
+    
+    if (TYPE(func) == T_MEMO) {
+        return memo_call(func, argc);
+    }
+    
+    if (TYPE(func) == T_LAMBDA) {
+        counters->lambda_calls++;
+        int rest;
+        int nparams = param_count(func->lambda.params, &rest);
+        Obj* frame = bind_frame(nparams, rest, func->lambda.env, argc);
+        return eval(func->lambda.body, frame);
+    }
+    
+    fprintf(stderr, "Not a function\n");
+    return nil_obj;
+}
+
+/* Call any function with the argc values on top of the stack as its
+ * arguments, running compiled code on a nested VM loop */
+Obj* call_function(Obj* func, int argc) {
+    if (TYPE(func) == T_LAMBDA && TYPE(func->lambda.body) == T_CODE) {
+        Obj* frame = vm_bind_args(func, argc);
+        return vm_apply(func, frame);
+    }
+    return vm_call_native(func, argc);
+}
+
+/* Slow path of an inline instruction: call the global's current value */
+Obj* vm_call_global(Obj* cell, int argc) {
+    Obj* func = cell->cons.cdr;
+    if (!func) {
+        fprintf(stderr, "Undefined symbol: %s\n", car(cell)->sym);
+        return nil_obj;
+    }
+    /* A redefined operator: run it to completion on a nested VM loop */
+    return call_function(func, argc);
+}
+
+/* Memoization
+ *
+ * (memoize f [limit]) and defun-memo wrap a function in a T_MEMO whose
+ * cache maps argument lists, compared with equal, to results.  Once the
+ * cache holds limit entries the least recently used one is evicted.  The
+ * collector traces every cached key and value through the T_MEMO.
+ */
+Obj* make_memo(Obj* func, size_t limit) {
+    PROTECT(func);
+    Obj* obj = alloc_obj(T_MEMO);
+    obj->memo.func = func;
+    obj->memo.cache = (MemoCache*)calloc(1, sizeof(MemoCache));
+    if (!obj->memo.cache) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    obj->memo.cache->limit = limit ? limit : 1;
+    UNPROTECT(1);
+    return obj;
+}
+
+/* Find the entry for the argc arguments at argv, or NULL */
+MemoEntry* memo_find(MemoCache* cache, unsigned int hash, int argc, Obj** argv) {
+    if (!cache->buckets) return NULL;
+    for (MemoEntry* e = cache->buckets[hash & (cache->nbuckets - 1)]; e; e = e->chain) {
+        if (e->hash != hash) continue;
+        Obj* key = e->args;
+        int i = 0;
+        while (i < argc && TYPE(key) == T_CONS && obj_equal(car(key), argv[i])) {
+            key = cdr(key);
+            i++;
+        }
+        if (i == argc && is_nil(key)) return e;
+    }
+    return NULL;
+}
+
+void memo_unlink(MemoCache* cache, MemoEntry* e) {
+    if (e->newer) e->newer->older = e->older; else cache->newest = e->older;
+    if (e->older) e->older->newer = e->newer; else cache->oldest = e->newer;
+}
+
+void memo_push(MemoCache* cache, MemoEntry* e) {
+    e->newer = NULL;
+    e->older = cache->newest;
+    if (cache->newest) cache->newest->newer = e; else cache->oldest = e;
+    cache->newest = e;
+}
+
+/* Add an entry, evicting the least recently used one if the cache is full */
+void memo_insert(MemoCache* cache, unsigned int hash, Obj* args, Obj* value) {
+    if (!cache->buckets) {
+        cache->nbuckets = 16;
+        while (cache->nbuckets < cache->limit && cache->nbuckets < (1u << 20)) cache->nbuckets *= 2;
+        cache->buckets = (MemoEntry**)calloc(cache->nbuckets, sizeof(MemoEntry*));
+        if (!cache->buckets) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    
+    MemoEntry* e;
+    if (cache->count >= cache->limit) {
+        e = cache->oldest;
+        memo_unlink(cache, e);
+        MemoEntry** link = &cache->buckets[e->hash & (cache->nbuckets - 1)];
+        while (*link != e) link = &(*link)->chain;
+        *link = e->chain;
+    } else {
+        e = (MemoEntry*)malloc(sizeof(MemoEntry));
+        if (!e) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        cache->count++;
+    }
+    
+    e->args = args;
+    e->value = value;
+    e->hash = hash;
+    MemoEntry** bucket = &cache->buckets[hash & (cache->nbuckets - 1)];
+    e->chain = *bucket;
+    *bucket = e;
+    memo_push(cache, e);
+}
+
+/* This instance's own memo for a frozen parent's, made on first use */
+Obj* memo_overlay(Obj* memo) {
+    for (Obj* p = interp->memo_overlays; !is_nil(p); p = cdr(p)) {
+        if (car(car(p)) == memo) return cdr(car(p));
+    }
+    Obj* own = make_memo(memo->memo.func, memo->memo.cache->limit);
+    PROTECT(own);
+    Obj* pair = cons(memo, own);
+    PROTECT(pair);
+    interp->memo_overlays = cons(pair, interp->memo_overlays);
+    UNPROTECT(2);
+    return own;
+}
+
+/* Call a memoized function with the argc values on top of the stack.  A
+ * frozen parent's cache is only read: what it lacks is cached in the
+ * calling instance's own memo. */
+Obj* memo_call(Obj* memo, int argc) {
+    MemoCache* cache = memo->memo.cache;
+    Obj** argv = &value_stack[value_sp - argc];
+    
+    unsigned int hash = (unsigned int)argc;
+    for (int i = 0; i < argc; i++) {
+        hash = (hash ^ obj_hash(argv[i])) * 16777619u;
+    }
+    
+    if (memo->shared) {
+        MemoEntry* e = memo_find(cache, hash, argc, argv);
+        if (e) return e->value;
+        return memo_call(memo_overlay(memo), argc);
+    }
+    
+    pthread_mutex_lock(&interp->memo_lock);
+    MemoEntry* e = memo_find(cache, hash, argc, argv);
+    if (e) {
+        memo_unlink(cache, e);
+        memo_push(cache, e);
+        Obj* value = e->value;
+        pthread_mutex_unlock(&interp->memo_lock);
+        return value;
+    }
+    pthread_mutex_unlock(&interp->memo_lock);
+    
+    /* Miss: copy the arguments into a key before the call can move the
+     * stack, then call and cache the result */
+    Obj* key = nil_obj;
+    PROTECT(memo);
+    PROTECT(key);
+    for (int i = argc - 1; i >= 0; i--) {
+        key = cons(value_stack[value_sp - argc + i], key);
+    }
+    Obj* result = call_function(memo->memo.func, argc);
+    
+    /* A recursive call, or another thread, may have cached the same
+     * arguments meanwhile */
+    pthread_mutex_lock(&interp->memo_lock);
+    e = memo_find(cache, hash, argc, &value_stack[value_sp - argc]);
+    if (e) {
+        e->value = result;
+    } else {
+        memo_insert(cache, hash, key, result);
+    }
+    WRITE_BARRIER(memo);
+    pthread_mutex_unlock(&interp->memo_lock);
+    UNPROTECT(2);
+    return result;
+}
+
+/* (memoize f [limit]) */
+Obj* builtin_memoize(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    if (TYPE(argv[0]) != T_LAMBDA && TYPE(argv[0]) != T_FUNC && TYPE(argv[0]) != T_MEMO) {
+        fprintf(stderr, "memoize: expected a function\n");
+        return nil_obj;
+    }
+    size_t limit = MEMO_DEFAULT_LIMIT;
+    if (argc > 1) {
+        if (!IS_INT(argv[1]) || INT_VAL(argv[1]) < 1) {
+            fprintf(stderr, "memoize: limit must be a positive integer\n");
+            return nil_obj;
+        }
+        limit = (size_t)INT_VAL(argv[1]);
+    }
+    return make_memo(argv[0], limit);
+}
+
+/* Parallel evaluation: (future expr), (touch x) and (pmap f list)
+ *
+ * A future is a call (func . args) that is queued, running on some
+ * thread, or done.  The pool has one thread per core counting the main
+ * thread (or --threads N) and starts with the first future.  Each thread
+ * has a deque of futures: a new future goes on its creator's deque, and
+ * a thread looking for work takes the newest future from its own deque
+ * or else steals the oldest from another.  Touching a queued future runs
+ * it right there; touching a running one helps with other futures until
+ * it is done.  A claimed future is left in its deque and skipped when
+ * it comes up, so claiming is a single compare-and-swap on its state.
+ *
+ * Futures share the heap and the globals, so the code they run should
+ * not race on anything mutable (vectors, globals it redefines).  With a
+ * single thread a future runs as soon as it is created.
+ */
+#define FUTURE_QUEUED 0
+#define FUTURE_RUNNING 1
+#define FUTURE_DONE 2
+
+struct Deque {
+    pthread_mutex_t lock;
+    Obj** items;                /* Oldest at head, newest at tail - 1 */
+    size_t head;
+    size_t tail;
+    size_t capacity;
+};
+
+int thread_count = 0;               /* --threads, or 0 for one per core */
+
+/* The pool's state is in the Interp.  Its counts are read and written
+ * with __atomic operations.  A thread about to sleep registers as idle
+ * or waiting before checking for work or a finished future, and a
+ * thread providing either checks for sleepers after publishing it, so
+ * one of the two always sees the other. */
+
+Obj* make_future(Obj* call) {
+    PROTECT(call);
+    Obj* future = alloc_obj(T_FUTURE);
+    future->future.call = call;
+    future->future.value = nil_obj;
+    future->future.state = FUTURE_QUEUED;
+    UNPROTECT(1);
+    return future;
+}
+
+void deque_push(Deque* d, Obj* future) {
+    pthread_mutex_lock(&d->lock);
+    if (d->tail == d->capacity) {
+        size_t count = d->tail - d->head;
+        if (count * 2 >= d->capacity) {
+            d->capacity = d->capacity ? d->capacity * 2 : 64;
+            d->items = (Obj**)realloc(d->items, d->capacity * sizeof(Obj*));
+            if (!d->items) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+        memmove(d->items, d->items + d->head, count * sizeof(Obj*));
+        d->head = 0;
+        d->tail = count;
+    }
+    d->items[d->tail++] = future;
+    pthread_mutex_unlock(&d->lock);
+}
+
+/* Remove the newest or the oldest future from a deque, or return NULL */
+Obj* deque_take(Deque* d, int newest) {
+    Obj* future = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->head < d->tail) {
+        future = newest ? d->items[--d->tail] : d->items[d->head++];
+        if (d->head == d->tail) d->head = d->tail = 0;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return future;
+}
+
+/* Move a queued future to running; fails if another thread got to it */
+int claim_future(Obj* future) {
+    int expected = FUTURE_QUEUED;
+    if (!__atomic_compare_exchange_n(&future->future.state, &expected, FUTURE_RUNNING, 0,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return 0;
+    }
+    __atomic_add_fetch(&interp->running_futures, 1, __ATOMIC_SEQ_CST);
+    __atomic_sub_fetch(&interp->queued_futures, 1, __ATOMIC_SEQ_CST);
+    return 1;
+}
+
+/* Claim a future from this thread's deque, or steal one from another */
+Obj* find_future() {
+    int n = interp->pool_size + 1;
+    for (int k = 0; k < n; k++) {
+        Deque* d = &interp->deques[(thread_index + k) % n];
+        Obj* future;
+        while ((future = deque_take(d, k == 0))) {
+            if (claim_future(future)) return future;
+        }
+    }
+    return NULL;
+}
+
+/* Run a claimed future on this thread and wake anyone waiting for it */
+void run_future(Obj* future) {
+    PROTECT(future);
+    Obj* call = future->future.call;
+    size_t base = value_sp;
+    int argc = 0;
+    for (Obj* a = cdr(call); !is_nil(a); a = cdr(a), argc++) {
+        reserve_values(1);
+        value_stack[value_sp++] = car(a);
+    }
+    Obj* value = call_function(car(call), argc);
+    value_sp = base;
+    future->future.value = value;
+    future->future.call = nil_obj;
+    WRITE_BARRIER(future);
+    UNPROTECT(1);
+    
+    __atomic_store_n(&future->future.state, FUTURE_DONE, __ATOMIC_SEQ_CST);
+    __atomic_sub_fetch(&interp->running_futures, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&interp->touch_waiters, __ATOMIC_SEQ_CST) > 0) {
+        pthread_mutex_lock(&interp->pool_lock);
+        pthread_cond_broadcast(&interp->done_cond);
+        pthread_mutex_unlock(&interp->pool_lock);
+    }
+}
+
+/* Sleep, parked, until some future finishes or the condition fails */
+void wait_for_futures(Obj* future) {
+    enter_safe();
+    pthread_mutex_lock(&interp->pool_lock);
+    __atomic_add_fetch(&interp->touch_waiters, 1, __ATOMIC_SEQ_CST);
+    if (future) {
+        while (__atomic_load_n(&future->future.state, __ATOMIC_SEQ_CST) != FUTURE_DONE) {
+            pthread_cond_wait(&interp->done_cond, &interp->pool_lock);
+        }
+    } else if (__atomic_load_n(&interp->running_futures, __ATOMIC_SEQ_CST) > 0 &&
+               __atomic_load_n(&interp->queued_futures, __ATOMIC_SEQ_CST) == 0) {
+        pthread_cond_wait(&interp->done_cond, &interp->pool_lock);
+    }
+    __atomic_sub_fetch(&interp->touch_waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&interp->pool_lock);
+    leave_safe();
+}
+
+void* worker_main(void* arg) {
+    use_mutator((Mutator*)arg);
+    leave_safe();
+    while (1) {
+        Obj* future = find_future();
+        if (future) {
+            run_future(future);
+            continue;
+        }
+        enter_safe();
+        pthread_mutex_lock(&interp->pool_lock);
+        __atomic_add_fetch(&interp->idle_workers, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&interp->queued_futures, __ATOMIC_SEQ_CST) == 0 &&
+               !interp->pool_stopping) {
+            pthread_cond_wait(&interp->work_cond, &interp->pool_lock);
+        }
+        __atomic_sub_fetch(&interp->idle_workers, 1, __ATOMIC_SEQ_CST);
+        int stopping = interp->pool_stopping;
+        pthread_mutex_unlock(&interp->pool_lock);
+        if (stopping) break;
+        leave_safe();
+    }
+    return NULL;                    /* Parked, with its stacks published */
+}
+
+void start_pool() {
+    interp->pool_started = 1;
+    int threads = thread_count > 0 ? thread_count : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+    interp->deques = (Deque*)calloc(threads, sizeof(Deque));
+    if (!interp->deques) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_mutex_init(&interp->deques[i].lock, NULL);
+    }
+    
+    interp->workers = (pthread_t*)calloc(threads, sizeof(pthread_t));
+    if (!interp->workers) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    
+    /* Set before any worker runs, since it sizes their search */
+    interp->pool_size = threads - 1;
+    for (int i = 1; i < threads; i++) {
+        Mutator* m = (Mutator*)calloc(1, sizeof(Mutator));
+        if (!m) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        m->thread_index = i;
+        register_mutator(interp, m);
+        if (pthread_create(&interp->workers[i - 1], NULL, worker_main, m) != 0) {
+            fprintf(stderr, "Cannot start worker thread %d\n", i);
+            break;
+        }
+        interp->worker_count++;
+    }
+}
+
+/* Wake the idle workers to exit, and wait for them */
+void stop_pool() {
+    pthread_mutex_lock(&interp->pool_lock);
+    interp->pool_stopping = 1;
+    pthread_cond_broadcast(&interp->work_cond);
+    pthread_mutex_unlock(&interp->pool_lock);
+    for (int i = 0; i < interp->worker_count; i++) {
+        pthread_join(interp->workers[i], NULL);
+    }
+}
+
+/* Create a future for (func . args) and queue it */
+Obj* spawn_future(Obj* call) {
+    if (!interp->pool_started) start_pool();
+    Obj* future = make_future(call);
+    if (interp->pool_size == 0) {
+        future->future.state = FUTURE_RUNNING;
+        interp->running_futures++;
+        run_future(future);
+        return future;
+    }
+    
+    __atomic_add_fetch(&interp->queued_futures, 1, __ATOMIC_SEQ_CST);
+    deque_push(&interp->deques[thread_index], future);
+    if (__atomic_load_n(&interp->idle_workers, __ATOMIC_SEQ_CST) > 0) {
+        pthread_mutex_lock(&interp->pool_lock);
+        pthread_cond_signal(&interp->work_cond);
+        pthread_mutex_unlock(&interp->pool_lock);
+    }
+    return future;
+}
+
+/* The value of a future, waiting for it if needed; anything else is
+ * its own value */
+Obj* touch(Obj* future) {
+    if (TYPE(future) != T_FUTURE) return future;
+    PROTECT(future);
+    if (claim_future(future)) run_future(future);
+    while (__atomic_load_n(&future->future.state, __ATOMIC_ACQUIRE) != FUTURE_DONE) {
+        Obj* other = find_future();
+        if (other) {
+            run_future(other);
+        } else {
+            wait_for_futures(future);
+        }
+    }
+    UNPROTECT(1);
+    return future->future.value;
+}
+
+/* Wait for every future to finish, helping with the queued ones */
+void finish_futures() {
+    if (!interp->pool_started) return;
+    while (__atomic_load_n(&interp->queued_futures, __ATOMIC_SEQ_CST) > 0 ||
+           __atomic_load_n(&interp->running_futures, __ATOMIC_SEQ_CST) > 0) {
+        Obj* future = find_future();
+        if (future) {
+            run_future(future);
+        } else {
+            wait_for_futures(NULL);
+        }
+    }
+}
+
+/* Queued futures are roots: nothing else may refer to them */
+void mark_futures(size_t* live) {
+    if (!interp->deques) return;
+    for (int i = 0; i <= interp->pool_size; i++) {
+        for (size_t j = interp->deques[i].head; j < interp->deques[i].tail; j++) {
+            *live += gc_mark(interp->deques[i].items[j]);
+        }
+    }
+}
+
+Obj* builtin_touch(int argc, Obj** argv) {
+    if (argc < 1) return nil_obj;
+    return touch(argv[0]);
+}
+
+/* (pmap f list): like mapping f over list, with each call a future */
+Obj* builtin_pmap(int argc, Obj** argv) {
+    if (argc < 2 || (TYPE(argv[0]) != T_LAMBDA && TYPE(argv[0]) != T_FUNC &&
+                     TYPE(argv[0]) != T_MEMO)) {
+        fprintf(stderr, "pmap: expected a function and a list\n");
+        return nil_obj;
+    }
+    /* argv moves if a future runs here and grows the value stack */
+    Obj* func = argv[0];
+    Obj* list = argv[1];
+    Obj* futures = nil_obj;
+    Obj* item = nil_obj;
+    PROTECT(func);
+    PROTECT(list);
+    PROTECT(futures);
+    PROTECT(item);
+    for (; TYPE(list) == T_CONS; list = cdr(list)) {
+        item = cons(car(list), nil_obj);
+        item = cons(func, item);
+        item = spawn_future(item);
+        futures = cons(item, futures);
+    }
+    
+    /* Newest first, like the owner of a deque, leaving the oldest to be
+     * stolen */
+    Obj* result = nil_obj;
+    PROTECT(result);
+    for (Obj* f = futures; !is_nil(f); f = cdr(f)) {
+        result = cons(touch(car(f)), result);
+    }
+    UNPROTECT(5);
+    return result;
+}
+
+/* Is the global bound to the original built-in? */
+int is_builtin(Obj* cell, BuiltinFunc func) {
+    Obj* val = cell->cons.cdr;
+    return val && TYPE(val) == T_FUNC && val->func == func;
+}
+
+/* Run a compiled lambda with its frame until it returns.  Ordinary
+ * instructions continue the dispatch loop; returning instructions break
+ * out of the switch to the return sequence below it. */
+Obj* vm_apply(Obj* func, Obj* frame) {
+    size_t entry_fp = vm_fp;
+    vm_push_frame(func->lambda.body, frame);
+    
+    VMFrame* f = &vm_frames[vm_fp - 1];
+    Code* code = f->code->code;
+    unsigned short* ops = code->ops;
+    int pc = 0;
+    
+    while (1) {
+        switch ((OpCode)ops[pc++]) {
+            case OP_CONST:
+                value_stack[value_sp++] = code->consts[ops[pc++]];
+                continue;
+            
+            case OP_LOCAL0:
+                value_stack[value_sp++] = f->env->frame.slots[ops[pc++]];
+                continue;
+            
+            case OP_LOCAL: {
+                Obj* env = f->env;
+                for (int d = ops[pc++]; d > 0; d--) env = env->frame.parent;
+                value_stack[value_sp++] = env->frame.slots[ops[pc++]];
+                continue;
+            }
+            
+            case OP_GLOBAL: {
+                Obj* cell = code->consts[ops[pc++]];
+                Obj* val = cell->cons.cdr;
+                if (!val) {
+                    fprintf(stderr, "Undefined symbol: %s\n", car(cell)->sym);
+                    val = nil_obj;
+                }
+                value_stack[value_sp++] = val;
+                continue;
+            }
+            
+            case OP_POP:
+                value_sp--;
+                continue;
+            
+            case OP_DUP:
+                value_stack[value_sp] = value_stack[value_sp - 1];
+                value_sp++;
+                continue;
+            
+            case OP_JUMP:
+                pc = ops[pc];
+                continue;
+            
+            case OP_JUMP_IF_NIL:
+                if (is_nil(value_stack[--value_sp])) {
+                    pc = ops[pc];
+                } else {
+                    pc++;
+                }
+                continue;
+            
+            case OP_CALL:
+            case OP_TAILCALL: {
+                int tail = ops[pc - 1] == OP_TAILCALL;
+                int argc = ops[pc++];
+                if (prof_pending) prof_sample();
+                Obj* callee = value_stack[value_sp - argc - 1];
+                
+                if (TYPE(callee) == T_LAMBDA && TYPE(callee->lambda.body) == T_CODE) {
+                    Obj* new_env = vm_bind_args(callee, argc);
+                    if (tail) {
+                        /* Reuse this call's VMFrame */
+                        f->code = callee->lambda.body;
+                        f->env = new_env;
+                        value_sp = f->base;
+                        reserve_values(f->code->code->max_stack + 1);
+                    } else {
+                        value_sp -= argc + 1;
+                        f->pc = pc;
+                        vm_push_frame(callee->lambda.body, new_env);
+                        f = &vm_frames[vm_fp - 1];
+                    }
+                    code = f->code->code;
+                    ops = code->ops;
+                    pc = 0;
+                    continue;
+                }
+                
+                Obj* result = vm_call_native(callee, argc);
+                f = &vm_frames[vm_fp - 1];
+                value_sp -= argc + 1;
+                value_stack[value_sp++] = result;
+                if (tail) break;
+                continue;
+            }
+            
+            case OP_RETURN:
+                break;
+            
+            case OP_CLOSURE: {
+                Obj* body = code->consts[ops[pc++]];
+                value_stack[value_sp++] = make_lambda(body->code->params, body, f->env);
+                continue;
+            }
+            
+            case OP_DEFUN:
+            case OP_DEFUN_MEMO: {
+                int memo = ops[pc - 1] == OP_DEFUN_MEMO;
+                Obj* body = code->consts[ops[pc++]];
+                Obj* func = make_lambda(body->code->params, body, nil_obj);
+                if (memo) func = make_memo(func, MEMO_DEFAULT_LIMIT);
+                global_define(body->code->name, func);
+                value_stack[value_sp++] = body->code->name;
+                continue;
+            }
+            
+            case OP_DEFMACRO: {
+                Obj* body = code->consts[ops[pc++]];
+                int rest = ops[pc++];
+                Obj* func = make_lambda(body->code->params, body, nil_obj);
+                global_define(body->code->name, make_macro(func, rest));
+                value_stack[value_sp++] = body->code->name;
+                continue;
+            }
+            
+            case OP_LET: {
+                int n = ops[pc++];
+                Obj* let_env = make_frame(n, f->env);
+                for (int i = 0; i < n; i++) {
+                    let_env->frame.slots[i] = value_stack[value_sp - n + i];
+                }
+                value_sp -= n;
+                f->env = let_env;
+                continue;
+            }
+            
+            case OP_UNLET:
+                f->env = f->env->frame.parent;
+                continue;
+            
+            case OP_FUTURE: {
+                /* The closure stays on the stack until the future holds it */
+                Obj* call = cons(value_stack[value_sp - 1], nil_obj);
+                Obj* future = spawn_future(call);
+                f = &vm_frames[vm_fp - 1];
+                value_stack[value_sp - 1] = future;
+                continue;
+            }
+            
+            case OP_ADD:
+            case OP_SUB:
+            case OP_MUL:
+            case OP_LT:
+            case OP_EQ:
+            case OP_CONS: {
+                int op = ops[pc - 1];
+                Obj* cell = code->consts[ops[pc++]];
+                Obj* a = value_stack[value_sp - 2];
+                Obj* b = value_stack[value_sp - 1];
+                int ints = IS_INT(a) && IS_INT(b);
+                Obj* result;
+                
+                int r;
+                
+                /* Overflow falls through to the built-in, which goes to bignums */
+                if (op == OP_ADD && ints && is_builtin(cell, builtin_add) &&
+                    !__builtin_add_overflow((int)INT_VAL(a), (int)INT_VAL(b), &r)) {
+                    result = make_int(r);
+                } else if (op == OP_SUB && ints && is_builtin(cell, builtin_sub) &&
+                           !__builtin_sub_overflow((int)INT_VAL(a), (int)INT_VAL(b), &r)) {
+                    result = make_int(r);
+                } else if (op == OP_MUL && ints && is_builtin(cell, builtin_mul) &&
+                           !__builtin_mul_overflow((int)INT_VAL(a), (int)INT_VAL(b), &r)) {
+                    result = make_int(r);
+                } else if (op == OP_LT && ints && is_builtin(cell, builtin_lt)) {
+                    result = INT_VAL(a) < INT_VAL(b) ? t_obj : nil_obj;
+                } else if (op == OP_EQ && (a == b || ints) && is_builtin(cell, builtin_eq)) {
+                    result = a == b ? t_obj : nil_obj;
+                } else if (op == OP_CONS && is_builtin(cell, builtin_cons)) {
+                    result = cons(a, b);
+                } else {
+                    result = vm_call_global(cell, 2);
+                    f = &vm_frames[vm_fp - 1];
+                }
+                value_sp -= 2;
+                value_stack[value_sp++] = result;
+                continue;
+            }
+            
+            case OP_CAR:
+            case OP_CDR: {
+                int op = ops[pc - 1];
+                Obj* cell = code->consts[ops[pc++]];
+                Obj* a = value_stack[value_sp - 1];
+                Obj* result;
+                
+                if (op == OP_CAR && is_builtin(cell, builtin_car)) {
+                    result = car(a);
+                } else if (op == OP_CDR && is_builtin(cell, builtin_cdr)) {
+                    result = cdr(a);
+                } else {
+                    result = vm_call_global(cell, 1);
+                    f = &vm_frames[vm_fp - 1];
+                }
+                value_stack[value_sp - 1] = result;
+                continue;
+            }
+        }
+        
+        /* Return the value on top of the stack to the caller */
+        Obj* result = value_stack[value_sp - 1];
+        value_sp = f->base;
+        vm_fp--;
+        if (vm_fp == entry_fp) return result;
+        f = &vm_frames[vm_fp - 1];
+        code = f->code->code;
+        ops = code->ops;
+        pc = f->pc;
+        value_stack[value_sp++] = result;
+    }
+}
+
+/* Initialize environment */
+void init_env() {
+
+    define_builtin("car", builtin_car);
+    define_builtin("cdr", builtin_cdr);
+    define_builtin("cons", builtin_cons);
+    define_builtin("append", builtin_append);
+    define_builtin("gensym", builtin_gensym);
+    define_builtin("+", builtin_add);
+    define_builtin("-", builtin_sub);
+    define_builtin("*", builtin_mul);
+    define_builtin("/", builtin_div);
+    define_builtin("eq", builtin_eq);
+    define_builtin("equal", builtin_equal);
+    define_builtin("sxhash", builtin_sxhash);
+    define_builtin("<", builtin_lt);
+    define_builtin("print", builtin_print);
+    define_builtin("print-to-string", builtin_print_to_string);
+    define_builtin("stats", builtin_stats);
+    define_builtin("memoize", builtin_memoize);
+    define_builtin("make-vector", builtin_make_vector);
+    define_builtin("vector", builtin_vector);
+    define_builtin("vref", builtin_vref);
+    define_builtin("vset!", builtin_vset);
+    define_builtin("vlength", builtin_vlength);
+    define_builtin("vsum", builtin_vsum);
+    define_builtin("vdot", builtin_vdot);
+    define_builtin("vmin", builtin_vmin);
+    define_builtin("vmax", builtin_vmax);
+    define_builtin("vmap+", builtin_vmap_add);
+    define_builtin("vmap*", builtin_vmap_mul);
+    define_builtin("vmap<", builtin_vmap_lt);
+    define_builtin("vmap=", builtin_vmap_eq);
+    define_builtin("make-hash", builtin_make_hash);
+    define_builtin("gethash", builtin_gethash);
+    define_builtin("puthash", builtin_puthash);
+    define_builtin("hash-count", builtin_hash_count);
+    define_builtin("touch", builtin_touch);
+    define_builtin("pmap", builtin_pmap);
+}
+
+/* Heap images (--dump-image / --image)
+ *
+ * An image holds every global binding and everything reachable from it:
+ * symbols by name, lists, resolved lambda bodies and their bytecode,
+ * closure frames and built-ins by registry index.  Loading one maps the
+ * file and rebuilds the objects in a linear pass, with no reading,
+ * resolving or compiling.
+ *
+ * The file is a header followed by one record per object.  Records are
+ * a u32 ImageTag and fixed fields; references are u64s that hold a
+ * fixnum as is (odd), 0 for NULL, or (index + 1) * 2 for the object
+ * written at that index.  Global binding cells get their own tag, so the
+ * loader can reuse the live cell for the symbol instead of copying it.
+ * Images are only read back by the same build on the same platform.
+ */
+#define IMAGE_MAGIC "TLISPIMG"
+#define IMAGE_VERSION 2
+
+typedef enum {
+    IMG_SYMBOL,     /* u32 len, name bytes */
+    IMG_CONS,       /* car, cdr */
+    IMG_CELL,       /* symbol, value (0 if unbound) */
+    IMG_FUNC,       /* u32 built-in index */
+    IMG_LAMBDA,     /* params, body, env */
+    IMG_FRAME,      /* u32 size, parent, slots */
+    IMG_LOCAL,      /* u32 depth, u32 index, name */
+    IMG_GLOBAL,     /* cell */
+    IMG_CODE,       /* u32 len, nconsts, nparams, rest, max_stack, params, name,
+                     * ops (u16 each), consts */
+    IMG_MEMO,       /* u32 limit, func (the cache is not saved) */
+    IMG_VECTOR,     /* u32 numeric, u32 len, elements (u32 integers or refs) */
+    IMG_FUTURE,     /* value (futures are finished before saving) */
+    IMG_BIG,        /* u32 negative, u32 len, limbs (u32 each) */
+    IMG_MACRO,      /* u32 rest, expander */
+    IMG_HASH        /* u32 count, keys and values */
+} ImageTag;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t ptr_size;
+    uint32_t count;             /* Number of object records */
+    uint32_t reserved;
+} ImageHeader;
+
+/* Objects being written, in record order, with a pointer -> index map */
+typedef struct {
+    Obj** objs;
+    size_t count;
+    size_t capacity;
+    Obj** keys;
+    uint32_t* indexes;
+    size_t table_capacity;
+} ImageWriter;
+
+size_t image_slot(ImageWriter* w, Obj* obj) {
+    size_t mask = w->table_capacity - 1;
+    size_t i = ((uintptr_t)obj >> 4) * 2654435761u & mask;
+    while (w->keys[i] && w->keys[i] != obj) i = (i + 1) & mask;
+    return i;
+}
+
+/* Give obj the next record index if it has none yet */
+void image_add(ImageWriter* w, Obj* obj) {
+    if (!obj || IS_INT(obj)) return;
+    
+    if ((w->count + 1) * 2 > w->table_capacity) {
+        Obj** old_keys = w->keys;
+        uint32_t* old_indexes = w->indexes;
+        size_t old_capacity = w->table_capacity;
+        w->table_capacity = old_capacity ? old_capacity * 2 : 1024;
+        w->keys = (Obj**)calloc(w->table_capacity, sizeof(Obj*));
+        w->indexes = (uint32_t*)malloc(w->table_capacity * sizeof(uint32_t));
+        if (!w->keys || !w->indexes) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (!old_keys[i]) continue;
+            size_t j = image_slot(w, old_keys[i]);
+            w->keys[j] = old_keys[i];
+            w->indexes[j] = old_indexes[i];
+        }
+        free(old_keys);
+        free(old_indexes);
+    }
+    
+    size_t i = image_slot(w, obj);
+    if (w->keys[i]) return;
+    w->keys[i] = obj;
+    w->indexes[i] = (uint32_t)w->count;
+    
+    if (w->count == w->capacity) {
+        w->capacity = w->capacity ? w->capacity * 2 : 1024;
+        w->objs = (Obj**)realloc(w->objs, w->capacity * sizeof(Obj*));
+        if (!w->objs) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    w->objs[w->count++] = obj;
+}
+
+void put_u32(Buffer* b, uint32_t v) {
+    buffer_append(b, (const char*)&v, sizeof(v));
+}
+
+void put_ref(Buffer* b, ImageWriter* w, Obj* obj) {
+    uint64_t v = 0;
+    if (IS_INT(obj)) {
+        v = (uint64_t)(intptr_t)obj;
+    } else if (obj) {
+        v = ((uint64_t)w->indexes[image_slot(w, obj)] + 1) * 2;
+    }
+    buffer_append(b, (const char*)&v, sizeof(v));
+}
+
+/* Is obj the binding cell the global table holds for its symbol? */
+int is_global_cell(Obj* obj) {
+    Obj* sym = obj->cons.car;
+    if (IS_INT(sym) || sym->type != T_SYMBOL || !interp->global_capacity) return 0;
+    size_t mask = interp->global_capacity - 1;
+    for (size_t i = sym->hash & mask; interp->global_table[i]; i = (i + 1) & mask) {
+        if (interp->global_table[i] == obj) return 1;
+        if (car(interp->global_table[i]) == sym) return 0;
+    }
+    return 0;
+}
+
+/* Append an image of the global environment to b */
+void write_image(Buffer* b) {
+    finish_futures();
+    ImageWriter w = {NULL, 0, 0, NULL, NULL, 0};
+    for (size_t i = 0; i < interp->global_capacity; i++) {
+        image_add(&w, interp->global_table[i]);
+    }
+    
+    /* Breadth-first: the record list doubles as the work queue */
+    for (size_t i = 0; i < w.count; i++) {
+        Obj* obj = w.objs[i];
+        switch (obj->type) {
+            case T_CONS:
+                image_add(&w, obj->cons.car);
+                image_add(&w, obj->cons.cdr);
+                break;
+            case T_LAMBDA:
+                image_add(&w, obj->lambda.params);
+                image_add(&w, obj->lambda.body);
+                image_add(&w, obj->lambda.env);
+                break;
+            case T_FRAME:
+                image_add(&w, obj->frame.parent);
+                for (int j = 0; j < obj->frame.size; j++) {
+                    image_add(&w, obj->frame.slots[j]);
+                }
+                break;
+            case T_LOCAL:
+                image_add(&w, obj->local.name);
+                break;
+            case T_GLOBAL:
+                image_add(&w, obj->cell);
+                break;
+            case T_MEMO:
+                image_add(&w, obj->memo.func);
+                break;
+            case T_MACRO:
+                image_add(&w, obj->macro.expander);
+                break;
+            case T_HASH:
+                for (int j = 0; j < obj->htab.capacity; j++) {
+                    if (!obj->htab.entries[j].key) continue;
+                    image_add(&w, obj->htab.entries[j].key);
+                    image_add(&w, obj->htab.entries[j].value);
+                }
+                break;
+            case T_FUTURE:
+                image_add(&w, obj->future.value);
+                break;
+            case T_VECTOR:
+                if (obj->vector.numeric) break;
+                for (int j = 0; j < obj->vector.len; j++) {
+                    image_add(&w, obj->vector.items[j]);
+                }
+                break;
+            case T_CODE:
+                image_add(&w, obj->code->params);
+                image_add(&w, obj->code->name);
+                for (int j = 0; j < obj->code->nconsts; j++) {
+                    image_add(&w, obj->code->consts[j]);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    
+    ImageHeader header = {IMAGE_MAGIC, IMAGE_VERSION, sizeof(Obj*), (uint32_t)w.count, 0};
+    buffer_append(b, (const char*)&header, sizeof(header));
+    
+    for (size_t i = 0; i < w.count; i++) {
+        Obj* obj = w.objs[i];
+        switch (obj->type) {
+            case T_SYMBOL:
+                put_u32(b, IMG_SYMBOL);
+                put_u32(b, (uint32_t)strlen(obj->sym));
+                buffer_append(b, obj->sym, strlen(obj->sym));
+                break;
+            case T_CONS:
+                put_u32(b, is_global_cell(obj) ? IMG_CELL : IMG_CONS);
+                put_ref(b, &w, obj->cons.car);
+                put_ref(b, &w, obj->cons.cdr);
+                break;
+            case T_FUNC: {
+                int index = 0;
+                while (index < interp->builtin_count && interp->builtin_table[index] != obj->func) index++;
+                put_u32(b, IMG_FUNC);
+                put_u32(b, (uint32_t)index);
+                break;
+            }
+            case T_LAMBDA:
+                put_u32(b, IMG_LAMBDA);
+                put_ref(b, &w, obj->lambda.params);
+                put_ref(b, &w, obj->lambda.body);
+                put_ref(b, &w, obj->lambda.env);
+                break;
+            case T_FRAME:
+                put_u32(b, IMG_FRAME);
+                put_u32(b, (uint32_t)obj->frame.size);
+                put_ref(b, &w, obj->frame.parent);
+                for (int j = 0; j < obj->frame.size; j++) {
+                    put_ref(b, &w, obj->frame.slots[j]);
+                }
+                break;
+            case T_LOCAL:
+                put_u32(b, IMG_LOCAL);
+                put_u32(b, (uint32_t)obj->local.depth);
+                put_u32(b, (uint32_t)obj->local.index);
+                put_ref(b, &w, obj->local.name);
+                break;
+            case T_GLOBAL:
+                put_u32(b, IMG_GLOBAL);
+                put_ref(b, &w, obj->cell);
+                break;
+            case T_VECTOR:
+                put_u32(b, IMG_VECTOR);
+                put_u32(b, (uint32_t)obj->vector.numeric);
+                put_u32(b, (uint32_t)obj->vector.len);
+                for (int j = 0; j < obj->vector.len; j++) {
+                    if (obj->vector.numeric) {
+                        put_u32(b, (uint32_t)obj->vector.nums[j]);
+                    } else {
+                        put_ref(b, &w, obj->vector.items[j]);
+                    }
+                }
+                break;
+            case T_MACRO:
+                put_u32(b, IMG_MACRO);
+                put_u32(b, (uint32_t)obj->macro.rest);
+                put_ref(b, &w, obj->macro.expander);
+                break;
+            case T_HASH:
+                put_u32(b, IMG_HASH);
+                put_u32(b, (uint32_t)obj->htab.count);
+                for (int j = 0; j < obj->htab.capacity; j++) {
+                    if (!obj->htab.entries[j].key) continue;
+                    put_ref(b, &w, obj->htab.entries[j].key);
+                    put_ref(b, &w, obj->htab.entries[j].value);
+                }
+                break;
+            case T_MEMO:
+                put_u32(b, IMG_MEMO);
+                put_u32(b, (uint32_t)obj->memo.cache->limit);
+                put_ref(b, &w, obj->memo.func);
+                break;
+            case T_FUTURE:
+                put_u32(b, IMG_FUTURE);
+                put_ref(b, &w, obj->future.value);
+                break;
+            case T_BIG:
+                put_u32(b, IMG_BIG);
+                put_u32(b, (uint32_t)obj->big.negative);
+                put_u32(b, (uint32_t)obj->big.len);
+                for (int j = 0; j < obj->big.len; j++) put_u32(b, obj->big.limbs[j]);
+                break;
+            case T_CODE: {
+                Code* code = obj->code;
+                put_u32(b, IMG_CODE);
+                put_u32(b, (uint32_t)code->len);
+                put_u32(b, (uint32_t)code->nconsts);
+                put_u32(b, (uint32_t)code->nparams);
+                put_u32(b, (uint32_t)code->rest);
+                put_u32(b, (uint32_t)code->max_stack);
+                put_ref(b, &w, code->params);
+                put_ref(b, &w, code->name);
+                buffer_append(b, (const char*)code->ops, code->len * sizeof(unsigned short));
+                for (int j = 0; j < code->nconsts; j++) {
+                    put_ref(b, &w, code->consts[j]);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    
+    free(w.objs);
+    free(w.keys);
+    free(w.indexes);
+}
+
+int dump_image(const char* path) {
+    Buffer b = {NULL, 0, 0};
+    write_image(&b);
+    FILE* f = fopen(path, "wb");
+    int ok = f && fwrite(b.data, 1, b.len, f) == b.len;
+    if (f && fclose(f) != 0) ok = 0;
+    free(b.data);
+    if (!ok) {
+        fprintf(stderr, "Cannot write image %s\n", path);
+        return 1;
+    }
+    return 0;
+}
+
+/* Cursor over a mapped image; any read past the end sets failed */
+typedef struct {
+    const char* data;
+    size_t pos;
+    size_t len;
+    size_t base;                /* value_stack index of object 0 */
+    uint32_t count;
+    int failed;
+} ImageReader;
+
+uint32_t get_u32(ImageReader* r) {
+    uint32_t v = 0;
+    if (r->len - r->pos < sizeof(v)) {
+        r->failed = 1;
+        return 0;
+    }
+    memcpy(&v, r->data + r->pos, sizeof(v));
+    r->pos += sizeof(v);
+    return v;
+}
+
+Obj* get_ref(ImageReader* r) {
+    uint64_t v = 0;
+    if (r->len - r->pos < sizeof(v)) {
+        r->failed = 1;
+        return NULL;
+    }
+    memcpy(&v, r->data + r->pos, sizeof(v));
+    r->pos += sizeof(v);
+    
+    if (v & 1) return (Obj*)(intptr_t)v;
+    if (v == 0) return NULL;
+    if (v / 2 > r->count) {
+        r->failed = 1;
+        return NULL;
+    }
+    return value_stack[r->base + v / 2 - 1];
+}
+
+/* Like get_ref, for fields that must hold an object rather than NULL */
+Obj* get_obj(ImageReader* r) {
+    Obj* obj = get_ref(r);
+    return obj ? obj : nil_obj;
+}
+
+const char* get_bytes(ImageReader* r, size_t len) {
+    if (r->len - r->pos < len) {
+        r->failed = 1;
+        return NULL;
+    }
+    const char* p = r->data + r->pos;
+    r->pos += len;
+    return p;
+}
+
+/* Create the object for the record at r, with every reference still nil.
+ * Cells are left NULL until all symbols exist. */
+Obj* image_alloc(ImageReader* r) {
+    ImageTag tag = (ImageTag)get_u32(r);
+    uint32_t len, size, nconsts;
+    Obj* obj = NULL;
+    
+    switch (tag) {
+        case IMG_SYMBOL: {
+            len = get_u32(r);
+            const char* name = get_bytes(r, len);
+            if (name) obj = intern(name, len, NULL);
+            break;
+        }
+        case IMG_CONS:
+            obj = cons(nil_obj, nil_obj);
+            get_bytes(r, 16);
+            break;
+        case IMG_CELL:
+            get_bytes(r, 16);
+            break;
+        case IMG_FUNC: {
+            uint32_t index = get_u32(r);
+            if (index >= (uint32_t)interp->builtin_count) {
+                r->failed = 1;
+                break;
+            }
+            obj = make_func(interp->builtin_table[index]);
+            break;
+        }
+        case IMG_LAMBDA:
+            obj = make_lambda(nil_obj, nil_obj, nil_obj);
+            get_bytes(r, 24);
+            break;
+        case IMG_FRAME:
+            size = get_u32(r);
+            if (!get_bytes(r, 8 + (size_t)size * 8)) break;
+            obj = make_frame((int)size, nil_obj);
+            break;
+        case IMG_LOCAL:
+            obj = alloc_obj(T_LOCAL);
+            obj->local.name = nil_obj;
+            get_bytes(r, 16);
+            break;
+        case IMG_GLOBAL:
+            obj = alloc_obj(T_GLOBAL);
+            obj->cell = nil_obj;
+            obj->cached = NULL;
+            obj->cached_epoch = 0;
+            get_bytes(r, 8);
+            break;
+        case IMG_MEMO:
+            len = get_u32(r);
+            get_bytes(r, 8);
+            obj = make_memo(nil_obj, len);
+            break;
+        case IMG_MACRO:
+            len = get_u32(r);
+            get_bytes(r, 8);
+            obj = make_macro(nil_obj, len != 0);
+            break;
+        case IMG_HASH:
+            len = get_u32(r);
+            if (len > (1 << 28) || !get_bytes(r, (size_t)len * 16)) {
+                r->failed = 1;
+                break;
+            }
+            obj = make_hash((int)len);
+            break;
+        case IMG_FUTURE:
+            get_bytes(r, 8);
+            obj = make_future(nil_obj);
+            obj->future.state = FUTURE_DONE;
+            break;
+        case IMG_VECTOR: {
+            uint32_t numeric = get_u32(r);
+            len = get_u32(r);
+            if (len > INT32_MAX || !get_bytes(r, (size_t)len * (numeric ? 4 : 8))) {
+                r->failed = 1;
+                break;
+            }
+            obj = make_vector((int)len, numeric != 0);
+            break;
+        }
+        case IMG_BIG:
+            get_u32(r);
+            len = get_u32(r);
+            if (len == 0 || len > INT32_MAX || !get_bytes(r, (size_t)len * 4)) {
+                r->failed = 1;
+                break;
+            }
+            obj = make_big((int)len);
+            break;
+        case IMG_CODE:
+            len = get_u32(r);
+            nconsts = get_u32(r);
+            if (!get_bytes(r, 12 + 16 + (size_t)len * sizeof(unsigned short) + (size_t)nconsts * 8)) break;
+            obj = alloc_obj(T_CODE);
+            obj->code = (Code*)calloc(1, sizeof(Code));
+            if (!obj->code) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            obj->code->params = nil_obj;
+            obj->code->name = nil_obj;
+            break;
+        default:
+            r->failed = 1;
+            break;
+    }
+    return obj;
+}
+
+/* Fill in the fields of the object for the record at r */
+void image_fill(ImageReader* r, Obj* obj) {
+    ImageTag tag = (ImageTag)get_u32(r);
     
-    switch (obj->type) {
-        case T_INT:
-            printf("%d", obj->num);
+    switch (tag) {
+        case IMG_SYMBOL:
+            get_bytes(r, get_u32(r));
             break;
-        case T_SYMBOL:
-            printf("%s", obj->sym);
+        case IMG_CONS:
+            obj->cons.car = get_obj(r);
+            obj->cons.cdr = get_obj(r);
             break;
-        case T_CONS:
-            printf("(");
-            print_obj(car(obj));
-            obj = cdr(obj);
-            while (!is_nil(obj)) {
-                if (obj->type == T_CONS) {
-                    printf(" ");
-                    print_obj(car(obj));
-                    obj = cdr(obj);
+        case IMG_CELL: {
+            get_ref(r);
+            Obj* value = get_ref(r);
+            if (value) obj->cons.cdr = value;
+            break;
+        }
+        case IMG_FUNC:
+            get_u32(r);
+            break;
+        case IMG_LAMBDA:
+            obj->lambda.params = get_obj(r);
+            obj->lambda.body = get_obj(r);
+            obj->lambda.env = get_obj(r);
+            break;
+        case IMG_FRAME:
+            get_u32(r);
+            obj->frame.parent = get_obj(r);
+            for (int i = 0; i < obj->frame.size; i++) {
+                obj->frame.slots[i] = get_obj(r);
+            }
+            break;
+        case IMG_LOCAL:
+            obj->local.depth = (int)get_u32(r);
+            obj->local.index = (int)get_u32(r);
+            obj->local.name = get_obj(r);
+            break;
+        case IMG_GLOBAL:
+            obj->cell = get_obj(r);
+            break;
+        case IMG_MEMO:
+            get_u32(r);
+            obj->memo.func = get_obj(r);
+            break;
+        case IMG_MACRO:
+            get_u32(r);
+            obj->macro.expander = get_obj(r);
+            break;
+        case IMG_HASH:
+            /* Placed in order for now; load_image rehashes the keys once
+             * they are filled in */
+            obj->htab.count = (int)get_u32(r);
+            for (int i = 0; i < obj->htab.count; i++) {
+                obj->htab.entries[i].key = get_obj(r);
+                obj->htab.entries[i].value = get_obj(r);
+            }
+            break;
+        case IMG_FUTURE:
+            obj->future.value = get_obj(r);
+            break;
+        case IMG_VECTOR: {
+            get_u32(r);
+            get_u32(r);
+            for (int i = 0; i < obj->vector.len; i++) {
+                if (obj->vector.numeric) {
+                    obj->vector.nums[i] = (int)get_u32(r);
                 } else {
-                    printf(" . ");
-                    print_obj(obj);
-                    break;
+                    obj->vector.items[i] = get_obj(r);
                 }
             }
-            printf(")");
             break;
-        case T_FUNC:
-            printf("<built-in function>");
-            break;
-        case T_LAMBDA:
-            printf("<lambda>");
+        }
+        case IMG_BIG:
+            obj->big.negative = get_u32(r) != 0;
+            get_u32(r);
+            for (int i = 0; i < obj->big.len; i++) obj->big.limbs[i] = get_u32(r);
             break;
-    }
-}
-
-/* Tokenizer */
-typedef struct {
-    char* input;
-    int pos;
-} Tokenizer;
-
-void skip_whitespace(Tokenizer* t) {
-    while (t->input[t->pos]) {
-        if (isspace(t->input[t->pos])) {
-            t->pos++;
-        } else if (t->input[t->pos] == ';') {
-            /* Skip comment until end of line */
-            while (t->input[t->pos] && t->input[t->pos] != '\n') {
-                t->pos++;
+        case IMG_CODE: {
+            Code* code = obj->code;
+            size_t len = get_u32(r);
+            size_t nconsts = get_u32(r);
+            code->nparams = (int)get_u32(r);
+            code->rest = get_u32(r) != 0;
+            code->max_stack = (int)get_u32(r);
+            code->params = get_obj(r);
+            code->name = get_obj(r);
+            code->ops = (unsigned short*)malloc(len * sizeof(unsigned short) + 1);
+            code->consts = (Obj**)malloc(nconsts * sizeof(Obj*) + 1);
+            if (!code->ops || !code->consts) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
             }
-        } else {
+            memcpy(code->ops, get_bytes(r, len * sizeof(unsigned short)), len * sizeof(unsigned short));
+            code->len = (int)len;
+            for (size_t i = 0; i < nconsts; i++) {
+                code->consts[i] = get_obj(r);
+            }
+            code->nconsts = (int)nconsts;
             break;
         }
+        default:
+            r->failed = 1;
+            break;
     }
 }
 
-char* read_token(Tokenizer* t) {
-    skip_whitespace(t);
-    
-    if (!t->input[t->pos]) return NULL;
+/* Load the len bytes of an image at data, written by write_image, with
+ * name for error messages */
+int read_image(const char* data, size_t len, const char* name) {
+    ImageHeader header;
+    if (len < sizeof(header)) {
+        fprintf(stderr, "Cannot read image %s\n", name);
+        return 1;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, IMAGE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != IMAGE_VERSION || header.ptr_size != sizeof(Obj*)) {
+        fprintf(stderr, "%s is not an image for this interpreter\n", name);
+        return 1;
+    }
     
-    if (t->input[t->pos] == '(' || t->input[t->pos] == ')') {
-        char* token = (char*)malloc(2);
-        token[0] = t->input[t->pos++];
-        token[1] = '\0';
-        return token;
+    /* The loaded objects live on the value stack until they are bound */
+    ImageReader r = {data, sizeof(header), len, value_sp, header.count, 0};
+    size_t* offsets = (size_t*)malloc((header.count + 1) * sizeof(size_t));
+    if (!offsets) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    reserve_values(header.count);
+    for (uint32_t i = 0; i < header.count; i++) {
+        value_stack[value_sp++] = nil_obj;
     }
     
-    int start = t->pos;
-    while (t->input[t->pos] && !isspace(t->input[t->pos]) && 
-           t->input[t->pos] != '(' && t->input[t->pos] != ')') {
-        t->pos++;
+    for (uint32_t i = 0; i < header.count && !r.failed; i++) {
+        offsets[i] = r.pos;
+        Obj* obj = image_alloc(&r);
+        if (obj) value_stack[r.base + i] = obj;
     }
     
-    int len = t->pos - start;
-    char* token = (char*)malloc(len + 1);
-    strncpy(token, &t->input[start], len);
-    token[len] = '\0';
-    return token;
-}
-
-/* Parser */
-Obj* parse_expr(Tokenizer* t);
-
-Obj* parse_list(Tokenizer* t) {
-    skip_whitespace(t);
+    /* Every symbol exists now, so cells can be looked up */
+    for (uint32_t i = 0; i < header.count && !r.failed; i++) {
+        r.pos = offsets[i];
+        if (get_u32(&r) != IMG_CELL) continue;
+        Obj* sym = get_ref(&r);
+        if (!sym || IS_INT(sym) || sym->type != T_SYMBOL) {
+            r.failed = 1;
+            break;
+        }
+        value_stack[r.base + i] = global_cell(sym);
+    }
     
-    /* Check for closing paren */
-    if (t->input[t->pos] == ')') {
-        return nil_obj;
+    for (uint32_t i = 0; i < header.count && !r.failed; i++) {
+        r.pos = offsets[i];
+        Obj* obj = value_stack[r.base + i];
+        image_fill(&r, obj);
+        if (!IS_INT(obj)) WRITE_BARRIER(obj);
     }
     
-    if (!t->input[t->pos]) {
-        fprintf(stderr, "Unexpected EOF in list\n");
-        return nil_obj;
+    /* Keys hash by their contents, which are all there now */
+    for (uint32_t i = 0; i < header.count && !r.failed; i++) {
+        r.pos = offsets[i];
+        if (get_u32(&r) == IMG_HASH) hash_rehash(value_stack[r.base + i]);
     }
+    /* Bindings were filled in place, not through global_define */
+    __atomic_add_fetch(&interp->global_epoch, 1, __ATOMIC_RELEASE);
     
-    Obj* car_obj = parse_expr(t);
-    Obj* cdr_obj = parse_list(t);
-    return cons(car_obj, cdr_obj);
+    value_sp = r.base;
+    free(offsets);
+    if (r.failed) {
+        fprintf(stderr, "Image %s is truncated or corrupt\n", name);
+        return 1;
+    }
+    return 0;
 }
 
-Obj* parse_expr(Tokenizer* t) {
-    char* token = read_token(t);
-    
-    if (!token) return NULL;
+/* Load an image file written by dump_image, adding its bindings to the
+ * global environment */
+int load_image(const char* path) {
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        fprintf(stderr, "Cannot open image %s\n", path);
+        if (fd >= 0) close(fd);
+        return 1;
+    }
     
-    if (strcmp(token, "(") == 0) {
-        free(token);
-        Obj* list = parse_list(t);
-        token = read_token(t);
-        if (!token || strcmp(token, ")") != 0) {
-            fprintf(stderr, "Expected ')'\n");
-        }
-        if (token) free(token);
-        return list;
+    size_t len = (size_t)st.st_size;
+    const char* data = len ? (const char*)mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "Cannot read image %s\n", path);
+        return 1;
     }
+    int status = read_image(data, len, path);
+    munmap((void*)data, len);
+    return status;
+}
+
+/* Profiler output: one line per distinct stack, root first, in the
+ * folded format flame graph tools read ("main;fib;fib 42") */
+typedef struct {
+    char* stack;
+    size_t count;
+} ProfileEntry;
+
+ProfileEntry* prof_table = NULL;
+size_t prof_entries = 0;
+size_t prof_table_capacity = 0;
+Buffer prof_line = {NULL, 0, 0};
+
+void prof_append_name(Obj* name) {
+    const char* text = (name && !is_nil(name)) ? name->sym : "lambda";
+    if (prof_line.len > 0) buffer_append(&prof_line, ";", 1);
+    buffer_append(&prof_line, text, strlen(text));
+}
+
+pthread_mutex_t prof_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Record the current Lisp stack of this thread as one sample */
+void prof_sample() {
+    prof_pending = 0;
     
-    if (strcmp(token, "'") == 0) {
-        free(token);
-        Obj* quoted = parse_expr(t);
-        return cons(make_symbol("quote"), cons(quoted, nil_obj));
+    pthread_mutex_lock(&prof_lock);
+    prof_line.len = 0;
+    if (thread_index == 0) {
+        buffer_append(&prof_line, "toplevel", 8);
+    } else {
+        buffer_append(&prof_line, "future", 6);
+    }
+    for (size_t i = 0; i < prof_depth; i++) {
+        prof_append_name(prof_stack[i]);
+    }
+    for (size_t i = 0; i < vm_fp; i++) {
+        prof_append_name(vm_frames[i].code->code->name);
     }
     
-    /* Check if it's a number */
-    int is_num = 1;
-    int i = (token[0] == '-') ? 1 : 0;
-    if (!token[i]) is_num = 0;
-    for (; token[i]; i++) {
-        if (!isdigit(token[i])) {
-            is_num = 0;
-            break;
+    if ((prof_entries + 1) * 2 > prof_table_capacity) {
+        ProfileEntry* old_table = prof_table;
+        size_t old_capacity = prof_table_capacity;
+        prof_table_capacity = old_capacity ? old_capacity * 2 : 256;
+        prof_table = (ProfileEntry*)calloc(prof_table_capacity, sizeof(ProfileEntry));
+        if (!prof_table) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
         }
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (!old_table[i].stack) continue;
+            size_t j = hash_name(old_table[i].stack, strlen(old_table[i].stack)) & (prof_table_capacity - 1);
+            while (prof_table[j].stack) j = (j + 1) & (prof_table_capacity - 1);
+            prof_table[j] = old_table[i];
+        }
+        free(old_table);
     }
     
-    if (is_num) {
-        int num = atoi(token);
-        free(token);
-        return make_int(num);
+    size_t mask = prof_table_capacity - 1;
+    size_t i = hash_name(prof_line.data, prof_line.len) & mask;
+    while (prof_table[i].stack && strcmp(prof_table[i].stack, prof_line.data) != 0) {
+        i = (i + 1) & mask;
     }
-    
-    /* It's a symbol */
-    Obj* sym = make_symbol(token);
-    free(token);
-    return sym;
-}
-
-/* Environment operations */
-Obj* env_lookup(Obj* env, const char* name) {
-    while (!is_nil(env)) {
-        Obj* pair = car(env);
-        if (strcmp(car(pair)->sym, name) == 0) {
-            return cdr(pair);
+    if (!prof_table[i].stack) {
+        prof_table[i].stack = strdup(prof_line.data);
+        if (!prof_table[i].stack) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
         }
-        env = cdr(env);
+        prof_entries++;
     }
-    return NULL;
+    prof_table[i].count++;
+    pthread_mutex_unlock(&prof_lock);
 }
 
-Obj* env_define(Obj* env, const char* name, Obj* value) {
-    return cons(cons(make_symbol(name), value), env);
+void prof_signal(int sig) {
+    (void)sig;
+    prof_pending = 1;
 }
 
-/* Evaluator */
-Obj* eval(Obj* expr, Obj* env);
+/* Sample every millisecond of CPU time */
+void start_profiler() {
+    profiling = 1;
+    signal(SIGPROF, prof_signal);
+    struct itimerval timer = {{0, 1000}, {0, 1000}};
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+int write_profile(const char* path) {
+    struct itimerval off = {{0, 0}, {0, 0}};
+    setitimer(ITIMER_PROF, &off, NULL);
+    
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "Cannot write profile %s\n", path);
+        return 1;
+    }
+    for (size_t i = 0; i < prof_table_capacity; i++) {
+        if (prof_table[i].stack) {
+            fprintf(f, "%s %zu\n", prof_table[i].stack, prof_table[i].count);
+        }
+    }
+    fclose(f);
+    return 0;
+}
 
-/* Global environment pointer for defun */
-Obj** global_env_ptr = NULL;
+/* Set up nil and t, once for all instances.  They are marked
+ * permanently, since they are not in any slab. */
+pthread_once_t constants_once = PTHREAD_ONCE_INIT;
 
-Obj* eval_list(Obj* list, Obj* env) {
-    if (is_nil(list)) return nil_obj;
-    return cons(eval(car(list), env), eval_list(cdr(list), env));
+void init_constants() {
+    Obj* syms[2] = {nil_obj, t_obj};
+    const char* names[2] = {"nil", "t"};
+    for (int i = 0; i < 2; i++) {
+        syms[i]->type = T_SYMBOL;
+        syms[i]->marked = 1;
+        syms[i]->remembered = 1;    /* Never written, so never remembered */
+        syms[i]->sym = (char*)names[i];
+        syms[i]->special = SF_NONE;
+        syms[i]->hash = hash_name(names[i], strlen(names[i]));
+    }
 }
 
-Obj* eval(Obj* expr, Obj* env) {
-    if (!expr) return nil_obj;
+/* Fill in the current instance's symbols and built-ins */
+void init_interp() {
+    intern("nil", 3, nil_obj);
+    intern("t", 1, t_obj);
     
-    /* Self-evaluating types */
-    if (expr->type == T_INT) return expr;
+    interp->sym_quote = make_special("quote", SF_QUOTE);
+    make_special("if", SF_IF);
+    interp->sym_lambda = make_special("lambda", SF_LAMBDA);
+    make_special("defun", SF_DEFUN);
+    make_special("progn", SF_PROGN);
+    make_special("let", SF_LET);
+    make_special("cond", SF_COND);
+    make_special("defun-memo", SF_DEFUN_MEMO);
+    make_special("future", SF_FUTURE);
+    make_special("defmacro", SF_DEFMACRO);
+    interp->sym_quasiquote = make_special("quasiquote", SF_QUASIQUOTE);
+    interp->sym_unquote = make_symbol("unquote");
+    interp->sym_unquote_splicing = make_symbol("unquote-splicing");
+    interp->sym_rest = make_symbol("&rest");
     
-    /* Symbol lookup */
-    if (expr->type == T_SYMBOL) {
-        if (strcmp(expr->sym, "nil") == 0) return nil_obj;
-        if (strcmp(expr->sym, "t") == 0) return t_obj;
-        
-        /* Look up in provided environment first, then global */
-        Obj* val = env_lookup(env, expr->sym);
-        if (!val && global_env_ptr) {
-            val = env_lookup(*global_env_ptr, expr->sym);
-        }
-        if (!val) {
-            fprintf(stderr, "Undefined symbol: %s\n", expr->sym);
-            return nil_obj;
-        }
-        return val;
+    init_env();
+}
+
+/* Evaluate every top-level form in a buffer, each as soon as it has been
+ * parsed, optionally printing the results.  Returns the value of the
+ * last form. */
+Obj* run_source(const char* src, size_t len, int echo) {
+    Tokenizer t = {src, 0, len};
+    Obj* result = nil_obj;
+    PROTECT(result);
+    
+    while (1) {
+        Obj* expr = parse_expr(&t);
+        if (!expr) break;
+        expr = resolve(expr, nil_obj);
+        result = eval(expr, nil_obj);
+        if (echo) print_lines(&result, 1);
+    }
+    UNPROTECT(1);
+    return result;
+}
+
+/* Run a script file, mapping it into memory rather than copying it */
+int run_file(const char* path) {
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        if (fd >= 0) close(fd);
+        return 1;
     }
     
-    /* List evaluation */
-    if (expr->type == T_CONS) {
-        Obj* op = car(expr);
-        Obj* args = cdr(expr);
-        
-        /* Special forms */
-        if (op->type == T_SYMBOL) {
-            if (strcmp(op->sym, "quote") == 0) {
-                return car(args);
-            }
-            
-            if (strcmp(op->sym, "if") == 0) {
-                Obj* cond = eval(car(args), env);
-                if (!is_nil(cond)) {
-                    return eval(car(cdr(args)), env);
-                } else if (!is_nil(cdr(cdr(args)))) {
-                    return eval(car(cdr(cdr(args))), env);
-                }
-                return nil_obj;
-            }
-            
-            if (strcmp(op->sym, "lambda") == 0) {
-                Obj* params = car(args);
-                Obj* body = car(cdr(args));
-                return make_lambda(params, body, env);
-            }
-            
-            if (strcmp(op->sym, "defun") == 0) {
-                Obj* name = car(args);
-                Obj* params = car(cdr(args));
-                Obj* body = car(cdr(cdr(args)));
-                Obj* lambda = make_lambda(params, body, global_env_ptr ? *global_env_ptr : env);
-                /* Store in global environment */
-                if (global_env_ptr) {
-                    *global_env_ptr = env_define(*global_env_ptr, name->sym, lambda);
-                }
-                return name;
+    size_t len = (size_t)st.st_size;
+    if (len > 0) {
+        char* src = (char*)mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (src == MAP_FAILED) {
+            /* Not mappable (a pipe or device): read it instead */
+            Buffer b = {NULL, 0, 0};
+            char chunk[65536];
+            ssize_t n;
+            while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+                buffer_append(&b, chunk, (size_t)n);
             }
+            run_source(b.data, b.len, 0);
+            free(b.data);
+        } else {
+            madvise(src, len, MADV_SEQUENTIAL);
+            run_source(src, len, 0);
+            munmap(src, len);
         }
-        
-        /* Function application */
-        Obj* func = eval(op, env);
-        
-        if (func->type == T_FUNC) {
-            /* Built-in function */
-            Obj* evaled_args = eval_list(args, env);
-            return func->func(evaled_args, env);
+    }
+    close(fd);
+    return 0;
+}
+
+/* Where a scan for complete top-level forms stopped: the start of the
+ * first token not yet known to be whole, and the paren depth there */
+typedef struct {
+    size_t pos;
+    size_t depth;
+} FormScan;
+
+/* Continue scanning the first len bytes of src, returning the offset
+ * just past the last complete top-level form.  An atom or a , that
+ * touches the end of the input may still be cut short, so the scan
+ * stops in front of it and picks up there once more input arrives. */
+size_t scan_forms(FormScan* scan, const char* src, size_t len) {
+    Tokenizer t = {src, scan->pos, len};
+    size_t end = 0;
+    while (1) {
+        size_t start = t.pos;
+        Token tok = read_token(&t);
+        int partial = t.pos == len &&
+                      (tok.kind == TOK_ATOM || (tok.kind == TOK_QUOTE && tok.start[0] == ','));
+        if (tok.kind == TOK_EOF || partial) {
+            scan->pos = start;
+            return end;
         }
-        
-        if (func->type == T_LAMBDA) {
-            /* User-defined function */
-            Obj* evaled_args = eval_list(args, env);
-            
-            /* Bind parameters */
-            Obj* new_env = func->lambda.env;
-            Obj* params = func->lambda.params;
-            Obj* vals = evaled_args;
-            
-            while (!is_nil(params) && !is_nil(vals)) {
-                new_env = env_define(new_env, car(params)->sym, car(vals));
-                params = cdr(params);
-                vals = cdr(vals);
-            }
-            
-            return eval(func->lambda.body, new_env);
+        if (tok.kind == TOK_LPAREN || tok.kind == TOK_VECTOR) {
+            scan->depth++;
+        } else if (tok.kind == TOK_RPAREN) {
+            if (scan->depth > 0) scan->depth--;
+            if (scan->depth == 0) end = t.pos;
+        } else if (tok.kind == TOK_ATOM && scan->depth == 0) {
+            end = t.pos;
         }
-        
-        fprintf(stderr, "Not a function\n");
-        return nil_obj;
     }
-    
-    return expr;
 }
 
-/* Built-in functions */
-Obj* builtin_car(Obj* args, Obj* env) {
-    if (is_nil(args)) return nil_obj;
-    return car(car(args));
+/* Run forms piped into stdin, printing each result without prompts.
+ * Input is read in large chunks, and the complete forms in each are run
+ * before the next read, so a pipe that stays open gets its answers as
+ * it goes.  A form cut off by the end of a chunk waits for the rest. */
+void run_stdin() {
+    Buffer b = {NULL, 0, 0};
+    FormScan scan = {0, 0};
+    char chunk[65536];
+    ssize_t n;
+    while (1) {
+        /* Futures may still be running, and collecting */
+        enter_safe();
+        n = read(STDIN_FILENO, chunk, sizeof(chunk));
+        leave_safe();
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        buffer_append(&b, chunk, (size_t)n);
+        
+        size_t end = scan_forms(&scan, b.data, b.len);
+        if (end > 0) {
+            run_source(b.data, end, 1);
+            fflush(stdout);
+            memmove(b.data, b.data + end, b.len - end);
+            b.len -= end;
+            scan.pos -= end;
+        }
+    }
+    if (b.len > 0) run_source(b.data, b.len, 1);
+    free(b.data);
 }
 
-Obj* builtin_cdr(Obj* args, Obj* env) {
-    if (is_nil(args)) return nil_obj;
-    return cdr(car(args));
+/* Run each script runs times, reporting the wall time, objects
+ * allocated per run and peak slab memory (--bench) */
+int run_bench(const char** scripts, int count, int runs) {
+    int width = (int)strlen("benchmark");
+    for (int i = 0; i < count; i++) {
+        if ((int)strlen(scripts[i]) > width) width = (int)strlen(scripts[i]);
+    }
+    printf("%-*s %5s %10s %10s %12s %10s\n", width,
+           "benchmark", "runs", "mean ms", "min ms", "allocs/run", "peak KB");
+    
+    for (int i = 0; i < count; i++) {
+        interp->full_pending = 1;
+        gc();
+        interp->heap_peak_bytes = interp->heap_bytes;
+        size_t allocs = total_counters().alloc_total;
+        double total = 0.0, best = 0.0;
+        
+        for (int run = 0; run < runs; run++) {
+            double start = now_ms();
+            if (run_file(scripts[i]) != 0) return 1;
+            double elapsed = now_ms() - start;
+            total += elapsed;
+            if (run == 0 || elapsed < best) best = elapsed;
+        }
+        
+        printf("%-*s %5d %10.3f %10.3f %12zu %10zu\n",
+               width, scripts[i], runs, total / runs, best,
+               (total_counters().alloc_total - allocs) / runs, interp->heap_peak_bytes / 1024);
+        fflush(stdout);
+    }
+    return 0;
 }
 
-Obj* builtin_cons(Obj* args, Obj* env) {
-    if (is_nil(args) || is_nil(cdr(args))) return nil_obj;
-    return cons(car(args), car(cdr(args)));
-}
+/* Server mode (--serve, --socket)
+ *
+ * The image and scripts named on the command line are loaded once, and
+ * then the instance holding them is frozen: from then on none of its
+ * objects is written, so any number of threads can read them.  Each
+ * request runs in an overlay instance on top of it.  The overlay starts
+ * out empty and finds the frozen symbols and globals when it looks up
+ * one of its own that it lacks, so it costs the same however large the
+ * warm environment is.  A request's definitions go into its overlay,
+ * which is freed in one go when it is answered, so no request sees what
+ * another defined.
+ *
+ * A request's code sees its own definition of a global from then on.
+ * The warm environment's functions keep calling the definitions they
+ * were loaded with.  Its vectors and hash tables are read-only, and
+ * the caches of its memoized functions are extended per request.
+ *
+ * Requests and replies are framed alike: the length in bytes as a
+ * decimal number, a newline and that many bytes.  A request is Lisp
+ * source.  Its reply holds whatever the forms printed, followed by the
+ * printed value of the last form on a line of its own.  Error messages
+ * still go to stderr.  All the requests that have arrived are answered
+ * before the replies are written, with one write, so a client can
+ * pipeline them.  With --socket, each connection to the Unix socket is
+ * served on a thread of its own.
+ */
+Interp* warm_interp = NULL;
 
-Obj* builtin_add(Obj* args, Obj* env) {
-    int sum = 0;
-    while (!is_nil(args)) {
-        Obj* arg = car(args);
-        if (arg->type != T_INT) {
-            fprintf(stderr, "+: expected integer\n");
-            return make_int(0);
+Interp* interp_alloc();
+Interp* interp_create_overlay(Interp* parent);
+
+/* Freeze the current instance after a full collection: every object
+ * still alive is marked shared, and stays marked and remembered, so the
+ * write barrier and the collectors of overlay instances pass it by */
+void freeze_heap() {
+    interp->full_pending = 1;
+    gc();
+    for (Mutator* m = interp->mutators; m; m = m->next) {
+        for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+            SizeClass* sc = &m->size_classes[i];
+            for (Slab* slab = sc->slabs; slab; slab = slab->next) {
+                for (size_t j = 0; j < slab->used; j++) {
+                    Obj* obj = (Obj*)(slab->cells + j * sc->cell_size);
+                    if (obj->type == T_FREE) continue;
+                    obj->marked = 1;
+                    obj->remembered = 1;
+                    obj->shared = 1;
+                }
+            }
         }
-        sum += arg->num;
-        args = cdr(args);
     }
-    return make_int(sum);
 }
 
-Obj* builtin_sub(Obj* args, Obj* env) {
-    if (is_nil(args)) return make_int(0);
-    Obj* first = car(args);
-    if (first->type != T_INT) return make_int(0);
+/* Run one request in a fresh overlay instance and append its framed reply */
+void serve_request(const char* src, size_t len, Buffer* out) {
+    Buffer reply = {NULL, 0, 0};
+    Interp* in = interp_create_overlay(warm_interp);
+    Mutator* saved = enter_interp(in);
+    in->output = &reply;
+    Obj* result = run_source(src, len, 0);
+    print_lines(&result, 1);
+    leave_interp(saved);
+    /* Futures still running may print into the reply until they finish */
+    interp_destroy(in);
     
-    if (is_nil(cdr(args))) return make_int(-first->num);
-    
-    int result = first->num;
-    args = cdr(args);
-    while (!is_nil(args)) {
-        Obj* arg = car(args);
-        if (arg->type != T_INT) return make_int(0);
-        result -= arg->num;
-        args = cdr(args);
-    }
-    return make_int(result);
+    char header[32];
+    int n = snprintf(header, sizeof(header), "%zu\n", reply.len);
+    buffer_append(out, header, (size_t)n);
+    buffer_append(out, reply.data ? reply.data : "", reply.len);
+    free(reply.data);
 }
 
-Obj* builtin_mul(Obj* args, Obj* env) {
-    int product = 1;
-    while (!is_nil(args)) {
-        Obj* arg = car(args);
-        if (arg->type != T_INT) return make_int(1);
-        product *= arg->num;
-        args = cdr(args);
+int write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        data += n;
+        len -= (size_t)n;
     }
-    return make_int(product);
+    return 1;
 }
 
-Obj* builtin_div(Obj* args, Obj* env) {
-    if (is_nil(args)) return make_int(1);
-    Obj* first = car(args);
-    if (first->type != T_INT) return make_int(1);
+/* Answer framed requests from in_fd on out_fd until in_fd is closed */
+int serve_fd(int in_fd, int out_fd) {
+    Buffer input = {NULL, 0, 0};
+    Buffer out = {NULL, 0, 0};
+    char chunk[65536];
+    int status = 0;
     
-    int result = first->num;
-    args = cdr(args);
-    while (!is_nil(args)) {
-        Obj* arg = car(args);
-        if (arg->type != T_INT || arg->num == 0) {
-            fprintf(stderr, "/: division by zero or bad argument\n");
-            return make_int(0);
+    while (status == 0) {
+        ssize_t n = read(in_fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        buffer_append(&input, chunk, (size_t)n);
+        
+        /* Answer every request that has fully arrived */
+        size_t pos = 0;
+        while (1) {
+            const char* newline = memchr(input.data + pos, '\n', input.len - pos);
+            if (!newline) {
+                if (input.len - pos > 20) status = 1;
+                break;
+            }
+            size_t size = 0;
+            const char* p = input.data + pos;
+            if (p == newline) status = 1;
+            for (; p < newline && status == 0; p++) {
+                if (!isdigit((unsigned char)*p) || size > (SIZE_MAX - 9) / 10) {
+                    status = 1;
+                    break;
+                }
+                size = size * 10 + (size_t)(*p - '0');
+            }
+            if (status != 0) break;
+            size_t start = (size_t)(newline + 1 - input.data);
+            if (input.len - start < size) break;
+            serve_request(input.data + start, size, &out);
+            pos = start + size;
         }
-        result /= arg->num;
-        args = cdr(args);
+        
+        memmove(input.data, input.data + pos, input.len - pos);
+        input.len -= pos;
+        if (out.len > 0 && !write_all(out_fd, out.data, out.len)) break;
+        out.len = 0;
     }
-    return make_int(result);
-}
-
-Obj* builtin_eq(Obj* args, Obj* env) {
-    if (is_nil(args) || is_nil(cdr(args))) return nil_obj;
-    Obj* a = car(args);
-    Obj* b = car(cdr(args));
     
-    if (a->type != b->type) return nil_obj;
-    if (a->type == T_INT) {
-        return (a->num == b->num) ? t_obj : nil_obj;
+    if (status != 0) {
+        fprintf(stderr, "Bad request header\n");
+    } else if (input.len > 0) {
+        fprintf(stderr, "Truncated request\n");
+        status = 1;
     }
-    return (a == b) ? t_obj : nil_obj;
+    free(input.data);
+    free(out.data);
+    return status;
 }
 
-Obj* builtin_lt(Obj* args, Obj* env) {
-    if (is_nil(args) || is_nil(cdr(args))) return nil_obj;
-    Obj* a = car(args);
-    Obj* b = car(cdr(args));
-    if (a->type != T_INT || b->type != T_INT) return nil_obj;
-    return (a->num < b->num) ? t_obj : nil_obj;
+void* serve_connection(void* arg) {
+    int fd = (int)(intptr_t)arg;
+    serve_fd(fd, fd);
+    close(fd);
+    return NULL;
 }
 
-Obj* builtin_print(Obj* args, Obj* env) {
-    while (!is_nil(args)) {
-        print_obj(car(args));
-        printf("\n");
-        args = cdr(args);
+int serve_socket(const char* path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return 1;
+    }
+    strcpy(addr.sun_path, path);
+    
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 64) < 0) {
+        fprintf(stderr, "Cannot listen on %s\n", path);
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+    
+    while (1) {
+        int conn = accept(fd, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            fprintf(stderr, "Cannot accept on %s\n", path);
+            close(fd);
+            return 1;
+        }
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, serve_connection, (void*)(intptr_t)conn) != 0) {
+            fprintf(stderr, "Cannot start a thread for a connection\n");
+            close(conn);
+            continue;
+        }
+        pthread_detach(thread);
     }
-    return nil_obj;
 }
 
-/* Initialize environment */
-Obj* init_env() {
-    Obj* env = nil_obj;
-    
-    env = env_define(env, "car", make_func(builtin_car));
-    env = env_define(env, "cdr", make_func(builtin_cdr));
-    env = env_define(env, "cons", make_func(builtin_cons));
-    env = env_define(env, "+", make_func(builtin_add));
-    env = env_define(env, "-", make_func(builtin_sub));
-    env = env_define(env, "*", make_func(builtin_mul));
-    env = env_define(env, "/", make_func(builtin_div));
-    env = env_define(env, "eq", make_func(builtin_eq));
-    env = env_define(env, "<", make_func(builtin_lt));
-    env = env_define(env, "print", make_func(builtin_print));
+/* Load the warm environment, then serve requests on stdin or a socket */
+int run_server(const char** scripts, int count, const char* socket_path) {
+    /* What the scripts print would be taken for replies on stdout */
+    Buffer prelude_output = {NULL, 0, 0};
+    interp->output = &prelude_output;
+    for (int i = 0; i < count; i++) {
+        if (run_file(scripts[i]) != 0) return 1;
+    }
+    finish_futures();
+    interp->output = NULL;
+    fwrite(prelude_output.data ? prelude_output.data : "", 1, prelude_output.len, stderr);
+    free(prelude_output.data);
+    freeze_heap();
+    warm_interp = interp;
     
-    return env;
+    /* A client that goes away must not take the server with it */
+    signal(SIGPIPE, SIG_IGN);
+    if (socket_path) return serve_socket(socket_path);
+    return serve_fd(STDIN_FILENO, STDOUT_FILENO);
+}
+
+/* Scan one line of REPL input, updating the paren depth and noting
+ * whether it has anything other than whitespace and comments */
+int scan_line(const char* line, size_t len, int* paren_depth) {
+    int has_content = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (line[i] == ';') break;
+        if (line[i] == '(') (*paren_depth)++;
+        if (line[i] == ')') (*paren_depth)--;
+        if (!isspace((unsigned char)line[i])) has_content = 1;
+    }
+    return has_content;
 }
 
 /* REPL */
 void repl() {
-    nil_obj = alloc_obj(T_SYMBOL);
-    nil_obj->sym = strdup("nil");
-    
-    t_obj = alloc_obj(T_SYMBOL);
-    t_obj->sym = strdup("t");
-    
-    Obj* global_env = init_env();
-    global_env_ptr = &global_env;  /* Set global environment pointer */
-    
     printf("Tiny LISP Interpreter\n");
     printf("Type expressions to evaluate. Press Ctrl+D to exit.\n");
     printf("Multi-line expressions are supported.\n\n");
     
-    char input[4096];
-    char line[1024];
+    Buffer input = {NULL, 0, 0};
+    char* line = NULL;
+    size_t line_cap = 0;
     
     while (1) {
         printf("> ");
         fflush(stdout);
         
-        input[0] = '\0';
+        input.len = 0;
         int paren_depth = 0;
-        int first_line = 1;
+        int has_content = 0;
+        int at_eof = 0;
         
         /* Read lines until we have balanced parentheses or hit EOF */
         while (1) {
-            if (!fgets(line, sizeof(line), stdin)) {
-                if (strlen(input) == 0) {
-                    printf("\n");
-                    return;
-                }
+            /* Futures may still be running, and collecting */
+            enter_safe();
+            ssize_t n = getline(&line, &line_cap, stdin);
+            leave_safe();
+            if (n < 0) {
+                at_eof = 1;
                 break;
             }
             
-            /* Check if line is just a comment or whitespace */
-            int is_empty = 1;
-            int in_comment = 0;
-            for (int i = 0; line[i]; i++) {
-                if (line[i] == ';') in_comment = 1;
-                if (!in_comment && !isspace(line[i])) {
-                    is_empty = 0;
-                    break;
-                }
-            }
-            
-            if (is_empty && first_line) {
+            int line_content = scan_line(line, (size_t)n, &paren_depth);
+            if (!line_content && !has_content) {
                 break;  /* Empty line at start, skip it */
             }
-            
-            /* Append to input buffer */
-            if (strlen(input) + strlen(line) < sizeof(input) - 1) {
-                strcat(input, line);
-            }
-            
-            /* Count parentheses */
-            in_comment = 0;
-            for (int i = 0; line[i]; i++) {
-                if (line[i] == ';') in_comment = 1;
-                if (line[i] == '\n') in_comment = 0;
-                if (!in_comment) {
-                    if (line[i] == '(') paren_depth++;
-                    if (line[i] == ')') paren_depth--;
-                }
-            }
-            
-            first_line = 0;
+            has_content |= line_content;
+            buffer_append(&input, line, (size_t)n);
             
             /* If we have balanced parens and at least one expr, we're done */
-            if (paren_depth == 0 && strlen(input) > 0) {
-                /* Check if we have any non-whitespace/comment content */
-                int has_content = 0;
-                in_comment = 0;
-                for (int i = 0; input[i]; i++) {
-                    if (input[i] == ';') in_comment = 1;
-                    if (input[i] == '\n') in_comment = 0;
-                    if (!in_comment && !isspace(input[i])) {
-                        has_content = 1;
-                        break;
-                    }
-                }
-                if (has_content) break;
-            }
+            if (paren_depth <= 0 && has_content) break;
             
-            if (paren_depth > 0) {
-                printf("  ");  /* Continuation prompt */
-                fflush(stdout);
-            }
+            printf("  ");  /* Continuation prompt */
+            fflush(stdout);
         }
         
-        if (strlen(input) == 0) continue;
-        
-        Tokenizer t = {input, 0};
-        Obj* expr = parse_expr(&t);
-        
-        if (expr) {
-            Obj* result = eval(expr, global_env);
-            print_obj(result);
+        if (at_eof && !has_content) {
             printf("\n");
+            break;
         }
+        
+        if (has_content) run_source(input.data, input.len, 1);
+        if (at_eof) break;
     }
+    
+    free(line);
+    free(input.data);
 }
 
-int main() {
-    repl();
-    return 0;
+/* An instance with an empty heap and no symbols or globals yet */
+Interp* interp_alloc() {
+    pthread_once(&constants_once, init_constants);
+    Interp* in = (Interp*)calloc(1, sizeof(Interp));
+    if (!in) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    in->gc_threshold = GC_MIN_THRESHOLD;
+    in->global_epoch = 1;
+    in->old_threshold = GC_MIN_OLD_CELLS;
+    in->vector_threshold = GC_MIN_VECTOR_BYTES;
+    in->old_vector_threshold = GC_MIN_VECTOR_BYTES;
+    in->last_result = nil_obj;
+    in->memo_overlays = nil_obj;
+    pthread_mutex_init(&in->heap_lock, NULL);
+    pthread_mutex_init(&in->world_lock, NULL);
+    pthread_cond_init(&in->world_cond, NULL);
+    pthread_mutex_init(&in->table_lock, NULL);
+    pthread_mutex_init(&in->memo_lock, NULL);
+    pthread_mutex_init(&in->output_lock, NULL);
+    pthread_mutex_init(&in->pool_lock, NULL);
+    pthread_cond_init(&in->work_cond, NULL);
+    pthread_cond_init(&in->done_cond, NULL);
+    register_mutator(in, &in->main);
+    return in;
+}
+
+/* An instance on top of a frozen parent (see freeze_heap): it starts
+ * out with none of its own symbols, globals or built-ins and reads the
+ * parent's until it defines its own */
+Interp* interp_create_overlay(Interp* parent) {
+    Interp* in = interp_alloc();
+    in->parent = parent;
+    in->global_epoch = parent->global_epoch;
+    in->sym_quote = parent->sym_quote;
+    in->sym_quasiquote = parent->sym_quasiquote;
+    in->sym_unquote = parent->sym_unquote;
+    in->sym_unquote_splicing = parent->sym_unquote_splicing;
+    in->sym_lambda = parent->sym_lambda;
+    in->sym_rest = parent->sym_rest;
+    return in;
+}
+
+/* Embedding API, see tinylisp.h */
+Interp* interp_create() {
+    Interp* in = interp_alloc();
+    Mutator* saved = enter_interp(in);
+    init_interp();
+    leave_interp(saved);
+    return in;
+}
+
+void interp_destroy(Interp* in) {
+    Mutator* saved = enter_interp(in);
+    finish_futures();
+    if (in->pool_started) stop_pool();
+    enter_safe();
+    
+    /* The whole heap goes at once: slabs are freed without sweeping,
+     * after releasing what their live objects own outside them */
+    Mutator* m = in->mutators;
+    while (m) {
+        for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+            SizeClass* sc = &m->size_classes[i];
+            while (sc->slabs) {
+                Slab* slab = sc->slabs;
+                sc->slabs = slab->next;
+                for (size_t j = 0; j < slab->used; j++) {
+                    Obj* obj = (Obj*)(slab->cells + j * sc->cell_size);
+                    if (obj->type != T_FREE) finalize_obj(obj);
+                }
+                free(slab);
+            }
+        }
+        free(m->root_stack);
+        free(m->value_stack);
+        free(m->vm_frames);
+        free(m->prof_stack);
+        free(m->remembered);
+        Mutator* next = m->next;
+        if (m != &in->main) free(m);
+        m = next;
+    }
+    
+    if (in->deques) {
+        for (int i = 0; i <= in->pool_size; i++) {
+            free(in->deques[i].items);
+            pthread_mutex_destroy(&in->deques[i].lock);
+        }
+    }
+    free(in->deques);
+    free(in->workers);
+    free(in->mark_stack);
+    free(in->symbol_table);
+    free(in->global_table);
+    free(in->builtin_table);
+    free(in->parse_levels);
+    pthread_mutex_destroy(&in->heap_lock);
+    pthread_mutex_destroy(&in->world_lock);
+    pthread_cond_destroy(&in->world_cond);
+    pthread_mutex_destroy(&in->table_lock);
+    pthread_mutex_destroy(&in->memo_lock);
+    pthread_mutex_destroy(&in->output_lock);
+    pthread_mutex_destroy(&in->pool_lock);
+    pthread_cond_destroy(&in->work_cond);
+    pthread_cond_destroy(&in->done_cond);
+    free(in);
+    
+    use_mutator(saved);
+    if (saved) leave_safe();
+}
+
+Obj* interp_eval_string(Interp* in, const char* src) {
+    Mutator* saved = enter_interp(in);
+    Obj* result = run_source(src, strlen(src), 0);
+    in->last_result = result;
+    leave_interp(saved);
+    return result;
+}
+
+int interp_eval_file(Interp* in, const char* path) {
+    Mutator* saved = enter_interp(in);
+    int status = run_file(path);
+    leave_interp(saved);
+    return status;
+}
+
+void interp_register_builtin(Interp* in, const char* name, BuiltinFunc func) {
+    Mutator* saved = enter_interp(in);
+    define_builtin(name, func);
+    leave_interp(saved);
+}
+
+#ifndef TINYLISP_NO_MAIN
+int main(int argc, char** argv) {
+    const char** scripts = (const char**)malloc(argc * sizeof(char*));
+    int script_count = 0;
+    int bench_runs = 0;
+    const char* image = NULL;
+    const char* dump = NULL;
+    const char* profile = NULL;
+    const char* socket_path = NULL;
+    int serve = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--gc-trace") == 0) {
+            gc_trace = 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            show_stats = 1;
+        } else if (strcmp(argv[i], "--vm") == 0) {
+            use_vm = 1;
+        } else if (strcmp(argv[i], "--image") == 0 && i + 1 < argc) {
+            image = argv[++i];
+        } else if (strcmp(argv[i], "--dump-image") == 0 && i + 1 < argc) {
+            dump = argv[++i];
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            profile = argv[++i];
+        } else if (strcmp(argv[i], "--serve") == 0) {
+            serve = 1;
+        } else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            serve = 1;
+            socket_path = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            thread_count = atoi(argv[++i]);
+            if (thread_count < 1) {
+                fprintf(stderr, "--threads needs a positive thread count\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            bench_runs = atoi(argv[++i]);
+            if (bench_runs < 1) {
+                fprintf(stderr, "--bench needs a positive run count\n");
+                return 1;
+            }
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 1;
+        } else {
+            scripts[script_count++] = argv[i];
+        }
+    }
+    
+    enter_interp(interp_create());
+    if (image && load_image(image) != 0) return 1;
+    if (profile) start_profiler();
+    
+    if (serve) return run_server(scripts, script_count, socket_path);
+    if (bench_runs) {
+        if (script_count == 0) {
+            fprintf(stderr, "--bench needs script files to run\n");
+            return 1;
+        }
+        if (run_bench(scripts, script_count, bench_runs) != 0) return 1;
+    } else if (script_count) {
+        for (int i = 0; i < script_count; i++) {
+            if (run_file(scripts[i]) != 0) return 1;
+        }
+    } else if (!isatty(STDIN_FILENO)) {
+        run_stdin();
+    } else {
+        repl();
+    }
+    
+    finish_futures();
+    int status = dump ? dump_image(dump) : 0;
+    if (profile && write_profile(profile) != 0) status = 1;
+    if (show_stats) print_stats();
+    return status;
 }
+#endif
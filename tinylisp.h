@@ -0,0 +1,66 @@
+#ifndef TINYLISP_H
+#define TINYLISP_H
+
+#include <stdint.h>
+
+/* Tiny LISP embedding API
+ *
+ * Build tinylisp.c with -DTINYLISP_NO_MAIN and link it into the host
+ * program.  Each Interp is a separate interpreter with its own heap,
+ * symbols, globals and thread pool; instances share nothing, so any
+ * number of them can run at once on different threads.  One instance
+ * must only be called from one thread at a time.  A built-in may call
+ * back into its own instance, but not destroy it.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Obj Obj;
+typedef struct Interp Interp;
+
+/* Built-in function pointer type: arguments arrive as an array on the
+ * value stack, so calling a built-in never allocates */
+typedef Obj* (*BuiltinFunc)(int argc, Obj** argv);
+
+/* Create an instance with the standard built-ins defined */
+Interp* interp_create();
+
+/* Free an instance and its whole heap, after waiting for its futures */
+void interp_destroy(Interp* in);
+
+/* Evaluate every form in a NUL-terminated string and return the value
+ * of the last one (nil if there are none).  The value is valid until
+ * the next call into the instance. */
+Obj* interp_eval_string(Interp* in, const char* src);
+
+/* Evaluate a script file; returns 0, or 1 if it cannot be opened */
+int interp_eval_file(Interp* in, const char* path);
+
+/* Bind a C function to a global name in one instance */
+void interp_register_builtin(Interp* in, const char* name, BuiltinFunc func);
+
+/* Values, for built-ins and results.  Integers are tagged fixnums held
+ * in the pointer itself (low bit set); nil and t are shared constants. */
+extern Obj nil_symbol;
+extern Obj t_symbol;
+#define nil_obj (&nil_symbol)
+#define t_obj (&t_symbol)
+#define IS_INT(obj) (((intptr_t)(obj)) & 1)
+#define INT_VAL(obj) ((intptr_t)(obj) >> 1)
+
+Obj* make_int(int num);
+Obj* make_symbol(const char* name);
+Obj* cons(Obj* car, Obj* cdr);
+Obj* car(Obj* obj);
+Obj* cdr(Obj* obj);
+int is_nil(Obj* obj);
+void print_obj(Obj* obj);
+char* print_to_string(Obj* obj);    /* malloc'd; the caller frees it */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif